@@ -1,9 +1,9 @@
-/*! \file engine.h
-* A header file which includes relevant headers for development
-*/
-
-#pragma once
-
-#include "core/application.h"
-
-
+/*! \file engine.h
+* A header file which includes relevant headers for development
+*/
+
+#pragma once
+
+#include "core/application.h"
+
+
@@ -1,65 +1,86 @@
-/*! \file application.h
-*/
-#pragma once
-
-#include "systems/log.h"
-#include "timer.h"
-#include "events/events.h"
-#include "core/window.h"
-#include "inputPoller.h"
-
-namespace Engine {
-
-	/*!
-	\class Application
-	Fundemental class of the engine. A singleton which runs the game loop infinitely.
-	Provides ...
-	*/
-
-	class Application
-	{
-	protected:
-		Application(); //!< Constructor
-
-		std::shared_ptr<Log> m_logSystem; //!< Console Logger
-		std::shared_ptr<System> m_windowsSystem; //!< Windows system
-
-		//Non systems
-		std::shared_ptr<ChronoTimer> m_timer; //!< Timer
-		std::shared_ptr<Window> m_window; //!< Window
-		EventHandler m_handler; //!< Event handler
-
-		//Window Events
-		bool onClose(WindowCloseEvent& i); //!< Runs when the window is closed
-		bool onResize(WindowResizeEvent& i); //!< Runs when the window is resized
-		bool onWinMove(WindowMoved& i); //!< Runs when window is moved
-		bool onLostFocus(WindowLostFocus& i); //!< Runs when window loses focus
-		bool onFocus(WindowFocus& i); //!< Runs when window gains focus
-
-		//Keyboard Events
-		bool onKeyPressed(KeyPressed& i);//!< Called whenever a key is pressed
-		bool onKeyReleased(KeyReleased& i); //!< Called whenever a key is released
-		bool onKeyTyped(KeyTyped& i); //!< Called when a key is pressed in the context of typing
-
-		//Mouse Events
-		bool onMouseButtonPressed(MouseButtonPressed& i); //!< Called when a mouse button is pressed
-		bool onMouseButtonReleased(MouseButtonReleased& i); //!< Called when a mouse button is released
-		bool onMouseMoved(MouseMoved& i); //!< Called whenever the mouse is moved
-		bool onMouseScrolled(MouseScrolled& i); //!< Called whenever the mouse is scrolled, whether it be the scroll wheel or the 
-
-
-
-
-	private:
-		static Application* s_instance; //!< Singleton instance of the application
-		bool m_running = true; //!< Is the application running?
-	public:
-		virtual ~Application(); //!< Deconstructor
-		inline static Application& getInstance() { return *s_instance; } //!< Instance getter from singleton pattern
-		inline std::shared_ptr<Window> getWindow() { return m_window; } //!< Getter for the window (Used in win32)
-		void run(); //!< Main loop
-	};
-
-	// To be defined in users code
-	Application* startApplication(); //!< Function definition which provides an entry hook
+/*! \file application.h
+*/
+#pragma once
+
+#include "systems/log.h"
+#include "systems/threadPool.h"
+#include "systems/renderThread.h"
+#include "systems/profiler.h"
+#include "renderer/frameCapture.h"
+#include "timer.h"
+#include "events/events.h"
+#include "core/window.h"
+#include "inputPoller.h"
+#include "renderer/renderer3D.h"
+
+namespace Engine {
+
+	/*!
+	\class Application
+	Fundemental class of the engine. A singleton which runs the game loop infinitely.
+	Provides ...
+	*/
+
+	class Application
+	{
+	protected:
+		Application(); //!< Constructor
+
+		std::shared_ptr<Log> m_logSystem; //!< Console Logger
+		std::shared_ptr<System> m_windowsSystem; //!< Windows system
+		std::shared_ptr<ThreadPool> m_threadPool; //!< Worker threads
+		std::shared_ptr<RenderThread> m_renderThread; //!< Owns the graphics context while the game loop runs, if m_useRenderThread is set
+		std::shared_ptr<Profiler> m_profiler; //!< Records zones for a Chrome trace, started if a trace path was given
+		std::shared_ptr<FrameCapture> m_frameCapture; //!< Records frames for replay, started if a capture path was given
+
+		//Non systems
+		std::shared_ptr<ChronoTimer> m_timer; //!< Timer
+		std::shared_ptr<Window> m_window; //!< Window
+		std::shared_ptr<ClusteredLighting> m_lighting; //!< Lights of the 3D scene, a member so resizing can reach them
+		EventHandler m_handler; //!< Event handler
+		bool m_useRenderThread = true; //!< Draw on the render thread while the main thread simulates the next frame. Set false to do both on the main thread
+
+		//Window Events
+		bool onClose(WindowCloseEvent& i); //!< Runs when the window is closed
+		bool onResize(WindowResizeEvent& i); //!< Runs when the window is resized
+		bool onWinMove(WindowMoved& i); //!< Runs when window is moved
+		bool onLostFocus(WindowLostFocus& i); //!< Runs when window loses focus
+		bool onFocus(WindowFocus& i); //!< Runs when window gains focus
+
+		//Keyboard Events
+		bool onKeyPressed(KeyPressed& i);//!< Called whenever a key is pressed
+		bool onKeyReleased(KeyReleased& i); //!< Called whenever a key is released
+		bool onKeyTyped(KeyTyped& i); //!< Called when a key is pressed in the context of typing
+
+		//Mouse Events
+		bool onMouseButtonPressed(MouseButtonPressed& i); //!< Called when a mouse button is pressed
+		bool onMouseButtonReleased(MouseButtonReleased& i); //!< Called when a mouse button is released
+		bool onMouseMoved(MouseMoved& i); //!< Called whenever the mouse is moved
+		bool onMouseScrolled(MouseScrolled& i); //!< Called whenever the mouse is scrolled, whether it be the scroll wheel or the 
+
+
+
+
+	private:
+		static Application* s_instance; //!< Singleton instance of the application
+		static uint32_t s_frameLimit; //!< Frames to run before stopping, 0 runs until the window is closed
+		static const char* s_profilePath; //!< Where to write the profiler's trace, null to not record one
+		static const char* s_capturePath; //!< Where to write a frame capture, null to not track resources for one
+		static uint32_t s_captureStart; //!< Frames to run before capturing, 0 waits for F3
+		static uint32_t s_captureFrames; //!< Frames in a capture
+		static const char* s_replayPath; //!< Frame capture to replay instead of running the game, null to run the game
+		bool m_running = true; //!< Is the application running?
+		RenderPath m_renderPath = RenderPath::Forward; //!< How the 3D scene is lit, F1 to swap
+		bool m_showStats = false; //!< Draw the render stats overlay, F2 to toggle
+		void replay(); //!< Replay the frame capture at s_replayPath on this thread and log how long its frames took
+	public:
+		virtual ~Application(); //!< Deconstructor
+		inline static Application& getInstance() { return *s_instance; } //!< Instance getter from singleton pattern
+		inline std::shared_ptr<Window> getWindow() { return m_window; } //!< Getter for the window (Used in win32)
+		void run(); //!< Main loop
+		static void parseCommandLine(int argc, char** argv); //!< Read startup options, before the application is created. "--null-renderer" runs without a GPU or a window, "--headless" renders in a hidden window, which still needs a display, "--frames N" stops after N frames, "--profile path" records a Chrome trace, "--capture path" records frames for replay on F3 or from frame "--capture-start N", "--capture-frames N" frames long, and "--replay path" times a capture's frames instead of running the game
+	};
+
+	// To be defined in users code
+	Application* startApplication(); //!< Function definition which provides an entry hook
 }
\ No newline at end of file
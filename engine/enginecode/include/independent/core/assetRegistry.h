@@ -0,0 +1,64 @@
+/*! \file assetRegistry.h
+* \brief Loads each asset file once, however many places ask for it
+*/
+#pragma once
+
+#include "core/stringID.h"
+#include "rendering/texture.h"
+#include "rendering/shader.h"
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace Engine
+{
+	/*! \enum AssetState
+	* \brief How far an asset has got
+	*/
+	enum class AssetState
+	{
+		Unloaded, //!< Never loaded, or every handle to it has been released
+		Loading, //!< Loaded but not usable yet, like an async texture or shader. Draws as its placeholder or fallback
+		Ready, //!< Usable
+		Failed //!< The file couldn't be read, decoded or compiled. The next load of it tries again
+	};
+
+	/*! \class AssetRegistry
+	* \brief Caches assets by their normalised path. Loading a path that is already loaded returns the same asset, so it is only decoded and uploaded once.
+	* The registry only keeps weak handles, so an asset is unloaded as soon as the last shared handle to it is released, and a later load makes it again.
+	* The load mode only applies to the first load, later loads get the asset as it is. A failed asset is never handed out again, the next load of its path
+	* replaces it with a fresh attempt. Safe to use from any thread
+	*/
+	class AssetRegistry
+	{
+	public:
+		static std::shared_ptr<Texture> loadTexture(const char* filepath, TextureLoadMode mode = TextureLoadMode::Blocking); //!< Getter for the texture at a path, loading it if it isn't already
+		static std::shared_ptr<Shader> loadShader(const char* filepath, ShaderCompileMode mode = ShaderCompileMode::Blocking); //!< Getter for the shader at a path, loading it if it isn't already
+		static std::shared_ptr<Shader> loadShader(const char* vertexFile, const char* fragmentFile); //!< Getter for the shader made from two files, loading it if it isn't already
+
+		static std::shared_ptr<Texture> findTexture(StringID id); //!< Getter for a loaded texture, nullptr if it isn't loaded. Never loads
+		static std::shared_ptr<Shader> findShader(StringID id); //!< Getter for a loaded shader, nullptr if it isn't loaded. Never loads
+		static AssetState getState(StringID id); //!< Getter for how far an asset has got
+
+		static StringID getID(const char* filepath); //!< Getter for the ID an asset's path is cached under. "./a/../b.png" and "b.png" share an ID
+		static uint32_t getLoadedCount(); //!< Getter for the number of assets loaded
+	private:
+		/*! \struct AssetCache
+		* \brief One type of asset's weak handles by ID. Shared with the handles' deleters, so assets outliving the registry can still be released
+		*/
+		template<typename T>
+		struct AssetCache
+		{
+			std::unordered_map<StringID, std::weak_ptr<T>> assets; //!< Weak handles by ID
+			std::mutex mutex; //!< Guards the handles
+		};
+
+		template<typename T>
+		static std::shared_ptr<T> find(AssetCache<T>& cache, StringID id); //!< Lock the weak handle for an ID, nullptr if there isn't a live one
+		template<typename T, typename Load>
+		static std::shared_ptr<T> acquire(const std::shared_ptr<AssetCache<T>>& cache, StringID id, Load&& load); //!< Find an asset or load it
+
+		static std::shared_ptr<AssetCache<Texture>> s_textures; //!< Textures loaded
+		static std::shared_ptr<AssetCache<Shader>> s_shaders; //!< Shaders loaded
+	};
+}
@@ -1,15 +1,17 @@
-/*! \file graphicsContext.h */
-#pragma once
-
-namespace Engine
-{
-	class GraphicsContext
-	{
-		/*! \class GraphicsContext
-		* /brief This class is the base class for graphics contexts.
-		*/
-	public:
-		virtual void init() = 0; //!< Init the current window API's graphics context
-		virtual void swapBuffers() = 0; //!< Swap the front and back buffers
-	};
+/*! \file graphicsContext.h */
+#pragma once
+
+namespace Engine
+{
+	class GraphicsContext
+	{
+		/*! \class GraphicsContext
+		* /brief This class is the base class for graphics contexts.
+		*/
+	public:
+		virtual void init() = 0; //!< Init the current window API's graphics context
+		virtual void swapBuffers() = 0; //!< Swap the front and back buffers
+		virtual void makeCurrent() = 0; //!< Make the context current on the calling thread
+		virtual void releaseCurrent() = 0; //!< Detach the context from the calling thread, so another thread can make it current
+	};
 }
\ No newline at end of file
@@ -0,0 +1,40 @@
+/*! \file hash.h
+* \brief Stable 64 bit FNV-1a hashing. Gives the same result on every run and every platform, so hashes can be written to disk
+*/
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+namespace Engine
+{
+	namespace Hash
+	{
+		constexpr uint64_t fnvOffset = 14695981039346656037ull; //!< FNV-1a 64 bit offset basis
+		constexpr uint64_t fnvPrime = 1099511628211ull; //!< FNV-1a 64 bit prime
+
+		constexpr uint64_t fnv1a(const char* data, size_t size, uint64_t hash = fnvOffset) //!< Hash some bytes, pass a previous hash in to continue it
+		{
+			for (size_t i = 0; i < size; i++)
+			{
+				hash ^= static_cast<uint8_t>(data[i]);
+				hash *= fnvPrime;
+			}
+			return hash;
+		}
+
+		constexpr uint64_t fnv1a(const char* string) //!< Hash a null terminated string, usable at compile time for string literals
+		{
+			uint64_t hash = fnvOffset;
+			for (; *string; string++)
+			{
+				hash ^= static_cast<uint8_t>(*string);
+				hash *= fnvPrime;
+			}
+			return hash;
+		}
+
+		inline uint64_t fnv1a(const std::string& data, uint64_t hash = fnvOffset) { return fnv1a(data.data(), data.size(), hash); } //!< Hash a string, pass a previous hash in to continue it
+	}
+}
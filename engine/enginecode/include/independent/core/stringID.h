@@ -0,0 +1,54 @@
+/*! \file stringID.h
+* \brief Strings reduced to their hash, so names can be compared and looked up as integers
+*/
+#pragma once
+
+#include "core/hash.h"
+#include <string_view>
+#include <unordered_map>
+#include <mutex>
+#include <functional>
+
+namespace Engine
+{
+	/*! \class StringID
+	* \brief A 64 bit FNV-1a hash of a string. Two IDs are equal when their strings are equal, wherever the strings live.
+	* Literals convert implicitly and hash at compile time in constant expressions, or use the _sid suffix.
+	* Strings built at runtime should go through intern, which also remembers the text so getString can turn an ID back into its string.
+	*/
+	class StringID
+	{
+	public:
+		constexpr StringID() = default; //!< Default constructor, the empty ID
+		constexpr StringID(const char* string) : m_hash(Hash::fnv1a(string)) {} //!< Constructor from a null terminated string, doesn't go in the intern table
+		constexpr explicit StringID(uint64_t hash) : m_hash(hash) {} //!< Constructor from an existing hash
+
+		static StringID intern(std::string_view string); //!< Hash a string and remember its text for getString. Logs an error if two strings share a hash
+		const char* getString() const; //!< Getter for the interned text, for logging and debugging. Returns "<unknown>" for IDs that were never interned
+
+		constexpr uint64_t getHash() const { return m_hash; } //!< Getter for the hash
+		constexpr bool isEmpty() const { return m_hash == 0; } //!< Is this the default ID?
+		constexpr bool operator==(StringID other) const { return m_hash == other.m_hash; } //!< Equal if the hashes are equal
+		constexpr bool operator!=(StringID other) const { return m_hash != other.m_hash; } //!< Not equal if the hashes differ
+		constexpr bool operator<(StringID other) const { return m_hash < other.m_hash; } //!< Ordered by hash, so IDs can be sorted or used in ordered containers
+	private:
+		uint64_t m_hash = 0; //!< FNV-1a hash of the string
+
+		static std::unordered_map<uint64_t, std::string> s_strings; //!< Text of every interned string, by hash
+		static std::mutex s_mutex; //!< Guards the intern table, names are interned from worker threads too
+	};
+
+	constexpr StringID operator""_sid(const char* string, size_t size) { return StringID(Hash::fnv1a(string, size)); } //!< "name"_sid, always hashed at compile time
+}
+
+namespace std
+{
+	/*! \struct hash<Engine::StringID>
+	* \brief Lets StringIDs key unordered containers. The ID already is a hash, so it is used as it is
+	*/
+	template<>
+	struct hash<Engine::StringID>
+	{
+		size_t operator()(Engine::StringID id) const noexcept { return static_cast<size_t>(id.getHash()); } //!< Hash function
+	};
+}
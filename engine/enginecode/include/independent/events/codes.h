@@ -1,9 +1,9 @@
-/*! \file codes.h
-*/
-#pragma once
-
-#ifdef NG_PLATFORM_WINDOWS
-#include "platform/GLFW/GLFWCodes.h"
-//#else
-//#include "platform/windows/win32Codes.h"
-#endif
+/*! \file codes.h
+*/
+#pragma once
+
+#ifdef NG_PLATFORM_WINDOWS
+#include "platform/GLFW/GLFWCodes.h"
+//#else
+//#include "platform/windows/win32Codes.h"
+#endif
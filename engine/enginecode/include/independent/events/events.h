@@ -1,7 +1,7 @@
-/*! \file events.h */
-#pragma once
-
-#include "codes.h"
-#include "windowEvent.h"
-#include "keyEvent.h"
+/*! \file events.h */
+#pragma once
+
+#include "codes.h"
+#include "windowEvent.h"
+#include "keyEvent.h"
 #include "mouseEvent.h"
\ No newline at end of file
@@ -0,0 +1,16 @@
+/*! \file NullRenderCommands.h */
+#pragma once
+
+#include "renderCommands.h"
+
+namespace Engine
+{
+	/*! \class NullRenderCommands
+	\brief Null executor for render commands, counts them without doing anything
+	*/
+	class NullRenderCommands
+	{
+	public:
+		static void execute(const RenderCommand& command); //!< Count a command, and the triangles if it is a draw
+	};
+}
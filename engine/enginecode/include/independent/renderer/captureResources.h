@@ -0,0 +1,300 @@
+/*! \file captureResources.h
+* \brief Stand ins for the API objects while a frame capture is set up. Each one forwards every call to the object it wraps,
+* writes the calls that change it into the capture, and keeps a copy of whatever it needs to make itself again
+*/
+#pragma once
+
+#include "renderer/frameCapture.h"
+#include "rendering/vertexBuffer.h"
+#include "rendering/indexBuffer.h"
+#include "rendering/vertexArray.h"
+#include "rendering/texture.h"
+#include "rendering/shader.h"
+#include "rendering/uniformBuffer.h"
+#include "rendering/shaderStorageBuffer.h"
+#include "rendering/streamingBuffer.h"
+#include "rendering/frameBuffer.h"
+#include <memory>
+#include <vector>
+#include <unordered_map>
+
+namespace Engine
+{
+	/*! \class CaptureVertexBuffer
+	* \brief Vertex buffer which keeps its vertices
+	*/
+	class CaptureVertexBuffer : public VertexBuffer, public CaptureResource
+	{
+	public:
+		CaptureVertexBuffer(VertexBuffer* vertexBuffer, const void* vertices, uint32_t size, const VertexBufferLayout& layout); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureVertexBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() override { return m_vertexBuffer->getRenderID(); } //!< Getter for the rendering ID.
+		virtual inline const VertexBufferLayout& getLayout() const override { return m_vertexBuffer->getLayout(); } //!< Getter for the layout
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation
+		virtual inline uint32_t getCapturedRenderID() override { return m_vertexBuffer->getRenderID(); } //!< Getter for the render ID commands use
+	private:
+		std::unique_ptr<VertexBuffer> m_vertexBuffer; //!< Buffer being captured
+		std::vector<uint8_t> m_vertices; //!< Copy of the vertices
+	};
+
+	/*! \class CaptureIndexBuffer
+	* \brief Index buffer which keeps its indices
+	*/
+	class CaptureIndexBuffer : public IndexBuffer, public CaptureResource
+	{
+	public:
+		CaptureIndexBuffer(IndexBuffer* indexBuffer, const uint32_t* indices, uint32_t count); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureIndexBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() const override { return m_indexBuffer->getRenderID(); } //!< Getter for the rendering ID.
+		virtual inline uint32_t getDrawCount() const override { return m_indexBuffer->getDrawCount(); } //!< Getter for the draw count
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation
+		virtual inline uint32_t getCapturedRenderID() override { return m_indexBuffer->getRenderID(); } //!< Getter for the render ID commands use
+	private:
+		std::unique_ptr<IndexBuffer> m_indexBuffer; //!< Buffer being captured
+		std::vector<uint32_t> m_indices; //!< Copy of the indices
+	};
+
+	/*! \class CaptureVertexArray
+	* \brief Vertex array which remembers what is attached to it
+	*/
+	class CaptureVertexArray : public VertexArray, public CaptureResource
+	{
+	public:
+		CaptureVertexArray(VertexArray* vertexArray); //!< Constructor, takes ownership of the array
+		virtual ~CaptureVertexArray() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual void addVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override; //!< Adds a vertex buffer to the array
+		virtual void setIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override; //!< Sets the index buffer
+		virtual void setStreamingVertexBuffer(const std::shared_ptr<StreamingBuffer>& streamingBuffer, const VertexBufferLayout& layout) override; //!< Read vertices out of a streaming buffer
+		virtual inline uint32_t getRenderID() const override { return m_vertexArray->getRenderID(); } //!< Getter for the rendering ID.
+		virtual inline uint32_t getDrawCount() const override { return m_vertexArray->getDrawCount(); } //!< Getter for the draw count
+		virtual inline std::shared_ptr<IndexBuffer> getIndexBuffer() override { return m_vertexArray->getIndexBuffer(); } //!< Getter for the index buffer
+		virtual inline std::shared_ptr<VertexBuffer> getVertexBuffer(uint32_t index) override { return m_vertexArray->getVertexBuffer(index); } //!< Getter for the vertex buffer
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the array's creation
+		virtual void writeState(CaptureWriter& writer) override; //!< Write its attachments
+		virtual inline uint32_t getCapturedRenderID() override { return m_vertexArray->getRenderID(); } //!< Getter for the render ID commands use
+	private:
+		std::unique_ptr<VertexArray> m_vertexArray; //!< Array being captured
+		std::vector<uint32_t> m_vertexBuffers; //!< Capture IDs of the vertex buffers added
+		uint32_t m_indexBuffer = 0; //!< Capture ID of the index buffer, 0 for none
+		uint32_t m_streamingBuffer = 0; //!< Capture ID of the streaming buffer vertices come from, 0 for none
+		VertexBufferLayout m_streamingLayout; //!< Layout of the streamed vertices
+	};
+
+	/*! \class CaptureTexture
+	* \brief Texture which keeps its pixels, or its path and the edits made since it was loaded
+	*/
+	class CaptureTexture : public Texture, public CaptureResource
+	{
+	public:
+		CaptureTexture(Texture* texture, const char* filepath); //!< Constructor for a texture loaded from a file, takes ownership of it
+		CaptureTexture(Texture* texture, uint32_t width, uint32_t height, uint32_t channels, const unsigned char* data); //!< Constructor for a texture made from data, takes ownership of it
+		virtual ~CaptureTexture() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() const override { return m_texture->getRenderID(); } //!< Getter for the rendering ID.
+		virtual inline uint32_t getWidth() override { return m_texture->getWidth(); } //!< Getter for the width.
+		virtual inline uint32_t getHeight() override { return m_texture->getHeight(); } //!< Getter for the height.
+		virtual inline float getWidthf() override { return m_texture->getWidthf(); } //!< Getter for the width as a float
+		virtual inline float getHeightf() override { return m_texture->getHeightf(); } //!< Getter for the height as a float
+		virtual inline uint32_t getChannels() override { return m_texture->getChannels(); } //!< Getter for the channels
+		virtual inline bool isReady() const override { return m_texture->isReady(); } //!< Has the texture finished loading?
+		virtual inline bool hasFailed() const override { return m_texture->hasFailed(); } //!< Did the texture fail to load?
+		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) override; //!< Edit part of the texture
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the texture's creation
+		virtual void writeState(CaptureWriter& writer) override; //!< Write the edits made to a loaded texture
+		virtual inline uint32_t getCapturedRenderID() override { return m_texture->getRenderID(); } //!< Getter for the render ID commands use
+	private:
+		/*! \struct Edit
+		* \brief An edit made to a texture loaded from a file, whose pixels aren't kept
+		*/
+		struct Edit
+		{
+			uint32_t x, y, width, height; //!< Area edited
+			std::vector<uint8_t> pixels; //!< Pixels written
+		};
+
+		std::unique_ptr<Texture> m_texture; //!< Texture being captured
+		std::string m_filepath; //!< File the texture was loaded from, empty if it was made from data
+		uint32_t m_width; //!< Width in pixels when made
+		uint32_t m_height; //!< Height in pixels when made
+		uint32_t m_channels; //!< Channels when made
+		std::vector<uint8_t> m_pixels; //!< Copy of the pixels, kept up to date by edits. Only for textures made from data
+		std::vector<Edit> m_edits; //!< Edits made to a texture loaded from a file
+	};
+
+	/*! \class CaptureShader
+	* \brief Shader which remembers its source files, the last value of every uniform set on it, and the permutations taken from it
+	*/
+	class CaptureShader : public Shader, public CaptureResource
+	{
+	public:
+		CaptureShader(Shader* shader, const char* vertexFile, const char* fragmentFile); //!< Constructor for a shader made from two files, takes ownership of it
+		CaptureShader(Shader* shader, const char* filepath, ShaderCompileMode mode); //!< Constructor for a shader made from one file, takes ownership of it
+		CaptureShader(const std::shared_ptr<Shader>& variant, CaptureShader* base, uint32_t features); //!< Constructor for a permutation of base
+
+		virtual ~CaptureShader() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() const override { return m_shader->getRenderID(); } //!< Getter for the rendering ID.
+		virtual inline bool isReady() const override { return m_shader->isReady(); } //!< Has the shader finished compiling?
+		virtual inline bool hasFailed() const override { return m_shader->hasFailed(); } //!< Did the shader fail to compile?
+		virtual std::shared_ptr<Shader> getVariant(uint32_t features) override; //!< Getter for a permutation, wrapped so it is captured too
+		virtual inline uint32_t getFeatures() const override { return m_shader->getFeatures(); } //!< Getter for the features compiled in
+		virtual UniformHandle getUniformHandle(StringID name) const override; //!< Getter for a uniform's handle, remembering its name so uploads can be written by name
+		virtual int32_t getUniformBlockIndex(StringID blockName) const override; //!< Getter for a block's index, remembering its name
+		virtual void bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint) override; //!< Point a block at a binding point
+
+		void uploadInt(UniformHandle handle, int value) override;					//!< Upload an int through a handle
+		void uploadFloat(UniformHandle handle, float value) override;				//!< Upload a float through a handle
+		void uploadFloat2(UniformHandle handle, const glm::vec2& value) override;	//!< Upload a vec2 through a handle
+		void uploadFloat3(UniformHandle handle, const glm::vec3& value) override;	//!< Upload a vec3 through a handle
+		void uploadFloat4(UniformHandle handle, const glm::vec4& value) override;	//!< Upload a vec4 through a handle
+		void uploadMat4(UniformHandle handle, const glm::mat4& value) override;		//!< Upload a mat4 through a handle
+
+		void uploadInt(const char* name, int value) override;					//!< Upload an int by name
+		void uploadFloat(const char* name, float value) override;				//!< Upload a float by name
+		void uploadFloat2(const char* name, const glm::vec2& value) override;	//!< Upload a vec2 by name
+		void uploadFloat3(const char* name, const glm::vec3& value) override;	//!< Upload a vec3 by name
+		void uploadFloat4(const char* name, const glm::vec4& value) override;	//!< Upload a vec4 by name
+		void uploadMat4(const char* name, const glm::mat4& value) override;		//!< Upload a mat4 by name
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the shader's creation
+		virtual void writeState(CaptureWriter& writer) override; //!< Write its uniform values and block bindings
+		virtual inline uint32_t getCapturedRenderID() override { return m_shader->getRenderID(); } //!< Getter for the render ID commands use
+	private:
+		/*! \struct UniformValue
+		* \brief Last value uploaded to a uniform
+		*/
+		struct UniformValue
+		{
+			ShaderDataType type; //!< Type uploaded
+			uint8_t bytes[64]; //!< Value, big enough for a mat4
+		};
+
+		void record(StringID name, ShaderDataType type, const void* value); //!< Remember a uniform's value and write the upload
+		StringID getName(UniformHandle handle) const; //!< Getter for the name a handle was resolved from
+
+		std::shared_ptr<Shader> m_shader; //!< Shader being captured, shared as permutations are owned by their base shader
+		CaptureShader* m_base = nullptr; //!< Shader this is a permutation of, nullptr for a base shader
+		uint32_t m_features = 0; //!< Features asked for, for a permutation
+		std::vector<std::string> m_files; //!< Source files
+		ShaderCompileMode m_mode = ShaderCompileMode::Blocking; //!< How the shader was compiled, for a shader made from one file
+		std::unordered_map<Shader*, std::shared_ptr<CaptureShader>> m_variants; //!< Wrapped permutations by the permutation they wrap
+		mutable std::unordered_map<int32_t, StringID> m_uniformNames; //!< Uniform name by handle slot
+		mutable std::unordered_map<int32_t, StringID> m_blockNames; //!< Block name by block index
+		std::unordered_map<StringID, UniformValue> m_uniforms; //!< Last value of each uniform
+		std::unordered_map<StringID, uint32_t> m_blockBindings; //!< Binding point each block was pointed at
+	};
+
+	/*! \class CaptureUniformBuffer
+	* \brief Uniform buffer which keeps its block and the shaders it is attached to
+	*/
+	class CaptureUniformBuffer : public UniformBuffer, public CaptureResource
+	{
+	public:
+		CaptureUniformBuffer(UniformBuffer* uniformBuffer, const UniformBufferLayout& layout); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureUniformBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() override { return m_uniformBuffer->getRenderID(); } //!< Getter for the render ID
+		virtual inline UniformBufferLayout getLayout() override { return m_uniformBuffer->getLayout(); } //!< Getter for the layout
+		virtual void attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName) override; //!< Attaches the shader block
+		virtual UniformFieldHandle getFieldHandle(StringID uniformName) const override { return m_uniformBuffer->getFieldHandle(uniformName); } //!< Getter for a field's handle
+		virtual void uploadShaderData(UniformFieldHandle field, const void * data) override; //!< Stage a field's data
+		virtual void uploadShaderData(StringID uniformName, const void * data) override; //!< Stage a field's data by name
+		virtual void flush() override; //!< Send the staged changes
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation
+		virtual void writeState(CaptureWriter& writer) override; //!< Write its fields and attachments
+		virtual inline uint32_t getCapturedRenderID() override { return m_uniformBuffer->getRenderID(); } //!< Getter for the render ID
+	private:
+		/*! \struct Attachment
+		* \brief A shader block the buffer was attached to
+		*/
+		struct Attachment
+		{
+			uint32_t shader; //!< Capture ID of the shader
+			StringID block; //!< Name of the block
+		};
+
+		void syncDirty(); //!< Mirror the wrapped buffer's dirty flag, as isDirty reads this object
+
+		std::unique_ptr<UniformBuffer> m_uniformBuffer; //!< Buffer being captured
+		std::vector<Attachment> m_attachments; //!< Shader blocks attached
+	};
+
+	/*! \class CaptureShaderStorageBuffer
+	* \brief Shader storage buffer which keeps its contents and binding
+	*/
+	class CaptureShaderStorageBuffer : public ShaderStorageBuffer, public CaptureResource
+	{
+	public:
+		CaptureShaderStorageBuffer(ShaderStorageBuffer* storageBuffer, uint32_t size); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureShaderStorageBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() override { return m_storageBuffer->getRenderID(); } //!< Getter for the render ID
+		virtual inline uint32_t getSize() override { return m_storageBuffer->getSize(); } //!< Getter for the size in bytes
+		virtual void uploadData(const void * data, uint32_t size) override; //!< Replace the start of the buffer
+		virtual void bind(uint32_t bindingPoint) override; //!< Bind the buffer to a binding point
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation
+		virtual void writeState(CaptureWriter& writer) override; //!< Write its contents and binding
+		virtual inline uint32_t getCapturedRenderID() override { return m_storageBuffer->getRenderID(); } //!< Getter for the render ID
+	private:
+		std::unique_ptr<ShaderStorageBuffer> m_storageBuffer; //!< Buffer being captured
+		uint32_t m_size; //!< Size when made
+		std::vector<uint8_t> m_data; //!< Copy of the contents uploaded
+		int64_t m_bindingPoint = -1; //!< Where it was last bound, -1 for nowhere
+	};
+
+	/*! \class CaptureStreamingBuffer
+	* \brief Streaming buffer which writes what each frame commits into it. Nothing is kept between frames, the data only lives a frame
+	*/
+	class CaptureStreamingBuffer : public StreamingBuffer, public CaptureResource
+	{
+	public:
+		CaptureStreamingBuffer(StreamingBuffer* streamingBuffer, uint32_t regionSize, uint32_t regionCount); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureStreamingBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() override { return m_streamingBuffer->getRenderID(); } //!< Getter for the render ID
+		virtual inline uint32_t getRegionSize() override { return m_streamingBuffer->getRegionSize(); } //!< Getter for the region size
+		virtual void beginFrame() override; //!< Move on to the next region
+		virtual void* reserve(uint32_t size, uint32_t alignment, uint32_t& offset) override; //!< Get somewhere to write
+		virtual void commit(uint32_t size) override; //!< Keep the start of the last reservation, which is when its bytes are written to the capture
+		virtual void bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size) override; //!< Bind part of the buffer
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation
+		virtual inline uint32_t getCapturedRenderID() override { return m_streamingBuffer->getRenderID(); } //!< Getter for the render ID
+	private:
+		std::unique_ptr<StreamingBuffer> m_streamingBuffer; //!< Buffer being captured
+		uint32_t m_regionCount; //!< Regions it was made with
+		const uint8_t* m_reserved = nullptr; //!< Last reservation
+		uint32_t m_reservedOffset = 0; //!< Where the last reservation is in the buffer
+		uint32_t m_reservedSize = 0; //!< Size of the last reservation
+		uint32_t m_reservedAlignment = 0; //!< Alignment asked for by the last reservation
+	};
+
+	/*! \class CaptureFrameBuffer
+	* \brief Frame buffer which remembers its attachments
+	*/
+	class CaptureFrameBuffer : public FrameBuffer, public CaptureResource
+	{
+	public:
+		CaptureFrameBuffer(FrameBuffer* frameBuffer, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment); //!< Constructor, takes ownership of the buffer
+		virtual ~CaptureFrameBuffer() { FrameCapture::removeResource(this); } //!< Destructor, unregisters it first
+		virtual inline uint32_t getRenderID() const override { return m_frameBuffer->getRenderID(); } //!< Getter for the render ID
+		virtual inline uint32_t getWidth() const override { return m_frameBuffer->getWidth(); } //!< Getter for the width
+		virtual inline uint32_t getHeight() const override { return m_frameBuffer->getHeight(); } //!< Getter for the height
+		virtual uint32_t getColourAttachmentID(uint32_t index) const override { return m_frameBuffer->getColourAttachmentID(index); } //!< Getter for a colour attachment's render ID
+		virtual uint32_t getDepthAttachmentID() const override { return m_frameBuffer->getDepthAttachmentID(); } //!< Getter for the depth attachment's render ID
+		virtual void bind() override; //!< Render into this frame buffer
+		virtual void unbind() override; //!< Go back to the default frame buffer
+		virtual void resize(uint32_t width, uint32_t height) override; //!< Recreate the attachments at a new size
+		virtual void bindColourAttachment(uint32_t index, uint32_t slot) override; //!< Bind a colour attachment to a texture slot
+		virtual void bindDepthAttachment(uint32_t slot) override; //!< Bind the depth attachment to a texture slot
+		virtual void copyDepthToDefault() override; //!< Copy the depth attachment into the default frame buffer
+
+		virtual void writeCreate(CaptureWriter& writer) override; //!< Write the buffer's creation, at its current size
+		virtual inline uint32_t getCapturedRenderID() override { return m_frameBuffer->getRenderID(); } //!< Getter for the render ID
+	private:
+		std::unique_ptr<FrameBuffer> m_frameBuffer; //!< Buffer being captured
+		std::vector<AttachmentFormat> m_colourAttachments; //!< Colour attachment formats
+		AttachmentFormat m_depthAttachment; //!< Depth attachment format
+	};
+}
@@ -0,0 +1,122 @@
+/*! \file clusteredLighting.h
+* \brief Clustered forward lighting. The view frustum is cut into a grid of froxels and each froxel stores the lights touching it,
+* so a fragment only has to walk the lights in its own cluster.
+*/
+#pragma once
+
+#include "renderer/rendererCommon.h"
+#include "rendering/streamingBuffer.h"
+#include "camera/camera.h"
+#include <vector>
+
+namespace Engine
+{
+	/*! \struct PointLight
+	* \brief A dynamic point light. Matches the PointLight struct of the std430 light buffer in the shaders.
+	*/
+	struct PointLight
+	{
+		glm::vec3 position = glm::vec3(0.f); //!< World space position
+		float radius = 1.f; //!< Distance at which the light stops contributing
+		glm::vec3 colour = glm::vec3(1.f); //!< Colour of the light
+		float intensity = 1.f; //!< Brightness multiplier
+	};
+
+	/*! \struct LightGridCell
+	* \brief Where a cluster's lights start in the light index list, and how many there are
+	*/
+	struct LightGridCell
+	{
+		uint32_t offset; //!< First entry in the light index list
+		uint32_t count; //!< Number of lights in the cluster
+	};
+
+	/*! \class LightClusterGrid
+	* \brief CPU side of clustered lighting. Builds view space bounds for every froxel from a projection, then assigns lights to them.
+	* Clusters are indexed x + y * tilesX + z * tilesX * tilesY, x and y are screen tiles from the bottom left and z are exponential depth slices.
+	*/
+	class LightClusterGrid
+	{
+	public:
+		LightClusterGrid(uint32_t tilesX = 16, uint32_t tilesY = 9, uint32_t slicesZ = 24); //!< Constructor, takes the number of clusters on each axis
+
+		void build(const glm::mat4& projection); //!< Rebuild the cluster bounds. Does nothing if the projection hasn't changed
+		void assign(const std::vector<PointLight>& lights, const glm::mat4& view); //!< Assign the lights to clusters, one depth slice per job on the thread pool
+		uint32_t getClusterIndex(const glm::vec3& viewPos) const; //!< Index of the cluster containing a view space position, mirrors the lookup done in the shaders
+
+		inline uint32_t getTilesX() const { return m_tilesX; } //!< Getter for the number of tiles across
+		inline uint32_t getTilesY() const { return m_tilesY; } //!< Getter for the number of tiles down
+		inline uint32_t getSlicesZ() const { return m_slicesZ; } //!< Getter for the number of depth slices
+		inline uint32_t getClusterCount() const { return m_tilesX * m_tilesY * m_slicesZ; } //!< Getter for the total number of clusters
+		inline float getNear() const { return m_near; } //!< Getter for the near plane the grid was built with
+		inline float getFar() const { return m_far; } //!< Getter for the far plane the grid was built with
+		inline const std::vector<LightGridCell>& getGrid() const { return m_grid; } //!< Getter for the per cluster offsets and counts
+		inline const std::vector<uint32_t>& getLightIndices() const { return m_lightIndices; } //!< Getter for the light index list
+	private:
+		void assignSlice(uint32_t slice); //!< Assign the view space lights to the clusters of one depth slice
+
+		uint32_t m_tilesX; //!< Number of tiles across the screen
+		uint32_t m_tilesY; //!< Number of tiles down the screen
+		uint32_t m_slicesZ; //!< Number of depth slices
+		uint32_t m_sliceStride; //!< Clusters per slice, padded to a multiple of 4 so a slice can be tested 4 clusters at a time
+		float m_near = 0.f; //!< Near plane
+		float m_far = 0.f; //!< Far plane
+		glm::mat4 m_projection = glm::mat4(0.f); //!< Projection the bounds were built from
+
+		std::vector<float> m_sliceDepths; //!< View depth of each slice boundary, m_slicesZ + 1 entries
+		std::vector<float> m_minX, m_maxX, m_minY, m_maxY; //!< View space x and y bounds of every cluster, stored as structure of arrays for SIMD
+
+		std::vector<glm::vec4> m_viewLights; //!< Lights this frame in view space, xyz position and w radius
+		std::vector<std::vector<uint32_t>> m_sliceIndices; //!< Light indices written by each slice's job
+		std::vector<LightGridCell> m_grid; //!< Offset and count for every cluster
+		std::vector<uint32_t> m_lightIndices; //!< Every slice's light indices, back to back
+	};
+
+	/*! \class ClusteredLighting
+	* \brief Owns the scene's point lights and the GPU buffers the clustered shaders read.
+	* The uniform buffer holds the b_light block. The light data is written into a streaming buffer every frame and its ranges are bound to the binding points below.
+	*/
+	class ClusteredLighting
+	{
+	public:
+		ClusteredLighting(uint32_t viewportWidth, uint32_t viewportHeight); //!< Constructor, takes the size of the viewport being lit
+
+		void update(const Camera& camera); //!< Assign this frame's lights to clusters and upload everything the shaders need
+		void setViewport(uint32_t width, uint32_t height); //!< Setter for the viewport size, call on resize
+		inline void setAmbient(const glm::vec3& ambient) { m_ambient = ambient; } //!< Setter for the ambient colour
+
+		inline std::vector<PointLight>& getLights() { return m_lights; } //!< Getter for the lights, edit them freely between updates
+		inline const LightClusterGrid& getClusterGrid() const { return m_clusterGrid; } //!< Getter for the cluster grid
+		inline std::shared_ptr<UniformBuffer> getUniformBuffer() { return m_lightUBO; } //!< Getter for the b_light uniform buffer, to go in the scene wide uniforms
+		void bind(); //!< Bind this frame's light, grid and index ranges to their binding points again, for passes which use the same binding points for something else
+
+		constexpr static uint32_t lightBufferBinding = 0; //!< Binding point of b_pointLights
+		constexpr static uint32_t gridBufferBinding = 1; //!< Binding point of b_lightGrid
+		constexpr static uint32_t indexBufferBinding = 2; //!< Binding point of b_lightIndices
+	private:
+		/*! \struct StreamRange
+		* \brief Where one of this frame's arrays was written in the streaming buffer
+		*/
+		struct StreamRange
+		{
+			uint32_t offset = 0; //!< Offset in bytes
+			uint32_t size = 0; //!< Size in bytes
+		};
+
+		void writeRange(StreamRange& range, const void* data); //!< Copy range.size bytes into the streaming buffer and record where they went
+
+		constexpr static uint32_t streamSlack = 3 * 256; //!< Room for aligning each of the three ranges
+
+		LightClusterGrid m_clusterGrid; //!< CPU cluster grid
+		std::vector<PointLight> m_lights; //!< The scene's lights
+		glm::vec2 m_viewport; //!< Viewport size in pixels
+		glm::vec3 m_ambient = glm::vec3(0.1f); //!< Ambient colour
+
+		std::shared_ptr<UniformBuffer> m_lightUBO; //!< b_light block
+		UniformFieldHandle m_viewPosField, m_ambientField, m_clusterDimsField, m_clusterParamsField, m_inverseViewProjectionField; //!< Handles of the b_light fields
+		std::shared_ptr<StreamingBuffer> m_stream; //!< Per frame light data
+		StreamRange m_lightRange; //!< Every light
+		StreamRange m_gridRange; //!< Offset and count per cluster
+		StreamRange m_indexRange; //!< Light index list
+	};
+}
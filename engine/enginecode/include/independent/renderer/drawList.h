@@ -0,0 +1,64 @@
+/*! \file drawList.h
+* \brief Draws recorded as data, so they can be built on worker threads and submitted to the GPU from the main thread
+*/
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <memory>
+#include <future>
+#include <functional>
+
+namespace Engine
+{
+	class VertexArray;
+	class Material;
+
+	/*! \struct DrawCommand
+	* \brief One recorded draw. The geometry and material are borrowed, they have to outlive the frame
+	*/
+	struct DrawCommand
+	{
+		uint64_t sortKey; //!< Draws are submitted in key order, so draws sharing state end up next to each other
+		VertexArray* geometry; //!< Geometry to draw
+		Material* material; //!< Material to draw it with
+		glm::mat4 model; //!< Model transform
+	};
+
+	/*! \class DrawList
+	* \brief A list of draws recorded by one thread. reset keeps the memory, so a list reused every frame stops allocating
+	*/
+	class DrawList
+	{
+	public:
+		DrawList(uint32_t capacity = 256) { m_commands.reserve(capacity); } //!< Constructor, takes the number of draws to make room for up front
+
+		void record(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4& model); //!< Add a draw, working out its sort key. Safe on any thread as long as the material isn't being changed
+		void append(const DrawList& other); //!< Add another list's draws to the end of this one
+		void sort(); //!< Put the shader each draw is bound with into its key, then order the draws by key. Draws with the same key keep the order they were recorded in. On the thread that owns the GL context
+		inline void reset() { m_commands.clear(); } //!< Forget the draws but keep the memory
+		inline uint32_t size() const { return static_cast<uint32_t>(m_commands.size()); } //!< Getter for the number of draws
+		inline const DrawCommand& operator[](uint32_t index) const { return m_commands[index]; } //!< Getter for a recorded draw
+		inline std::vector<DrawCommand>::const_iterator begin() const { return m_commands.begin(); } //!< Start of the draws
+		inline std::vector<DrawCommand>::const_iterator end() const { return m_commands.end(); } //!< End of the draws
+
+		static uint64_t makeSortKey(VertexArray& geometry, Material& material); //!< Texture then geometry, below the top bits sort puts the shader in
+	private:
+		std::vector<DrawCommand> m_commands; //!< Recorded draws
+	};
+
+	/*! \class ParallelDrawRecorder
+	* \brief Splits building a frame's draws across the thread pool, one draw list per chunk of work, then merges the lists in key order.
+	* Only recording happens on the workers, the merged list is submitted on the thread that owns the GL context
+	*/
+	class ParallelDrawRecorder
+	{
+	public:
+		void record(uint32_t count, const std::function<void(DrawList& list, uint32_t begin, uint32_t end)>& job); //!< Run job over [0, count) in chunks, each chunk recording into its own list. Blocks until every chunk is done. On a pool worker every chunk runs inline
+		const DrawList& merge(); //!< Put every chunk's draws into one list, sorted by key. Valid until the next record or merge. On the thread that owns the GL context, after Renderer3D::begin
+	private:
+		std::vector<DrawList> m_lists; //!< One list per chunk, kept between frames
+		std::vector<std::future<void>> m_pending; //!< Chunks running on the workers
+		DrawList m_merged; //!< Every chunk's draws in key order
+	};
+}
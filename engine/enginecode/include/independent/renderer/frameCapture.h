@@ -0,0 +1,263 @@
+/*! \file frameCapture.h
+* \brief Records what the renderers ask of the render API over a window of frames, so a slow frame can be replayed and measured later
+*/
+#pragma once
+
+#include "systems/system.h"
+#include "renderer/renderCommands.h"
+#include "rendering/bufferLayout.h"
+#include "rendering/frameBuffer.h"
+#include "rendering/shader.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+
+namespace Engine
+{
+	class VertexBuffer;
+	class IndexBuffer;
+	class VertexArray;
+	class Texture;
+	class UniformBuffer;
+	class ShaderStorageBuffer;
+	class StreamingBuffer;
+
+	/*! \enum CaptureOp
+	* \brief One recorded call. Resources are referred to by the ID the capture gave them, never by render ID
+	*/
+	enum class CaptureOp : uint8_t
+	{
+		CreateVertexBuffer, //!< id, layout, blob
+		CreateIndexBuffer, //!< id, count, blob
+		CreateVertexArray, //!< id
+		CreateShader, //!< id, compile mode, file count, files
+		CreateShaderVariant, //!< id, parent, features
+		CreateTextureFile, //!< id, path
+		CreateTexture, //!< id, width, height, channels, blob
+		CreateUniformBuffer, //!< id, layout
+		CreateShaderStorageBuffer, //!< id, size
+		CreateStreamingBuffer, //!< id, region size, region count
+		CreateFrameBuffer, //!< id, width, height, colour formats, depth format
+		Destroy, //!< id
+		Command, //!< RenderCommand, with its render IDs swapped for capture IDs
+		AddVertexBuffer, //!< vertex array, vertex buffer
+		SetIndexBuffer, //!< vertex array, index buffer
+		SetStreamingVertexBuffer, //!< vertex array, streaming buffer, layout
+		EditTexture, //!< texture, x, y, width, height, blob
+		UploadUniform, //!< shader, name, type, value
+		BindUniformBlock, //!< shader, block name, binding point
+		AttachShaderBlock, //!< uniform buffer, shader, block name
+		UploadUniformBufferField, //!< uniform buffer, field, size, value
+		FlushUniformBuffer, //!< uniform buffer
+		UploadStorage, //!< storage buffer, blob
+		BindStorage, //!< storage buffer, binding point
+		BeginStreamingFrame, //!< streaming buffer
+		WriteStreaming, //!< streaming buffer, offset, reserved size, alignment, blob of the committed bytes
+		BindStreamingRange, //!< streaming buffer, target, binding point, offset, size
+		BindFrameBuffer, //!< frame buffer
+		UnbindFrameBuffer, //!< frame buffer
+		ResizeFrameBuffer, //!< frame buffer, width, height
+		BindColourAttachment, //!< frame buffer, index, slot
+		BindDepthAttachment, //!< frame buffer, slot
+		CopyDepthToDefault //!< frame buffer
+	};
+
+	/*! \enum CaptureResourceKind
+	* \brief Type of a captured resource, render IDs are only unique within a kind
+	*/
+	enum class CaptureResourceKind : uint8_t
+	{
+		VertexBuffer,
+		IndexBuffer,
+		VertexArray,
+		Shader,
+		Texture,
+		UniformBuffer,
+		ShaderStorageBuffer,
+		StreamingBuffer,
+		FrameBuffer
+	};
+
+	/*! \class CaptureWriter
+	* \brief Bytes written back to back with no padding, in the machine's byte order
+	*/
+	class CaptureWriter
+	{
+	public:
+		template<typename T>
+		void write(const T& value) //!< Append a plain value
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be written");
+			append(&value, sizeof(T));
+		}
+		void writeString(const std::string& string); //!< Append a length and the characters
+		void append(const void* data, uint32_t size); //!< Append raw bytes
+
+		inline const std::vector<uint8_t>& getBytes() const { return m_bytes; } //!< Getter for everything written
+		inline uint32_t size() const { return static_cast<uint32_t>(m_bytes.size()); } //!< Getter for the number of bytes written
+		inline void clear() { m_bytes.clear(); } //!< Forget the bytes but keep the memory
+	private:
+		std::vector<uint8_t> m_bytes; //!< Bytes written
+	};
+
+	/*! \class CaptureReader
+	* \brief Reads what a CaptureWriter wrote. Reading past the end sets the error flag and returns zeroes, so a truncated file can't read out of bounds
+	*/
+	class CaptureReader
+	{
+	public:
+		CaptureReader(const uint8_t* data, uint32_t size) : m_data(data), m_size(size) {} //!< Constructor, takes the bytes to read
+
+		template<typename T>
+		T read() //!< Read a plain value
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only plain values can be read");
+			T value;
+			std::memset(&value, 0, sizeof(T));
+			readBytes(&value, sizeof(T));
+			return value;
+		}
+		std::string readString(); //!< Read a length and the characters
+		bool readBytes(void* destination, uint32_t size); //!< Copy bytes out, false if there weren't enough
+		const uint8_t* skip(uint32_t size); //!< Step over bytes, returns where they start or nullptr if there weren't enough
+
+		inline bool isEnd() const { return m_position >= m_size; } //!< Has everything been read?
+		inline bool hasError() const { return m_error; } //!< Was there a read past the end?
+	private:
+		const uint8_t* m_data; //!< Bytes being read
+		uint32_t m_size; //!< Number of bytes
+		uint32_t m_position = 0; //!< Next byte to read
+		bool m_error = false; //!< Set by a read past the end
+	};
+
+	/*! \class CaptureResource
+	* \brief Base of the capture resources, which stand in for an API object while a capture is set up. Each one writes the op which
+	* creates it, and the ops which bring a new object up to its current state, for when a capture starts after it was made
+	*/
+	class CaptureResource
+	{
+	public:
+		CaptureResource(CaptureResourceKind kind) : m_kind(kind) {} //!< Constructor, the resource gets its ID when FrameCapture registers it
+		virtual ~CaptureResource() = default; //!< Destructor. Each resource unregisters itself in its own destructor, before its copies are freed
+
+		virtual void writeCreate(CaptureWriter& writer) = 0; //!< Write the op which creates the resource as it was made
+		virtual void writeState(CaptureWriter& writer) {} //!< Write the ops which bring a new resource up to this one's current state
+		virtual uint32_t getCapturedRenderID() = 0; //!< Getter for the API object's render ID
+
+		inline uint32_t getCaptureID() const { return m_captureID; } //!< Getter for the ID ops refer to the resource by
+		inline CaptureResourceKind getKind() const { return m_kind; } //!< Getter for the kind
+	private:
+		friend class FrameCapture;
+		uint32_t m_captureID = 0; //!< ID ops refer to the resource by, 0 until registered
+		CaptureResourceKind m_kind; //!< What the resource is
+	};
+
+	/*! \class CaptureScope
+	* \brief Counts how deep in captured calls this thread is. API objects call each other, e.g. a uniform buffer binds its block on the shader
+	* it is attached to, and only the outermost call is recorded so a replay doesn't repeat the inner ones
+	*/
+	class CaptureScope
+	{
+	public:
+		CaptureScope() { s_depth++; } //!< Constructor, one call deeper
+		~CaptureScope() { s_depth--; } //!< Destructor
+		inline bool isOutermost() const { return s_depth == 1; } //!< Was this call made by the renderers rather than by another API object?
+	private:
+		static thread_local uint32_t s_depth; //!< Captured calls this thread is inside
+	};
+
+	/*! \class FrameCapture
+	* \brief System which records the render API calls of a window of frames into a file that FrameReplay can run again. Once started,
+	* every API object created is wrapped in a capture resource which keeps enough of its state to recreate it, so it has to be started
+	* before the renderers create anything. The window starts at the next frame boundary after a capture is requested, or at a set frame.
+	* The file holds every resource alive when the window starts, then each frame's calls. Byte payloads are stored once however many times they are
+	* uploaded, so unchanged glyphs and vertex data cost nothing after the first frame. Shaders and file textures are stored by path, so replay from the same folder.
+	*/
+	class FrameCapture : public System
+	{
+	public:
+		virtual void start(SystemSignal init = SystemSignal::None, ...) override; //!< Start tracking resources, takes the file path as a const char*, the frame to capture from as a uint32_t (0 waits for requestCapture) and the number of frames as a uint32_t
+		virtual void stop(SystemSignal close = SystemSignal::None, ...) override; //!< Write a capture which is still running and stop tracking
+
+		inline static bool isEnabled() { return s_enabled; } //!< Are resources being tracked?
+		inline static bool isCapturing() { return s_capturing; } //!< Is a window of frames being recorded?
+		static void requestCapture(); //!< Capture the frames after the next frame boundary
+		static void endFrame(); //!< Frame boundary, call once a frame after the frame's last render call
+
+		inline static void recordCommand(const RenderCommand& command) { if (s_capturing) writeCommand(command); } //!< Record a render command, called by RendererCommon
+
+		template<typename F>
+		static void record(F&& change) //!< Run change with the current frame's writer, or nullptr if no window is being recorded. Capture resources update their copies in here too, so a snapshot never sees one half changed
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			change(s_capturing ? &s_current : nullptr);
+		}
+		static uint32_t addBlob(const void* data, uint32_t size); //!< Store a byte payload once, returns its index. Only call from inside record or writeState
+
+		static void writeLayout(CaptureWriter& writer, const VertexBufferLayout& layout); //!< Write a vertex layout
+		static void writeLayout(CaptureWriter& writer, const UniformBufferLayout& layout); //!< Write a uniform layout
+
+		static VertexBuffer* track(VertexBuffer* vertexBuffer, const void* vertices, uint32_t size, const VertexBufferLayout& layout); //!< Wrap a new vertex buffer if resources are being tracked, otherwise hand it back
+		static IndexBuffer* track(IndexBuffer* indexBuffer, const uint32_t* indices, uint32_t count); //!< Wrap a new index buffer
+		static VertexArray* track(VertexArray* vertexArray); //!< Wrap a new vertex array
+		static Shader* track(Shader* shader, const char* vertexFile, const char* fragmentFile); //!< Wrap a new shader made from two files
+		static Shader* track(Shader* shader, const char* filepath, ShaderCompileMode mode); //!< Wrap a new shader made from one file
+		static Texture* track(Texture* texture, const char* filepath); //!< Wrap a new texture loaded from a file
+		static Texture* track(Texture* texture, uint32_t width, uint32_t height, uint32_t channels, const unsigned char* data); //!< Wrap a new texture made from data
+		static UniformBuffer* track(UniformBuffer* uniformBuffer, const UniformBufferLayout& layout); //!< Wrap a new uniform buffer
+		static ShaderStorageBuffer* track(ShaderStorageBuffer* storageBuffer, uint32_t size); //!< Wrap a new shader storage buffer
+		static StreamingBuffer* track(StreamingBuffer* streamingBuffer, uint32_t regionSize, uint32_t regionCount); //!< Wrap a new streaming buffer
+		static FrameBuffer* track(FrameBuffer* frameBuffer, uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment); //!< Wrap a new frame buffer
+
+		template<typename T>
+		static T* addResource(T* resource) //!< Give a resource its ID and register it, writing its creation if a capture is running. Returns the resource
+		{
+			registerResource(resource);
+			return resource;
+		}
+		static void removeResource(CaptureResource* resource); //!< Unregister a resource, writing its destruction if a capture is running
+
+		constexpr static uint32_t magic = 0x4346474E; //!< "NGFC" at the start of a capture file
+		constexpr static uint32_t version = 1; //!< Format version, bumped whenever the ops change
+	private:
+		/*! \struct CapturedFrame
+		* \brief One frame of a capture
+		*/
+		struct CapturedFrame
+		{
+			float milliseconds; //!< Time from the frame boundary before to the one after, when it was captured
+			std::vector<uint8_t> ops; //!< The frame's calls
+		};
+
+		static void registerResource(CaptureResource* resource); //!< Give a resource its ID and register it
+		static void writeCommand(const RenderCommand& command); //!< Record a command, swapping its render IDs for capture IDs
+		static uint32_t findCaptureID(CaptureResourceKind kind, uint32_t renderID); //!< Capture ID of the live resource with this render ID, 0 if there isn't one
+		static void beginWindow(); //!< Snapshot every live resource and start recording frames
+		static void writeFile(); //!< Write the capture out and go back to waiting
+
+		static bool s_enabled; //!< Are resources being tracked?
+		static std::atomic<bool> s_capturing; //!< Is a window being recorded?
+		static std::atomic<bool> s_requested; //!< Start a window at the next frame boundary?
+		static std::string s_filepath; //!< Where the capture is written
+		static uint32_t s_firstFrame; //!< Frame to start a window at, 0 for none
+		static uint32_t s_frameCount; //!< Frames in a window
+		static uint32_t s_frame; //!< Frame boundaries seen
+		static uint32_t s_nextID; //!< Capture ID of the next resource
+		static std::map<uint32_t, CaptureResource*> s_resources; //!< Live resources, in creation order
+		static std::vector<std::vector<uint8_t>> s_blobs; //!< Byte payloads, each stored once
+		static std::unordered_multimap<uint64_t, uint32_t> s_blobLookup; //!< Payload hash to blob index
+		static CaptureWriter s_setup; //!< Ops which recreate the resources alive when the window started
+		static CaptureWriter s_current; //!< Ops of the frame being recorded
+		static std::vector<CapturedFrame> s_frames; //!< Frames recorded so far
+		static std::chrono::steady_clock::time_point s_frameStart; //!< When the current frame started
+		static std::recursive_mutex s_resourceMutex; //!< Guards the resource table, resources are made and freed on more than one thread
+		static std::mutex s_mutex; //!< Guards the writers and blobs
+	};
+}
@@ -0,0 +1,97 @@
+/*! \file frameReplay.h
+* \brief Runs a frame capture again on whichever render API is chosen, so one frame's cost can be measured on its own
+*/
+#pragma once
+
+#include "renderer/frameCapture.h"
+#include "rendering/vertexBuffer.h"
+#include "rendering/indexBuffer.h"
+#include "rendering/vertexArray.h"
+#include "rendering/texture.h"
+#include "rendering/shader.h"
+#include "rendering/uniformBuffer.h"
+#include "rendering/shaderStorageBuffer.h"
+#include "rendering/streamingBuffer.h"
+#include "rendering/frameBuffer.h"
+#include <memory>
+#include <deque>
+
+namespace Engine
+{
+	/*! \class FrameReplay
+	* \brief Loads a file written by FrameCapture, makes the resources in its snapshot and plays its frames back through the render API.
+	* Commands go through RendererCommon like the renderers' do, so RenderStats and the GPU profiler see a replayed frame as they would a live one.
+	* Nothing but the captured calls is run, no game logic and no renderer, so the same frames can be timed again and again after a change
+	*/
+	class FrameReplay
+	{
+	public:
+		bool load(const char* filepath); //!< Read a capture, false if it couldn't be read
+		bool setup(); //!< Make the resources in the snapshot, false if the snapshot is damaged
+		bool replayFrame(uint32_t frame); //!< Run one frame's calls, false if the frame is damaged
+		void rewind(); //!< Get ready to replay from the first frame again. Redoes the setup if the frames made or freed resources, as they would otherwise carry over
+		void clear(); //!< Free every resource made
+
+		inline uint32_t getFrameCount() const { return static_cast<uint32_t>(m_frames.size()); } //!< Getter for the number of frames captured
+		inline float getCapturedTime(uint32_t frame) const { return m_frames[frame].milliseconds; } //!< Getter for how long a frame took when it was captured, in milliseconds
+		inline uint32_t getSkippedCalls() const { return m_skipped; } //!< Getter for calls skipped as they referred to a resource which couldn't be made
+	private:
+		/*! \struct Frame
+		* \brief A captured frame
+		*/
+		struct Frame
+		{
+			float milliseconds; //!< Time the frame took when captured
+			std::vector<uint8_t> ops; //!< Its calls
+		};
+
+		/*! \struct StreamedRange
+		* \brief Where a write to a streaming buffer landed when captured and where it landed on replay, which can differ between backends
+		*/
+		struct StreamedRange
+		{
+			uint32_t captured; //!< Offset when captured
+			uint32_t replayed; //!< Offset on replay
+			uint32_t size; //!< Bytes reserved
+		};
+
+		/*! \struct StreamedVertices
+		* \brief A vertex array whose vertices come from a streaming buffer, draws from it pick their vertices with a base vertex which needs moving too
+		*/
+		struct StreamedVertices
+		{
+			uint32_t streamingBuffer; //!< Capture ID of the streaming buffer
+			uint32_t stride; //!< Bytes per vertex
+		};
+
+		bool execute(CaptureReader& reader); //!< Run calls until the reader is empty
+		VertexBufferLayout readVertexLayout(CaptureReader& reader); //!< Read a vertex layout
+		UniformBufferLayout readUniformLayout(CaptureReader& reader); //!< Read a uniform layout, keeping the names alive
+		const std::vector<uint8_t>* readBlob(CaptureReader& reader); //!< Read a blob index, nullptr if it is out of range
+		uint32_t remapStreamed(uint32_t streamingBuffer, uint32_t offset); //!< Move a captured streaming buffer offset to where it is on replay
+		template<typename T>
+		T* find(std::unordered_map<uint32_t, std::shared_ptr<T>>& resources, uint32_t id); //!< Look up a resource, counting a skipped call if it is missing
+
+		std::vector<std::vector<uint8_t>> m_blobs; //!< Byte payloads
+		std::vector<uint8_t> m_setup; //!< Snapshot calls
+		std::vector<Frame> m_frames; //!< Frames
+
+		std::unordered_map<uint32_t, std::shared_ptr<VertexBuffer>> m_vertexBuffers; //!< Vertex buffers by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<IndexBuffer>> m_indexBuffers; //!< Index buffers by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<VertexArray>> m_vertexArrays; //!< Vertex arrays by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<Shader>> m_shaders; //!< Shaders by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<Texture>> m_textures; //!< Textures by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<UniformBuffer>> m_uniformBuffers; //!< Uniform buffers by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<ShaderStorageBuffer>> m_storageBuffers; //!< Shader storage buffers by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<StreamingBuffer>> m_streamingBuffers; //!< Streaming buffers by capture ID
+		std::unordered_map<uint32_t, std::shared_ptr<FrameBuffer>> m_frameBuffers; //!< Frame buffers by capture ID
+
+		std::unordered_map<uint32_t, std::unordered_map<uint64_t, UniformHandle>> m_uniformHandles; //!< Uniform handles by shader and name, resolved once
+		std::unordered_map<uint32_t, std::vector<StreamedRange>> m_streamedRanges; //!< This frame's writes to each streaming buffer
+		std::unordered_map<uint32_t, StreamedVertices> m_streamedVertices; //!< Vertex arrays fed by a streaming buffer
+		std::deque<std::string> m_names; //!< Uniform buffer field names, layouts only point at them
+		uint32_t m_boundVertexArray = 0; //!< Capture ID of the vertex array last bound
+		bool m_resourcesChanged = false; //!< Did a frame make or free a resource?
+		uint32_t m_skipped = 0; //!< Calls skipped
+	};
+}
@@ -0,0 +1,72 @@
+/*! \file gpuProfiler.h */
+#pragma once
+
+#include "rendering/timerQuery.h"
+#include "core/stringID.h"
+#include <vector>
+#include <memory>
+
+namespace Engine
+{
+	/*! \struct GPUScopeTiming
+	* \brief GPU time measured for one named scope
+	*/
+	struct GPUScopeTiming
+	{
+		StringID id; //!< Hash of the name, for lookups
+		const char* name; //!< Name of the scope
+		float milliseconds = 0.f; //!< Time of the latest frame with a result
+		float maxMilliseconds = 0.f; //!< Longest time measured
+		double totalMilliseconds = 0.0; //!< Sum of every time measured, for the average
+		uint32_t samples = 0; //!< Frames measured
+
+		inline float getAverage() const { return samples ? static_cast<float>(totalMilliseconds / samples) : 0.f; } //!< Getter for the average time
+	};
+
+	/*! \class GPUProfiler
+	* \brief Times named scopes of a frame on the GPU, such as the renderers' passes, with timer queries taken from a pool.
+	* Results are read back a few frames later, once the GPU has caught up, so measuring never stalls the pipeline.
+	* GL can only run one timer query at once, so scopes don't nest: an inner scope is counted as part of the scope around it.
+	* Only call it from the thread which owns the graphics context
+	*/
+	class GPUProfiler
+	{
+	public:
+		static void beginFrame(); //!< Start a frame, and collect the results of earlier frames the GPU has finished
+		static void endFrame(); //!< End the frame and close any scope left open, its queries are checked from the next beginFrame on
+		static void beginScope(const char* name); //!< Start timing a scope. The name is kept, so it must outlive the profiler, like a string literal
+		static void endScope(); //!< Stop timing the current scope
+
+		static float getTime(StringID name); //!< Getter for a scope's latest time in milliseconds, 0 if it has never been measured
+		inline static float getFrameTime() { return s_frameTime; } //!< Getter for the GPU time of every scope in the latest measured frame, in milliseconds
+		inline static const std::vector<GPUScopeTiming>& getResults() { return s_results; } //!< Getter for every scope measured, in the order they were first seen
+		inline static uint32_t getDroppedFrames() { return s_dropped; } //!< Getter for how many frames were still unfinished when their queries were needed again
+		static void logResults(); //!< Log every scope's latest, average and longest time
+		static void reset(); //!< Forget every result, queries in flight are kept
+		static void shutdown(); //!< Delete every query, results are kept. Call on the context's thread before the context goes, or the queries outlive it
+
+		constexpr static uint32_t framesInFlight = 4; //!< Frames a result has to arrive in before its queries are reused
+	private:
+		/*! \struct PendingScope
+		* \brief A scope whose query the GPU may not have reached yet
+		*/
+		struct PendingScope
+		{
+			const char* name; //!< Name of the scope
+			std::shared_ptr<TimerQuery> query; //!< Query timing it
+		};
+
+		static void collect(std::vector<PendingScope>& frame); //!< Read a finished frame's queries and return them to the pool
+		static void recycle(std::vector<PendingScope>& frame); //!< Return a frame's queries to the pool without reading them
+		static GPUScopeTiming& getTiming(const char* name); //!< Getter for a scope's timing, adding it the first time it is seen
+
+		static std::vector<PendingScope> s_frames[framesInFlight]; //!< Scopes of each frame in flight
+		static std::vector<std::shared_ptr<TimerQuery>> s_pool; //!< Queries free to be used
+		static std::vector<GPUScopeTiming> s_results; //!< Timing of every scope seen
+		static uint64_t s_frame; //!< Number of the frame being recorded
+		static uint32_t s_depth; //!< How many scopes are open, only the outermost is timed
+		static TimerQuery* s_running; //!< Query timing the outermost open scope
+		static float s_frameTime; //!< GPU time of the latest measured frame
+		static uint32_t s_dropped; //!< Frames whose results never arrived in time
+	};
+}
@@ -1,20 +1,110 @@
-/*! \file renderCommands.h */
-#pragma once
-
-#include <functional>
-
-namespace Engine
-{
-	class RenderCommand
-	{
-	public:
-		virtual void action() = 0;
-		
-		static RenderCommand * clearDepthColourCommand(); //!< clearing the depth and the colour buffer. We do this enough to warrant them both having a shared command.
-		static RenderCommand * setClearColourCommand(float r, float g, float b, float a); //!< set the background colour
-		static RenderCommand * setDepthTestCommand(bool enabled); //!< Enable / disable depth testing
-		static RenderCommand * setBackfaceCullingCommand(bool enabled); //!< Enable / disable backface culling
-		static RenderCommand * setBlendCommand(bool enabled); //!< Enable / disable blending
-
-	};
-}
+/*! \file renderCommands.h */
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+	/*! \enum RenderCommandType
+	* \brief What a render command does
+	*/
+	enum class RenderCommandType : uint32_t
+	{
+		ClearDepthColour, //!< Clear the depth and colour buffers
+		ClearDepth, //!< Clear the depth buffer
+		SetClearColour, //!< Set the background colour
+		SetDepthTest, //!< Enable / disable depth testing
+		SetBackfaceCulling, //!< Enable / disable backface culling
+		SetBlend, //!< Enable / disable blending
+		SetBlendMode, //!< How blended fragments are combined
+		SetDepthWrite, //!< Enable / disable depth writes
+		SetDepthFunc, //!< Depth comparison
+		SetCullFace, //!< Which faces culling removes
+		SetViewport, //!< Area of the target drawn to
+		UseShader, //!< Bind a shader program
+		BindTexture, //!< Bind a texture to a unit
+		BindVertexArray, //!< Bind a vertex array and its index buffer
+		DrawIndexed, //!< Indexed triangles, optionally instanced and from a base vertex
+		DrawArrays, //!< Non-indexed triangles
+		SetDepthClamp //!< Enable / disable depth clamping. After the draws, so the numbers in older captures still match
+	};
+
+	enum class BlendMode : uint32_t { Alpha, Additive }; //!< Source over by alpha, or source added on top
+	enum class DepthFunc : uint32_t { Less, GreaterEqual }; //!< Depth comparisons the renderers use
+	enum class CullFace : uint32_t { Back, Front }; //!< Faces removed by culling
+
+	/*! \struct RenderCommand
+	* \brief A render state change, bind or draw as plain data. Commands are built by value, so recording or running one never allocates,
+	* and they can be copied into a command buffer and replayed later by the backend's executor
+	*/
+	struct RenderCommand
+	{
+		RenderCommandType type; //!< What the command does
+		union
+		{
+			bool enabled; //!< Set commands, turn the state on or off
+			float colour[4]; //!< SetClearColour, RGBA
+			BlendMode blendMode; //!< SetBlendMode
+			DepthFunc depthFunc; //!< SetDepthFunc
+			CullFace cullFace; //!< SetCullFace
+			struct { uint32_t x, y, width, height; } viewport; //!< SetViewport
+			struct { uint32_t renderID; } shader; //!< UseShader
+			struct { uint32_t unit, renderID; } texture; //!< BindTexture
+			struct { uint32_t vertexArray, indexBuffer; } geometry; //!< BindVertexArray, an index buffer of 0 keeps the one the vertex array holds
+			struct { uint32_t count, baseVertex, instances; } draw; //!< DrawIndexed, count is indices
+			struct { uint32_t first, count; } drawArrays; //!< DrawArrays, count is vertices
+		};
+
+		static RenderCommand clearDepthColourCommand(); //!< clearing the depth and the colour buffer. We do this enough to warrant them both having a shared command.
+		static RenderCommand clearDepthCommand(); //!< Clear the depth buffer
+		static RenderCommand setClearColourCommand(float r, float g, float b, float a); //!< set the background colour
+		static RenderCommand setDepthTestCommand(bool enabled); //!< Enable / disable depth testing
+		static RenderCommand setBackfaceCullingCommand(bool enabled); //!< Enable / disable backface culling
+		static RenderCommand setBlendCommand(bool enabled); //!< Enable / disable blending
+		static RenderCommand setBlendModeCommand(BlendMode mode); //!< How blended fragments are combined
+		static RenderCommand setDepthWriteCommand(bool enabled); //!< Enable / disable depth writes
+		static RenderCommand setDepthFuncCommand(DepthFunc func); //!< Depth comparison
+		static RenderCommand setCullFaceCommand(CullFace face); //!< Which faces culling removes, culling is turned on by setBackfaceCullingCommand
+		static RenderCommand setDepthClampCommand(bool enabled); //!< Enable / disable depth clamping, so geometry past the near and far planes is kept at their depth rather than clipped
+		static RenderCommand setViewportCommand(uint32_t x, uint32_t y, uint32_t width, uint32_t height); //!< Area of the target drawn to
+		static RenderCommand useShaderCommand(uint32_t renderID); //!< Bind a shader program
+		static RenderCommand bindTextureCommand(uint32_t unit, uint32_t renderID); //!< Bind a texture to a unit
+		static RenderCommand bindVertexArrayCommand(uint32_t vertexArray, uint32_t indexBuffer = 0); //!< Bind a vertex array, and an index buffer if it doesn't hold one
+		static RenderCommand drawIndexedCommand(uint32_t count, uint32_t baseVertex = 0, uint32_t instances = 1); //!< Draw indexed triangles from the bound vertex array
+		static RenderCommand drawArraysCommand(uint32_t first, uint32_t count); //!< Draw triangles without indices
+
+		static const char* getName(RenderCommandType type); //!< Getter for a command type's name, for logging recorded frames
+	};
+
+	/*! \class RenderCommandBuffer
+	* \brief Commands recorded back to back in one block of memory. reset keeps the memory, so a buffer reused every frame stops
+	* allocating once it has grown to the largest frame. The commands can be walked to inspect what a frame did
+	*/
+	class RenderCommandBuffer
+	{
+	public:
+		RenderCommandBuffer(uint32_t capacity = 256) { m_commands.reserve(capacity); } //!< Constructor, takes the number of commands to make room for up front
+
+		inline void record(const RenderCommand& command) { m_commands.push_back(command); } //!< Add a command to the end of the buffer
+		inline void reset() { m_commands.clear(); } //!< Forget the commands but keep the memory
+		inline uint32_t size() const { return static_cast<uint32_t>(m_commands.size()); } //!< Getter for the number of commands recorded
+		inline const RenderCommand& operator[](uint32_t index) const { return m_commands[index]; } //!< Getter for a recorded command
+		inline std::vector<RenderCommand>::const_iterator begin() const { return m_commands.begin(); } //!< Start of the recorded commands
+		inline std::vector<RenderCommand>::const_iterator end() const { return m_commands.end(); } //!< End of the recorded commands
+
+		void log() const; //!< Log every recorded command, in order
+	private:
+		std::vector<RenderCommand> m_commands; //!< Recorded commands
+	};
+
+	/*! \class RenderCommandExecutor
+	* \brief Runs recorded commands on the chosen render API
+	*/
+	class RenderCommandExecutor
+	{
+	public:
+		static void execute(const RenderCommand& command); //!< Run a single command
+		static void execute(const RenderCommandBuffer& buffer, uint32_t first = 0); //!< Run a buffer's commands from first to the end, in order
+	};
+}
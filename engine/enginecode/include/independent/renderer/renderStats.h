@@ -0,0 +1,68 @@
+/*! \file renderStats.h */
+#pragma once
+
+#include "renderCommands.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <chrono>
+
+namespace Engine
+{
+	/*! \struct RenderFrameStats
+	* \brief What the renderers asked of the render API in one frame
+	*/
+	struct RenderFrameStats
+	{
+		uint32_t drawCalls = 0; //!< Draw calls
+		uint64_t triangles = 0; //!< Triangles drawn, across every instance
+		uint32_t programBinds = 0; //!< Shader programs bound
+		uint32_t textureBinds = 0; //!< Textures bound
+		uint32_t vertexArrayBinds = 0; //!< Vertex arrays bound
+		uint32_t stateChanges = 0; //!< Every other render command, like blending or depth testing
+		uint32_t uniformUploads = 0; //!< Uniforms uploaded which had changed, not counting uniform buffers
+		uint64_t bufferBytes = 0; //!< Bytes written to vertex, index, uniform, storage and streaming buffers
+		uint64_t textureBytes = 0; //!< Bytes of texture data uploaded
+		uint32_t batches = 0; //!< 2D batches flushed
+	};
+
+	/*! \struct FrameTimeStats
+	* \brief Frame times over the last RenderStats::historySize frames, in milliseconds
+	*/
+	struct FrameTimeStats
+	{
+		float min = 0.f; //!< Shortest frame
+		float average = 0.f; //!< Mean frame
+		float p99 = 0.f; //!< 99th percentile, only 1 frame in 100 took longer
+		uint32_t frames = 0; //!< Frames the times cover
+	};
+
+	/*! \class RenderStats
+	* \brief Counts render work per frame, so batching and state sorting regressions show up as numbers. Render commands are counted as they are actioned,
+	* API objects count their own uploads. Counting is done on the thread which owns the graphics context, read the results from there too
+	*/
+	class RenderStats
+	{
+	public:
+		static void beginFrame(); //!< Start counting a new frame, the time since the last beginFrame is the last frame's time
+		static void endFrame(); //!< Finish the frame, its counts become the last frame's
+
+		static void countCommand(const RenderCommand& command); //!< Count a render command
+		inline static void countUniformUpload() { s_current.uniformUploads++; } //!< Count a changed uniform being uploaded
+		inline static void countBufferUpload(uint64_t bytes) { s_current.bufferBytes += bytes; } //!< Count bytes written to a buffer
+		inline static void countTextureUpload(uint64_t bytes) { s_current.textureBytes += bytes; } //!< Count bytes uploaded to a texture
+		inline static void countBatch() { s_current.batches++; } //!< Count a 2D batch being flushed
+
+		inline static const RenderFrameStats& getLastFrame() { return s_last; } //!< Getter for the last finished frame's counts
+		inline static const RenderFrameStats& getCurrentFrame() { return s_current; } //!< Getter for the counts of the frame so far
+		static FrameTimeStats getFrameTimes(); //!< Getter for the rolling frame times
+		static void submitOverlay(const glm::vec2& position, const glm::vec4& tint = glm::vec4(1.f), float scale = 0.2f); //!< Draw the last frame's counts and the frame times as text, between Renderer2D begin and end
+
+		constexpr static uint32_t historySize = 240; //!< Frames kept for the rolling frame times
+	private:
+		static RenderFrameStats s_current; //!< Counts of the frame being drawn
+		static RenderFrameStats s_last; //!< Counts of the last finished frame
+		static float s_frameTimes[historySize]; //!< Ring of frame times in milliseconds
+		static uint32_t s_frameCount; //!< Frame times ever recorded
+		static std::chrono::steady_clock::time_point s_lastBegin; //!< When the last frame began
+	};
+}
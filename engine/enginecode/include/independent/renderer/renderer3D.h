@@ -1,68 +1,122 @@
-/*! \file renderer3D */
-#pragma once
-
-#include "renderer/rendererCommon.h"
-
-namespace Engine
-{
-	/*! \class Material
-	* \brief Class for rendering a material (Shader and the shader's uniform data)
-	*/
-	class Material
-	{
-	public:
-		Material(const std::shared_ptr<Shader>& shader) : m_shader(shader), m_flag(0), m_texture(nullptr), m_tint(glm::vec4(0)) 
-		{}
-		Material(const std::shared_ptr<Shader>& shader, const std::shared_ptr<Texture>& texture, const glm::vec4& tint) : m_shader(shader), m_texture(texture), m_tint(tint) 
-		{
-			setFlag(flag_texture | flag_tint); //!< Set both flags
-		}
-		Material(const std::shared_ptr<Shader>& shader, const std::shared_ptr<Texture>& texture) : m_shader(shader), m_texture(texture), m_tint(glm::vec4(0))
-		{
-			setFlag(flag_texture); //!< Set both flags
-		}
-		Material(const std::shared_ptr<Shader>& shader, const glm::vec4& tint) : m_shader(shader), m_tint(tint)
-		{
-			setFlag(flag_tint); //!< Set both flags
-		}
-
-		inline std::shared_ptr<Shader> getShader() const { return m_shader; } //!< Getter for the shader
-		inline std::shared_ptr<Texture> getTexture() const { return m_texture; } //!< Getter for the texture
-		inline glm::vec4 getTint() const { return m_tint; } //!< Getter for the tint
-		bool isFlagSet(uint32_t flag) const { return m_flag & flag; } //!< Bool to check if flag is set (Is set if it isnt a 0)
-
-		// No setter for the shader, need to make a new material to change the shader.
-		void setTexture(const std::shared_ptr<Texture>& texture) { m_texture = texture; } //!< Setter for the texture
-		void setTint(const glm::vec4 tint) { m_tint = tint; } //!< Setter for the tint
-
-		constexpr static uint32_t flag_texture = 1 << 0; //!< 00000001
-		constexpr static uint32_t flag_tint = 1 << 1; //!< 00000010
-	private:
-		uint32_t m_flag = 0; //!< Bitfield representation of shader settings
-		std::shared_ptr<Shader> m_shader; //!< The material's shader
-		std::shared_ptr<Texture> m_texture; //!< The material's texture
-		glm::vec4 m_tint; //!< Colour tint to be applied to the geometry
-		void setFlag(uint32_t flag) { m_flag = m_flag | flag; } //!< Setter for the flag
-	};
-
-	/*! \class Renderer3D
-	* \brief Class for rendering unbatched 3D geometry
-	*/
-	class Renderer3D
-	{
-	public:
-		static void init(); //!< Initialise the renderer
-		static void begin(const SceneWideUniform& sceneWideUniform); //!< Begin a new 3D scene
-		static void submit(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4& model); //!< Submit some geometry to be rendered
-		static void end(); //!< End the current 3D scene
-	private:
-		struct InternalData
-		{
-			SceneWideUniform sceneWideUniform; //!< Replace with a UBO
-			std::shared_ptr<Texture> defaultTexture; //!< Empty texture for default
-			glm::vec4 defaultTint; //!< Plain white tint for default
-		};
-
-		static std::shared_ptr<InternalData> s_data; //!< Renderer's internal data
-	};
-}
+/*! \file renderer3D */
+#pragma once
+
+#include "renderer/rendererCommon.h"
+#include "renderer/clusteredLighting.h"
+#include "rendering/frameBuffer.h"
+#include "renderer/drawList.h"
+#include "rendering/streamingBuffer.h"
+
+namespace Engine
+{
+	/*! \class Material
+	* \brief Class for rendering a material (Shader and the shader's uniform data)
+	* The material's flags pick the shader permutation it draws with, so a material without a texture or tint doesn't pay for them.
+	*/
+	class Material
+	{
+	public:
+		Material(const std::shared_ptr<Shader>& shader) : m_shader(shader), m_flag(0), m_texture(nullptr), m_tint(glm::vec4(0)) 
+		{
+			resolveVariant(); //!< No features
+		}
+		Material(const std::shared_ptr<Shader>& shader, const std::shared_ptr<Texture>& texture, const glm::vec4& tint) : m_shader(shader), m_texture(texture), m_tint(tint) 
+		{
+			setFlag(flag_texture | flag_tint); //!< Set both flags
+		}
+		Material(const std::shared_ptr<Shader>& shader, const std::shared_ptr<Texture>& texture) : m_shader(shader), m_texture(texture), m_tint(glm::vec4(0))
+		{
+			setFlag(flag_texture); //!< Set the texture flag
+		}
+		Material(const std::shared_ptr<Shader>& shader, const glm::vec4& tint) : m_shader(shader), m_tint(tint)
+		{
+			setFlag(flag_tint); //!< Set the tint flag
+		}
+
+		inline std::shared_ptr<Shader> getShader() const { return m_shader; } //!< Getter for the shader
+		inline std::shared_ptr<Shader> getShaderVariant() const { return m_variant; } //!< Getter for the shader permutation matching the flags
+		inline std::shared_ptr<Texture> getTexture() const { return m_texture; } //!< Getter for the texture
+		inline glm::vec4 getTint() const { return m_tint; } //!< Getter for the tint
+		inline uint32_t getFlags() const { return m_flag; } //!< Getter for the bitfield of flags
+		bool isFlagSet(uint32_t flag) const { return m_flag & flag; } //!< Bool to check if flag is set (Is set if it isnt a 0)
+
+		// No setter for the shader, need to make a new material to change the shader.
+		void setTexture(const std::shared_ptr<Texture>& texture) { m_texture = texture; } //!< Setter for the texture
+		void setTint(const glm::vec4 tint) { m_tint = tint; } //!< Setter for the tint
+
+		constexpr static uint32_t flag_texture = 1 << 0; //!< 00000001
+		constexpr static uint32_t flag_tint = 1 << 1; //!< 00000010
+	private:
+		uint32_t m_flag = 0; //!< Bitfield representation of shader settings
+		std::shared_ptr<Shader> m_shader; //!< The material's shader
+		std::shared_ptr<Shader> m_variant; //!< Permutation of the shader for the flags
+		std::shared_ptr<Texture> m_texture; //!< The material's texture
+		glm::vec4 m_tint; //!< Colour tint to be applied to the geometry
+		void setFlag(uint32_t flag) { m_flag = m_flag | flag; resolveVariant(); } //!< Setter for the flag
+		void resolveVariant() { if (m_shader) m_variant = m_shader->getVariant(m_flag); } //!< Find the permutation for the flags, compiling it if it's new
+	};
+
+	/*! \enum RenderPath
+	* \brief How a 3D scene is lit
+	*/
+	enum class RenderPath
+	{
+		Forward, //!< Each draw lights itself with its material's shader
+		Deferred //!< Draws fill a G-buffer, then each light shades only the pixels inside its volume
+	};
+
+	/*! \class Renderer3D
+	* \brief Class for rendering unbatched 3D geometry
+	*/
+	class Renderer3D
+	{
+	public:
+		static void init(uint32_t width, uint32_t height); //!< Initialise the renderer, the size is the size of the deferred G-buffer
+		static void onResize(uint32_t width, uint32_t height); //!< Resize the G-buffer to match the window
+		static void begin(const SceneWideUniform& sceneWideUniform, RenderPath renderPath = RenderPath::Forward, ClusteredLighting* lighting = nullptr); //!< Begin a new 3D scene, and move any async shader compiles along. The deferred path needs the scene's lights
+		static void submit(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4& model); //!< Submit some geometry to be rendered. The deferred path uses the material's flags, texture and tint but not its shader
+		static void submit(const DrawList& drawList); //!< Draw a recorded list in its order, on the thread that owns the GL context
+		static void end(); //!< End the current 3D scene
+		static std::shared_ptr<Shader> getDrawShader(Material& material); //!< Getter for the shader a draw with this material is bound with in the current scene, the fallback while its own is compiling. On the thread that owns the GL context, it may compile a permutation
+	private:
+		/*! \struct DrawConstants
+		* \brief Layout of the b_draw block, written into the draw stream for every draw
+		*/
+		struct DrawConstants
+		{
+			glm::mat4 model; //!< u_model
+			glm::vec4 tint; //!< u_tint
+		};
+
+		constexpr static uint32_t drawBlockBinding = 0; //!< Binding point of b_draw, below UniformBuffer::reservedBindings
+		constexpr static uint32_t drawStreamSize = 1024 * 256; //!< Room for 1024 draws a region at the strictest offset alignment. More draws are skipped
+
+		static void draw(VertexArray& geometry, Material& material, const glm::mat4& model); //!< Draw one piece of geometry
+		static void lightingPass(); //!< Deferred only, shade the G-buffer into the default frame buffer
+
+		struct InternalData
+		{
+			SceneWideUniform sceneWideUniform; //!< Replace with a UBO
+			std::shared_ptr<Texture> defaultTexture; //!< Empty texture for default
+			glm::vec4 defaultTint; //!< Plain white tint for default
+
+			RenderPath renderPath = RenderPath::Forward; //!< Path used by the current scene
+			ClusteredLighting* lighting = nullptr; //!< Lights of the current scene, deferred path only
+			std::shared_ptr<FrameBuffer> gBuffer; //!< Albedo, packed normal and depth
+			std::shared_ptr<Shader> fallbackShader; //!< Cheap flat shader drawn in place of any that are still compiling
+			std::shared_ptr<Shader> geometryShader; //!< Fills the G-buffer, has the same permutations as the materials
+			std::shared_ptr<Shader> ambientShader; //!< Fullscreen ambient pass
+			std::shared_ptr<Shader> lightShader; //!< Light volume pass
+			std::shared_ptr<VertexArray> lightVolume; //!< Unit cube, scaled to each light's radius
+			std::shared_ptr<VertexArray> fullscreen; //!< Empty vertex array for the fullscreen triangle
+			std::shared_ptr<StreamingBuffer> drawStream; //!< Every draw's model and tint, bound as a b_draw range
+
+			std::shared_ptr<Shader> boundShader; //!< Shader used by the last draw this scene, nullptr at the start of a scene. Held, so a new shader can't reuse its address mid scene
+			UniformHandle boundTexData; //!< u_texData of boundShader, resolved when it is bound. The handle lives in the shader's own reflection table, so nothing is kept per shader here
+			UniformHandle ambientAlbedo, ambientDepth; //!< Ambient shader's samplers
+			UniformHandle lightAlbedo, lightNormal, lightDepth, lightScreenSize; //!< Light shader's samplers and screen size
+		};
+
+		static std::shared_ptr<InternalData> s_data; //!< Renderer's internal data
+	};
+}
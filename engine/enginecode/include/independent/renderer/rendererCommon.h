@@ -1,31 +1,52 @@
-/*! \file rendererCommon 
-* \brief A file that contains common includes for the renderers
-*/
-#pragma once
-
-#include <glm/glm.hpp>
-#include <unordered_map>
-#include <memory>
-#include "rendering/shaderDataType.h"
-#include "rendering/vertexArray.h"
-#include "rendering/texture.h"
-#include "rendering/shader.h"
-#include "renderCommands.h"
-#include "rendering/uniformBuffer.h"
-
-namespace Engine 
-{
-	using SceneWideUniform = std::unordered_map<const char *, std::shared_ptr<UniformBuffer>>;
-
-	/*! \class RendererCommon
-	*/
-	class RendererCommon
-	{
-	public:
-		static void actionCommand(RenderCommand * command)
-		{
-			command->action(); //!< Do the command's action
-			delete command; //!< Delete the pointer
-		}
-	};
-}
+/*! \file rendererCommon 
+* \brief A file that contains common includes for the renderers
+*/
+#pragma once
+
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <memory>
+#include "rendering/shaderDataType.h"
+#include "rendering/vertexArray.h"
+#include "rendering/texture.h"
+#include "rendering/shader.h"
+#include "renderCommands.h"
+#include "renderStats.h"
+#include "frameCapture.h"
+#include "rendering/uniformBuffer.h"
+#include "core/stringID.h"
+
+namespace Engine 
+{
+	using SceneWideUniform = std::unordered_map<StringID, std::shared_ptr<UniformBuffer>>; //!< Uniform buffers by the name of the block they fill
+
+	/*! \class RendererCommon
+	* \brief Render state shared by the renderers. Every command actioned is also recorded into the frame's command buffer,
+	* which is kept until the next beginFrame so the frame can be inspected
+	*/
+	class RendererCommon
+	{
+	public:
+		static void actionCommand(const RenderCommand& command)
+		{
+			s_frameCommands.record(command); //!< Keep it for inspecting the frame
+			RenderStats::countCommand(command);
+			FrameCapture::recordCommand(command);
+			RenderCommandExecutor::execute(command); //!< Do the command's action straight away, it has to happen before the renderers' draws
+		}
+		static void submit(const RenderCommandBuffer& commands)
+		{
+			for (const auto& command : commands)
+			{
+				s_frameCommands.record(command); //!< Keep them for inspecting the frame
+				RenderStats::countCommand(command);
+				FrameCapture::recordCommand(command);
+			}
+			RenderCommandExecutor::execute(commands); //!< Replay a buffer recorded earlier
+		}
+		static void beginFrame() { s_frameCommands.reset(); } //!< Start recording a new frame, reusing last frame's memory
+		inline static const RenderCommandBuffer& getFrameCommands() { return s_frameCommands; } //!< Getter for every command actioned this frame
+	private:
+		inline static RenderCommandBuffer s_frameCommands; //!< Commands actioned this frame
+	};
+}
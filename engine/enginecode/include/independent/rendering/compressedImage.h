@@ -0,0 +1,72 @@
+/*! \file compressedImage.h
+* \brief Block compressed images read from DDS and KTX2 files, ready to hand to the GPU as they are
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+	/*! \enum CompressedFormat
+	* \brief Block compression formats. Every format packs 4x4 pixel blocks into 8 or 16 bytes
+	*/
+	enum class CompressedFormat : uint8_t
+	{
+		None, //!< Not a supported format
+		BC1, //!< RGB with 1 bit alpha, 8 bytes a block
+		BC3, //!< RGBA, 16 bytes a block
+		BC4, //!< One channel, 8 bytes a block
+		BC5, //!< Two channels, 16 bytes a block, for normal maps
+		BC7 //!< High quality RGBA, 16 bytes a block
+	};
+
+	/*! \struct CompressedLevel
+	* \brief Where a mip level's blocks are in the image's data
+	*/
+	struct CompressedLevel
+	{
+		uint32_t width; //!< Width in pixels
+		uint32_t height; //!< Height in pixels
+		uint32_t offset; //!< Byte offset into the data
+		uint32_t size; //!< Size in bytes
+	};
+
+	/*! \class CompressedImage
+	* \brief A 2D block compressed image and its mip levels, largest first. Loaded from DDS (legacy FourCC or DX10 header) or uncompressed KTX2 files.
+	* Cube maps, arrays and 3D images are rejected. Saving writes DDS, with a DX10 header only where there is no FourCC for the format
+	*/
+	class CompressedImage
+	{
+	public:
+		CompressedImage() = default; //!< Default constructor, an empty image to load into
+		CompressedImage(CompressedFormat format, bool srgb, uint32_t width, uint32_t height); //!< Constructor for an image to be filled with addLevel and saved
+
+		bool load(const char* filepath); //!< Read a DDS or KTX2 file, picked by its contents. Logs and returns false if it can't be read or isn't supported
+		bool save(const char* filepath) const; //!< Write an image built with addLevel as a DDS file, false if it couldn't be written
+		void addLevel(const uint8_t* blocks, uint32_t size); //!< Append the next mip level's blocks, which must be getLevelSize bytes
+
+		inline CompressedFormat getFormat() const { return m_format; } //!< Getter for the format
+		inline bool isSRGB() const { return m_srgb; } //!< Getter for whether the colours are sRGB encoded
+		inline uint32_t getWidth() const { return m_width; } //!< Getter for the width of the largest level
+		inline uint32_t getHeight() const { return m_height; } //!< Getter for the height of the largest level
+		inline const std::vector<CompressedLevel>& getLevels() const { return m_levels; } //!< Getter for the mip levels
+		inline const uint8_t* getData(const CompressedLevel& level) const { return m_data.data() + level.offset; } //!< Getter for a level's blocks
+
+		static bool isCompressedFile(const char* filepath); //!< Does the path end in .dds or .ktx2?
+		static uint32_t getBlockSize(CompressedFormat format); //!< Getter for the bytes per 4x4 block
+		static uint32_t getLevelSize(CompressedFormat format, uint32_t width, uint32_t height); //!< Getter for the bytes a level of this size takes
+		static uint32_t getChannels(CompressedFormat format); //!< Getter for the channels a format holds
+	private:
+		bool parseDDS(); //!< Read the DDS headers and find the levels
+		bool parseKTX2(); //!< Read the KTX2 header and level index
+		bool addLevels(uint32_t levelCount, uint32_t offset); //!< Add levels packed one after another from offset, false if they run off the end of the data
+
+		std::vector<uint8_t> m_data; //!< File contents, or the blocks added
+		std::vector<CompressedLevel> m_levels; //!< Mip levels, largest first
+		CompressedFormat m_format = CompressedFormat::None; //!< Format
+		bool m_srgb = false; //!< Are the colours sRGB encoded?
+		uint32_t m_width = 0; //!< Width of the largest level
+		uint32_t m_height = 0; //!< Height of the largest level
+	};
+}
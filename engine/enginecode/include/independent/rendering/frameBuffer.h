@@ -0,0 +1,45 @@
+/*! \file frameBuffer.h
+* \brief API agnostic code for off screen render targets
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+	/*! \enum AttachmentFormat
+	* \brief Storage format of a frame buffer attachment
+	*/
+	enum class AttachmentFormat
+	{
+		None = 0, //!< No attachment
+		RGBA8, //!< 8 bit colour and alpha
+		RG16F, //!< Two 16 bit floats, used for packed normals
+		RGBA16F, //!< Four 16 bit floats, used for HDR colour
+		Depth24Stencil8 //!< 24 bit depth with 8 bit stencil, matches the default frame buffer so depth can be copied across
+	};
+
+	/*! \class FrameBuffer
+	* \brief Base class for frame buffers. Every attachment is a texture so it can be sampled by a later pass.
+	*/
+	class FrameBuffer
+	{
+	public:
+		virtual ~FrameBuffer() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the render ID
+		virtual inline uint32_t getWidth() const = 0; //!< Getter for the width
+		virtual inline uint32_t getHeight() const = 0; //!< Getter for the height
+		virtual uint32_t getColourAttachmentID(uint32_t index) const = 0; //!< Getter for the render ID of a colour attachment
+		virtual uint32_t getDepthAttachmentID() const = 0; //!< Getter for the render ID of the depth attachment
+
+		virtual void bind() = 0; //!< Render into this frame buffer, also sets the viewport to cover it
+		virtual void unbind() = 0; //!< Go back to rendering into the default frame buffer
+		virtual void resize(uint32_t width, uint32_t height) = 0; //!< Recreate the attachments at a new size
+		virtual void bindColourAttachment(uint32_t index, uint32_t slot) = 0; //!< Bind a colour attachment to a texture slot
+		virtual void bindDepthAttachment(uint32_t slot) = 0; //!< Bind the depth attachment to a texture slot
+		virtual void copyDepthToDefault() = 0; //!< Copy the depth attachment into the default frame buffer, so later passes depth test against this one's geometry
+
+		static FrameBuffer* create(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment = AttachmentFormat::Depth24Stencil8); //!< Creates the frame buffer
+	};
+}
@@ -0,0 +1,59 @@
+/*! \file mipChain.h
+* \brief Mip levels made on the CPU, so they can be built off the render thread and uploaded like any other pixels
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace Engine
+{
+	/*! \enum MipFilter
+	* \brief Filters a level can be made from the one above it with
+	*/
+	enum class MipFilter : uint8_t
+	{
+		Box, //!< Average of each 2x2 block, the same as glGenerateMipmap on most drivers
+		Kaiser //!< Kaiser windowed sinc over 12 texels, sharper with less aliasing, for offline cooking
+	};
+
+	/*! \struct MipLevel
+	* \brief Where a mip level's pixels are in the chain's data
+	*/
+	struct MipLevel
+	{
+		uint32_t width; //!< Width in pixels
+		uint32_t height; //!< Height in pixels
+		uint32_t offset; //!< Byte offset into the data
+		uint32_t size; //!< Size in bytes
+	};
+
+	/*! \class MipChain
+	* \brief The levels below an 8 bit image, half size first, down to 1x1. The full size level stays with the caller, so it isn't copied.
+	* Each level is filtered from the one above in floating point, four channels at a time. sRGB images are filtered in linear space, alpha never is
+	*/
+	class MipChain
+	{
+	public:
+		MipChain() = default; //!< Default constructor, an empty chain
+		MipChain(const uint8_t* pixels, uint32_t width, uint32_t height, uint32_t channels, MipFilter filter = MipFilter::Box, bool srgb = false, bool parallel = false); //!< Constructor, builds every level below the tightly packed pixels. Parallel splits each level's rows across the thread pool, so leave it false on the render thread. It is ignored on a worker
+
+		inline uint32_t getChannels() const { return m_channels; } //!< Getter for the channels
+		inline const std::vector<MipLevel>& getLevels() const { return m_levels; } //!< Getter for the levels, largest first
+		inline const uint8_t* getData(const MipLevel& level) const { return m_data.data() + level.offset; } //!< Getter for a level's pixels, rows tightly packed
+		inline uint32_t getSize() const { return static_cast<uint32_t>(m_data.size()); } //!< Getter for the bytes every level takes
+
+		static uint32_t getLevelCount(uint32_t width, uint32_t height); //!< Getter for the levels in a full chain, including the full size one
+		static uint64_t getChainSize(uint32_t width, uint32_t height, uint32_t channels); //!< Getter for the bytes the levels below an image of this size take
+	private:
+		void downsample(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight, const MipLevel& level, uint32_t begin, uint32_t end); //!< Filter rows [begin, end) of a level from the one above it
+		void downsampleBox(const uint8_t* source, uint32_t sourceWidth, uint32_t sourceHeight, const MipLevel& level, uint32_t begin, uint32_t end); //!< Linear box filter straight on the bytes, rounded the same as the float path
+
+		std::vector<uint8_t> m_data; //!< Every level's pixels, one after another
+		std::vector<MipLevel> m_levels; //!< Levels, largest first
+		uint32_t m_channels = 0; //!< Channels, 1 to 4
+		MipFilter m_filter = MipFilter::Box; //!< Filter the levels are made with
+		bool m_srgb = false; //!< Are the colour channels sRGB encoded?
+		static const uint32_t s_parallelRows = 64; //!< Levels with fewer rows than this aren't worth splitting across threads
+	};
+}
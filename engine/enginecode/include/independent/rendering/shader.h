@@ -1,28 +1,68 @@
-/* \file shader.h */
-#pragma once
-
-#include <cstdint>
-#include <glm/glm.hpp>
-
-namespace Engine
-{
-	/*! \class Shader
-	* \brief API agnostic code for a shader
-	*/
-	class Shader
-	{
-	public:
-		virtual ~Shader() = default; //!< Destructor
-		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the rendering ID.
-
-		static Shader* create(const char* vertexFile, const char* fragmentFile); //!< Creates the shader using a vertex filepath and a fragment filepath
-		static Shader* create(const char* filepath); //!< Creates the shader using a filepath
-
-		virtual void uploadInt(const char* name, int value) = 0;					//!< Called to upload data to the shader in the form of an int 
-		virtual void uploadFloat(const char* name, float value) = 0;				//!< Called to upload data to the shader in the form of a float
-		virtual void uploadFloat2(const char* name, const glm::vec2& value) = 0;	//!< Called to upload data to the shader in the form of 2 floats (Vec2)
-		virtual void uploadFloat3(const char* name, const glm::vec3& value) = 0;	//!< Called to upload data to the shader in the form of 3 floats (Vec3)
-		virtual void uploadFloat4(const char* name, const glm::vec4& value) = 0;	//!< Called to upload data to the shader in the form of 4 floats (Vec4)
-		virtual void uploadMat4(const char* name, const glm::mat4& value) = 0;		//!< Called to upload data to the shader in the form of a matrix (Mat4)
-	};	
+/* \file shader.h */
+#pragma once
+
+#include <cstdint>
+#include <glm/glm.hpp>
+#include <memory>
+#include "rendering/shaderDataType.h"
+#include "core/stringID.h"
+
+namespace Engine
+{
+	/*! \enum ShaderCompileMode
+	* \brief Whether creating a shader waits for it to compile
+	*/
+	enum class ShaderCompileMode
+	{
+		Blocking, //!< Compiled and linked before create returns
+		Async //!< Compile and link are started, the shader is ready some frames later. Draw something else until isReady
+	};
+
+	/*! \struct UniformHandle
+	* \brief A uniform resolved once by name. Uploads through a handle skip the name lookup, and are skipped entirely if the value hasn't changed
+	*/
+	struct UniformHandle
+	{
+		int32_t slot = -1; //!< Index of the uniform in its shader's reflection table, -1 if the shader doesn't have it
+		ShaderDataType type = ShaderDataType::none; //!< Type the shader declares the uniform as, samplers are Int
+		inline bool isValid() const { return slot >= 0; } //!< Does the shader have this uniform?
+	};
+
+	/*! \class Shader
+	* \brief API agnostic code for a shader
+	* Shader files can declare feature switches with a "#feature NAME bit" line, where bit is the index of the material flag bit that turns it on.
+	* Each variant is compiled with "#define NAME" for the features it has, so unused features can be #ifdef'd out of the source.
+	*/
+	class Shader : public std::enable_shared_from_this<Shader>
+	{
+	public:
+		virtual ~Shader() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the rendering ID.
+		virtual inline bool isReady() const = 0; //!< Has the shader finished compiling and linking? A shader that fails never becomes ready
+		virtual inline bool hasFailed() const = 0; //!< Did reading, compiling or linking fail? A failed shader never becomes ready
+		virtual std::shared_ptr<Shader> getVariant(uint32_t features) = 0; //!< Getter for the permutation compiled with only these features, built the first time it is asked for
+		virtual inline uint32_t getFeatures() const = 0; //!< Getter for the features compiled into this shader. Shaders without permutations report every bit set
+
+		static Shader* create(const char* vertexFile, const char* fragmentFile); //!< Creates the shader using a vertex filepath and a fragment filepath
+		static Shader* create(const char* filepath, ShaderCompileMode mode = ShaderCompileMode::Blocking); //!< Creates the shader using a filepath. Permutations are compiled in the same mode
+		static void updatePending(); //!< Move async compiles along, call once per frame
+
+		virtual UniformHandle getUniformHandle(StringID name) const = 0; //!< Getter for a uniform's handle. Resolve handles once and keep them, they are only valid for this shader
+		virtual int32_t getUniformBlockIndex(StringID blockName) const = 0; //!< Getter for a uniform block's index, -1 if the shader doesn't have the block
+		virtual void bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint) = 0; //!< Point a uniform block at a binding point. Only reaches the driver if the block is somewhere else
+
+		virtual void uploadInt(UniformHandle handle, int value) = 0;					//!< Upload an int through a handle
+		virtual void uploadFloat(UniformHandle handle, float value) = 0;				//!< Upload a float through a handle
+		virtual void uploadFloat2(UniformHandle handle, const glm::vec2& value) = 0;	//!< Upload a vec2 through a handle
+		virtual void uploadFloat3(UniformHandle handle, const glm::vec3& value) = 0;	//!< Upload a vec3 through a handle
+		virtual void uploadFloat4(UniformHandle handle, const glm::vec4& value) = 0;	//!< Upload a vec4 through a handle
+		virtual void uploadMat4(UniformHandle handle, const glm::mat4& value) = 0;		//!< Upload a mat4 through a handle
+
+		virtual void uploadInt(const char* name, int value) = 0;					//!< Called to upload data to the shader in the form of an int 
+		virtual void uploadFloat(const char* name, float value) = 0;				//!< Called to upload data to the shader in the form of a float
+		virtual void uploadFloat2(const char* name, const glm::vec2& value) = 0;	//!< Called to upload data to the shader in the form of 2 floats (Vec2)
+		virtual void uploadFloat3(const char* name, const glm::vec3& value) = 0;	//!< Called to upload data to the shader in the form of 3 floats (Vec3)
+		virtual void uploadFloat4(const char* name, const glm::vec4& value) = 0;	//!< Called to upload data to the shader in the form of 4 floats (Vec4)
+		virtual void uploadMat4(const char* name, const glm::mat4& value) = 0;		//!< Called to upload data to the shader in the form of a matrix (Mat4)
+	};	
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+/*! \file shaderPreprocessor.h
+* \brief API agnostic loading of shader files. Resolves #include, splits the #region stages and pulls out #feature switches
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <array>
+#include <unordered_map>
+#include <mutex>
+#include "core/stringID.h"
+
+namespace Engine
+{
+	/*! \enum ShaderStage
+	* \brief Stages a shader file can have a #region for
+	*/
+	enum class ShaderStage : int32_t
+	{
+		None = -1, //!< Lines outside any #region
+		Vertex = 0,
+		Fragment,
+		Geometry,
+		TessellationControl,
+		TessellationEvaluation,
+		Compute,
+		StageCount //!< Number of stages
+	};
+
+	/*! \struct ShaderFeature
+	* \brief A feature switch declared in a shader file
+	*/
+	struct ShaderFeature
+	{
+		std::string name; //!< Name #defined when the feature is on
+		uint32_t flag; //!< Material flag which turns the feature on
+	};
+
+	/*! \struct ShaderSource
+	* \brief A shader file after preprocessing
+	*/
+	struct ShaderSource
+	{
+		std::array<std::string, static_cast<size_t>(ShaderStage::StageCount)> stages; //!< Source of each stage, empty if the file doesn't have it
+		std::vector<ShaderFeature> features; //!< Feature switches declared in the file
+		uint64_t hash = 0; //!< Stable hash of the stages and features, the same on every run and platform
+
+		inline std::string& getStage(ShaderStage stage) { return stages[static_cast<size_t>(stage)]; } //!< Getter for the source of a stage
+		inline const std::string& getStage(ShaderStage stage) const { return stages[static_cast<size_t>(stage)]; } //!< Getter for the source of a stage
+	};
+
+	/*! \class ShaderPreprocessor
+	* \brief Reads shader files whole, resolves #include "file" relative to the including file, and caches every file it reads.
+	* A header included by many shaders is read and expanded once. The cache is shared between threads.
+	*/
+	class ShaderPreprocessor
+	{
+	public:
+		static bool process(const std::string& filepath, ShaderSource& source); //!< Preprocess a file with #region stages, returns false if it couldn't be read
+		static bool expand(const std::string& filepath, std::string& source); //!< Read a single stage file with its includes resolved, returns false if it couldn't be read
+		static void clearCache(); //!< Forget every cached file, for reloading shaders after they change on disk
+	private:
+		static bool expandFile(const std::string& filepath, std::string& expanded, std::vector<std::string>& includeStack); //!< Expand a file, using the cache if it has been expanded before
+		static bool readFile(const std::string& filepath, std::string& contents); //!< Read a whole file in one go, without carriage returns
+
+		static std::unordered_map<StringID, std::string> s_expanded; //!< Expanded text of every file read, by normalised path
+		static std::recursive_mutex s_mutex; //!< Guards the cache
+	};
+}
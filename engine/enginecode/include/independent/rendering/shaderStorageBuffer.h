@@ -0,0 +1,24 @@
+/*! \file shaderStorageBuffer.h
+* \brief API agnostic code for shader storage buffers
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace Engine
+{
+	/*! \class ShaderStorageBuffer
+	* \brief Base class for shader storage buffers. Used for data too large or too variable in size for a uniform buffer.
+	*/
+	class ShaderStorageBuffer
+	{
+	public:
+		virtual ~ShaderStorageBuffer() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() = 0; //!< Getter for the render ID
+		virtual inline uint32_t getSize() = 0; //!< Getter for the allocated size in bytes
+		virtual void uploadData(const void * data, uint32_t size) = 0; //!< Replace the start of the buffer with data, growing the buffer if it is too small
+		virtual void bind(uint32_t bindingPoint) = 0; //!< Bind the buffer to an indexed binding point
+
+		static ShaderStorageBuffer* create(uint32_t size); //!< Creates the shader storage buffer
+	};
+}
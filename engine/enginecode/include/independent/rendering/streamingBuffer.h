@@ -0,0 +1,44 @@
+/*! \file streamingBuffer.h
+* \brief API agnostic code for streaming buffers, GPU memory the CPU writes into every frame
+*/
+#pragma once
+
+#include <cstdint>
+
+namespace Engine
+{
+	/*! \enum StreamingBufferTarget
+	* \brief What a range of a streaming buffer can be bound as
+	*/
+	enum class StreamingBufferTarget
+	{
+		Uniform, //!< Uniform block
+		ShaderStorage //!< Shader storage block
+	};
+
+	/*! \class StreamingBuffer
+	* \brief Base class for streaming buffers. The buffer is split into regions and a frame writes into one region while the GPU reads the
+	* ones before it, so writes never wait on a draw still in flight. Call beginFrame once a frame before writing anything.
+	* Data written is visible to draws issued after the write, and stays valid until the buffer comes back round to the same region.
+	*/
+	class StreamingBuffer
+	{
+	public:
+		virtual ~StreamingBuffer() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() = 0; //!< Getter for the render ID
+		virtual inline uint32_t getRegionSize() = 0; //!< Getter for the size of each region in bytes, the most one frame can write
+		virtual void beginFrame() = 0; //!< Move on to the next region, waiting for the GPU to finish with it if it is still in use
+		virtual void* reserve(uint32_t size, uint32_t alignment, uint32_t& offset) = 0; //!< Get somewhere to write up to size bytes, offset is where it is in the buffer. Returns nullptr if size is bigger than a region, or if the region has no room left this frame
+		virtual void commit(uint32_t size) = 0; //!< Keep the first size bytes of the last reservation, the rest can be handed out again
+		virtual void bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size) = 0; //!< Bind part of the buffer to an indexed binding point, size can't be 0
+
+		inline void* allocate(uint32_t size, uint32_t alignment, uint32_t& offset) //!< Reserve and commit in one go, for when the size is known up front
+		{
+			void* data = reserve(size, alignment, offset);
+			if (data) commit(size);
+			return data;
+		}
+
+		static StreamingBuffer* create(uint32_t regionSize, uint32_t regionCount = 3); //!< Creates the streaming buffer
+	};
+}
@@ -1,29 +1,41 @@
-/* \file texture.h */
-#pragma once
-
-#include "rendering/bufferLayout.h"
-
-namespace Engine
-{
-	/**
-	* \class Texture
-	* API Agnostic code for a texture
-	*/
-	class Texture
-	{
-	public:
-		virtual ~Texture() = default; //!< Destructor
-
-		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the rendering ID.
-		virtual inline uint32_t getWidth() = 0; //!< Getter for the width.
-		virtual inline uint32_t getHeight() = 0;  //!< Getter for the width.
-		virtual inline float getWidthf() = 0; //!< Getter for the width as a float
-		virtual inline float getHeightf() = 0; //!< Getter for the height as a float
-		virtual inline uint32_t getChannels() = 0;//!< Getter for the channels
-
-		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) = 0; //!< Edits the texture's attributes
-
-		static Texture* create(const char* filepath); //!< Creates the texture
-		static Texture* create(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Create texture from data
-	};
+/* \file texture.h */
+#pragma once
+
+#include "rendering/bufferLayout.h"
+
+namespace Engine
+{
+	/*! \enum TextureLoadMode
+	* \brief Whether loading a texture from a file waits for it
+	*/
+	enum class TextureLoadMode
+	{
+		Blocking, //!< Decoded and uploaded before create returns
+		Async //!< Decoded on a worker and uploaded over the next frames. Draws as a placeholder until isReady
+	};
+
+	/**
+	* \class Texture
+	* API Agnostic code for a texture
+	*/
+	class Texture
+	{
+	public:
+		virtual ~Texture() = default; //!< Destructor
+
+		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the rendering ID.
+		virtual inline uint32_t getWidth() = 0; //!< Getter for the width.
+		virtual inline uint32_t getHeight() = 0;  //!< Getter for the width.
+		virtual inline float getWidthf() = 0; //!< Getter for the width as a float
+		virtual inline float getHeightf() = 0; //!< Getter for the height as a float
+		virtual inline uint32_t getChannels() = 0;//!< Getter for the channels
+		virtual inline bool isReady() const = 0; //!< Have the pixels been uploaded? The size and channels are known straight away, a texture that fails to load never becomes ready
+		virtual inline bool hasFailed() const = 0; //!< Did the load fail? A failed texture never becomes ready, and an async one draws as the placeholder for good
+
+		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) = 0; //!< Edits the texture's attributes
+
+		static Texture* create(const char* filepath, TextureLoadMode mode = TextureLoadMode::Blocking); //!< Creates the texture
+		static Texture* create(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Create texture from data
+		static void updatePending(); //!< Move async loads along, call once per frame
+	};
 }
\ No newline at end of file
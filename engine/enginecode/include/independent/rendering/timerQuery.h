@@ -0,0 +1,23 @@
+/*! \file timerQuery.h */
+#pragma once
+
+#include <cstdint>
+
+namespace Engine
+{
+	/*! \class TimerQuery
+	* \brief API agnostic code for a GPU timer query, which measures how long the GPU spends on the commands between begin and end
+	*/
+	class TimerQuery
+	{
+	public:
+		virtual ~TimerQuery() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() const = 0; //!< Getter for the rendering ID
+		virtual void begin() = 0; //!< Start timing the commands which follow
+		virtual void end() = 0; //!< Stop timing
+		virtual bool isReady() const = 0; //!< Has the GPU finished the timed commands? Never waits
+		virtual uint64_t getElapsed() const = 0; //!< Getter for the GPU time in nanoseconds, waits for the GPU if the query isn't ready
+
+		static TimerQuery* create(); //!< Creates the timer query
+	};
+}
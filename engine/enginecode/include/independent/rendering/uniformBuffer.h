@@ -1,31 +1,60 @@
-/*! \file uniformBuffer.h 
-\ \brief API agnostic code for the uniform buffer 
-*/
-#pragma once
-#include "rendering/bufferLayout.h"
-#include "rendering/shader.h"
-#include <unordered_map>
-#include <memory>
-#include <glm/glm.hpp>
-
-namespace Engine
-{
-	/*! \class UniformBuffer
-	* \brief Base class for uniform buffers
-	*/
-	class UniformBuffer
-	{
-	public:
-		virtual ~UniformBuffer() = default; //!< Destructor
-		virtual inline uint32_t getRenderID() = 0; //!< Getter for the render ID
-		virtual inline UniformBufferLayout getLayout() = 0; //!< Getter for the layout
-		virtual void attachShaderBlock(const std::shared_ptr<Shader>& shader, const char * blockName) = 0; //!< Attaches the shader block
-		virtual void uploadShaderData(const char * uniformName, void * data) = 0; //!< Uploades shader data
-		static UniformBuffer* create(const UniformBufferLayout& layout); //!< Creates the Uniform Buffer
-	protected:
-		UniformBufferLayout m_layout; //!< Layout
-		std::unordered_map<const char *, std::pair<uint32_t, uint32_t>> m_uniformCache; //!< Stores the uniform names, offsets and sizes in an unordered map so that it can be iterated later.
-		uint32_t m_blockNo; //!< Block number for this UBO
-		//glm::mat4 m_data[]; //for my attempt at making it upload once
-	};
-}
\ No newline at end of file
+/*! \file uniformBuffer.h
+\ \brief API agnostic code for the uniform buffer
+*/
+#pragma once
+#include "rendering/bufferLayout.h"
+#include "rendering/shader.h"
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+	/*! \struct UniformFieldHandle
+	* \brief Index of a field in a uniform buffer's layout. Resolve it once with getFieldHandle and keep it, it is only valid for that buffer
+	*/
+	struct UniformFieldHandle
+	{
+		int32_t field = -1; //!< Index into the buffer's field table, -1 if the name wasn't in the layout
+		inline bool isValid() const { return field >= 0; } //!< Does the handle point at a field?
+	};
+
+	/*! \class UniformBuffer
+	* \brief Base class for uniform buffers. Writes go into a CPU copy of the block and only the changed bytes are sent to the GPU,
+	* in one upload when the buffer is flushed. The renderers flush their scene wide uniforms in begin, so set fields before that.
+	*/
+	class UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() = default; //!< Destructor
+		virtual inline uint32_t getRenderID() = 0; //!< Getter for the render ID
+		virtual inline UniformBufferLayout getLayout() = 0; //!< Getter for the layout
+		virtual void attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName) = 0; //!< Attaches the shader block
+		virtual UniformFieldHandle getFieldHandle(StringID uniformName) const = 0; //!< Getter for a field's handle
+		virtual void uploadShaderData(UniformFieldHandle field, const void * data) = 0; //!< Stage a field's data, does nothing if the value hasn't changed
+		virtual void uploadShaderData(StringID uniformName, const void * data) = 0; //!< Stage a field's data by name
+		virtual void flush() = 0; //!< Send the changed bytes to the GPU in one upload. Does nothing if nothing changed
+		inline bool isDirty() const { return m_dirtyEnd > m_dirtyBegin; } //!< Are there staged changes waiting for a flush?
+		static UniformBuffer* create(const UniformBufferLayout& layout); //!< Creates the Uniform Buffer
+
+		constexpr static uint32_t reservedBindings = 1; //!< Binding points below this are never given to a uniform buffer, they are bound straight from streaming buffers like Renderer3D's b_draw
+	protected:
+		/*! \struct Field
+		* \brief Where a field lives in the block
+		*/
+		struct Field
+		{
+			uint32_t offset; //!< Offset of the field in bytes
+			uint32_t size; //!< Bytes read from the caller's data, the field's unpadded size
+		};
+
+		UniformBufferLayout m_layout; //!< Layout
+		std::vector<Field> m_fields; //!< Offset and size of every field, in layout order
+		std::unordered_map<StringID, uint32_t> m_fieldLookup; //!< Field name to its index in m_fields
+		std::vector<uint8_t> m_shadow; //!< CPU copy of the whole block
+		uint32_t m_dirtyBegin = 0; //!< First byte changed since the last flush
+		uint32_t m_dirtyEnd = 0; //!< One past the last byte changed since the last flush
+		uint32_t m_blockNo; //!< Block number for this UBO
+	};
+}
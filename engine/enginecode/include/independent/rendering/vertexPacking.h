@@ -0,0 +1,16 @@
+/*! \file vertexPacking.h
+* \brief Packing of vertex attributes into smaller types, for vertex layouts with normalised attributes
+*/
+#pragma once
+
+#include <cstdint>
+#include <array>
+#include <glm/glm.hpp>
+
+namespace Engine
+{
+	std::array<int16_t, 3> normalise(const glm::vec3& norm); //!< Pack a normal in [-1, 1] into signed shorts
+	std::array<int16_t, 2> normalise(const glm::vec2& uv); //!< Pack a texture coordinate in [-1, 1] into signed shorts
+	uint32_t pack(const glm::vec4& colour); //!< Pack an RGBA colour in [0, 1] into one byte per channel
+	uint32_t pack(const glm::vec3& colour); //!< Pack an RGB colour, with an alpha of 1
+}
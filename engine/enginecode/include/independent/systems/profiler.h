@@ -0,0 +1,97 @@
+/*! \file profiler.h */
+#pragma once
+
+#include "system.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+
+namespace Engine
+{
+	/*! \struct ProfileEvent
+	* \brief A zone or a frame marker recorded by the profiler
+	*/
+	struct ProfileEvent
+	{
+		const char* name; //!< Name of the zone, must outlive the profiler
+		uint64_t start; //!< Nanoseconds since the profiler started
+		uint64_t end; //!< Nanoseconds since the profiler started, the same as start for a frame marker
+		bool isFrame; //!< Is this a frame marker?
+	};
+
+	/*! \class Profiler
+	* \brief System which records named zones and frame markers from any thread, and writes them out as Chrome trace event JSON
+	* (open it in chrome://tracing or Perfetto). Each thread writes into a ring buffer of its own, so recording takes no locks.
+	* When a ring fills, its oldest events are overwritten. A thread's ring is only made the first time it records, so nothing is allocated unless a trace is taken.
+	* Use the NG_PROFILE macros, which compile to nothing unless NG_PROFILE is defined. Only Debug defines it, so Release has no zones at all
+	*/
+	class Profiler : public System
+	{
+	public:
+		virtual void start(SystemSignal init = SystemSignal::None, ...) override; //!< Start recording, takes the const char* path the trace is written to on stop
+		virtual void stop(SystemSignal close = SystemSignal::None, ...) override; //!< Stop recording and write the trace
+
+		static void record(const char* name, uint64_t start, uint64_t end); //!< Record a zone on the calling thread
+		static void markFrame(const char* name); //!< Record the start of a frame on the calling thread
+		static void setThreadName(const char* name); //!< Name the calling thread in the trace
+		static bool exportChromeTrace(const std::string& filepath); //!< Write everything recorded to a Chrome trace event JSON file
+
+		inline static bool isRecording() { return s_recording.load(std::memory_order_relaxed); } //!< Are zones being recorded?
+		inline static uint64_t now() { return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - s_epoch).count(); } //!< Nanoseconds since the profiler started
+
+		constexpr static uint32_t ringSize = 1 << 16; //!< Events each thread keeps, a power of two
+	private:
+		/*! \struct ThreadBuffer
+		* \brief One thread's ring of events. Only its thread writes to it
+		*/
+		struct ThreadBuffer
+		{
+			uint32_t threadID; //!< Number of the thread in the trace
+			std::string name; //!< Name of the thread in the trace
+			std::unique_ptr<ProfileEvent[]> events; //!< The ring
+			std::atomic<uint64_t> written = 0; //!< Events ever written, the next is written at written % ringSize
+		};
+
+		static ThreadBuffer& getThreadBuffer(); //!< Getter for the calling thread's buffer, making it and its ring on first use
+		static void push(const ProfileEvent& event); //!< Add an event to the calling thread's ring
+
+		static std::vector<std::unique_ptr<ThreadBuffer>> s_buffers; //!< Every thread's buffer, kept after the thread ends
+		static std::mutex s_mutex; //!< Guards the buffer list, only taken the first time a thread records
+		static std::atomic<bool> s_recording; //!< Are zones being recorded?
+		static std::chrono::steady_clock::time_point s_epoch; //!< When the profiler started
+		static std::string s_filepath; //!< Where the trace is written on stop
+		static thread_local ThreadBuffer* s_threadBuffer; //!< Calling thread's buffer, null until it records
+		static thread_local const char* s_threadName; //!< Calling thread's name, given to its buffer when it is made
+	};
+
+	/*! \class ProfileZone
+	* \brief Records the time between its construction and destruction as a zone, if the profiler is recording
+	*/
+	class ProfileZone
+	{
+	public:
+		ProfileZone(const char* name) : m_name(Profiler::isRecording() ? name : nullptr), m_start(m_name ? Profiler::now() : 0) {} //!< Constructor, starts the zone
+		~ProfileZone() { if (m_name) Profiler::record(m_name, m_start, Profiler::now()); } //!< Destructor, ends the zone
+	private:
+		const char* m_name; //!< Name of the zone, null if the profiler wasn't recording
+		uint64_t m_start; //!< When the zone started
+	};
+}
+
+#ifdef NG_PROFILE
+#define NG_PROFILE_CONCAT_INNER(a, b) a##b
+#define NG_PROFILE_CONCAT(a, b) NG_PROFILE_CONCAT_INNER(a, b)
+#define NG_PROFILE_SCOPE(name) ::Engine::ProfileZone NG_PROFILE_CONCAT(profileZone, __LINE__)(name) //!< Time the rest of the scope
+#define NG_PROFILE_FUNCTION() NG_PROFILE_SCOPE(__FUNCTION__) //!< Time the rest of the function, named after it
+#define NG_PROFILE_FRAME(name) ::Engine::Profiler::markFrame(name) //!< Mark the start of a frame
+#define NG_PROFILE_THREAD(name) ::Engine::Profiler::setThreadName(name) //!< Name the calling thread
+#else
+#define NG_PROFILE_SCOPE(name)
+#define NG_PROFILE_FUNCTION()
+#define NG_PROFILE_FRAME(name)
+#define NG_PROFILE_THREAD(name)
+#endif
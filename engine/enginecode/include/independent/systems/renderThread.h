@@ -0,0 +1,67 @@
+/*! \file renderThread.h */
+#pragma once
+
+#include "system.h"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <atomic>
+
+namespace Engine
+{
+	class GraphicsContext;
+
+	/*! \class RenderThread
+	* \brief System which owns the graphics context on a thread of its own. The main thread records a frame packet of render jobs while the
+	* render thread runs the previous one, so simulating frame N+1 overlaps drawing frame N. Packets are double buffered, at most one frame is in flight.
+	* If the system has not been started, jobs are run inline on the calling thread and the window swaps its own buffers.
+	* API objects are made with construct and their destructors delete their resources through enqueue, so they can be created from any thread but a pool worker, and released from any thread without waiting.
+	*/
+	class RenderThread : public System
+	{
+	public:
+		virtual void start(SystemSignal init = SystemSignal::None, ...) override; //!< Start the render thread, takes the GraphicsContext* to hand over. The context must be current on the calling thread
+		virtual void stop(SystemSignal close = SystemSignal::None, ...) override; //!< Finish the frame in flight, join the thread and make the context current on the calling thread again
+
+		static void enqueue(const std::function<void()>& job); //!< Add a job to the frame being recorded. It runs on the render thread once the frame is submitted, after everything recorded before it
+		static void execute(const std::function<void()>& job); //!< Run a job on the render thread now and wait for it, for work which needs the context straight away, like creating resources. Refused on a pool worker, as the render thread may be waiting on it
+		static void endFrame(); //!< Submit the recorded frame and start recording the next. Blocks while the frame before is still being drawn
+
+		template<typename T, typename ...Args>
+		static T* construct(Args&&... args) //!< Construct an API object on the render thread, so it can be created from any thread
+		{
+			T* result = nullptr;
+			execute([&]() { result = new T(std::forward<Args>(args)...); });
+			return result;
+		}
+
+		inline static bool isRunning() { return s_running; } //!< Is the render thread running?
+		inline static bool isRenderThread() { return !s_running || std::this_thread::get_id() == s_threadID.load(); } //!< Can the calling thread use the context? True everywhere when the system isn't running
+	private:
+		/*! \struct FramePacket
+		* \brief Everything needed to draw one frame. The jobs keep their memory between frames
+		*/
+		struct FramePacket
+		{
+			std::vector<std::function<void()>> jobs; //!< Render jobs, in the order they were recorded
+		};
+
+		static void renderLoop(); //!< Loop run by the render thread, draws submitted packets and runs immediate jobs until the system is stopped
+
+		static GraphicsContext* s_context; //!< Context owned by the render thread
+		static std::thread s_thread; //!< Render thread
+		static FramePacket s_packets[2]; //!< One packet being recorded, one being drawn
+		static uint32_t s_recording; //!< Index of the packet being recorded
+		static bool s_frameSubmitted; //!< Is the other packet waiting for or being drawn?
+		static std::deque<std::packaged_task<void()>> s_immediate; //!< Jobs waiting on execute
+		static std::mutex s_mutex; //!< Guards the packets and the immediate queue
+		static std::condition_variable s_wake; //!< Wakes the render thread when a frame is submitted, a job is queued or the system stops
+		static std::condition_variable s_frameDone; //!< Wakes the main thread when the render thread finishes a frame
+		static std::atomic<bool> s_running; //!< Is the render thread running?
+		static std::atomic<std::thread::id> s_threadID; //!< ID of the render thread, set by the thread itself, as s_thread is written by start while other threads may be asking
+	};
+}
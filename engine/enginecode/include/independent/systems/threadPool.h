@@ -0,0 +1,39 @@
+/*! \file threadPool.h */
+#pragma once
+
+#include "system.h"
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+
+namespace Engine
+{
+	/*! \class ThreadPool
+	* \brief System which owns the engine's worker threads. Jobs can be queued from anywhere once the system has started.
+	* If the system has not been started, jobs are run inline on the calling thread.
+	*/
+	class ThreadPool : public System
+	{
+	public:
+		virtual void start(SystemSignal init = SystemSignal::None, ...) override; //!< Start the worker threads
+		virtual void stop(SystemSignal close = SystemSignal::None, ...) override; //!< Finish the queued jobs and join the worker threads
+
+		static std::future<void> submit(const std::function<void()>& job); //!< Queue a job. The future is ready once the job has run
+		static void parallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& job); //!< Split [0, count) into ranges and run job(begin, end) across the workers and the calling thread. Blocks until every range is done. Called from a worker it runs every range on that worker, as waiting on the pool from inside it can deadlock
+		inline static uint32_t getWorkerCount() { return static_cast<uint32_t>(s_workers.size()); } //!< Getter for the number of worker threads
+		inline static bool isWorkerThread() { return s_isWorker; } //!< Is the calling thread one of the pool's workers?
+	private:
+		static void workerLoop(); //!< Loop run by each worker, pulls jobs off the queue until the pool is stopped
+
+		static std::vector<std::thread> s_workers; //!< Worker threads
+		static std::deque<std::packaged_task<void()>> s_jobs; //!< Jobs waiting for a worker
+		static std::mutex s_mutex; //!< Guards the job queue
+		static std::condition_variable s_condition; //!< Wakes workers when a job is queued or the pool stops
+		static bool s_running; //!< Is the pool accepting jobs?
+		static thread_local bool s_isWorker; //!< Set on each worker thread
+	};
+}
@@ -1,17 +1,19 @@
-/*! \file GLFW_OpenGL_GC.h */
-#pragma once
-
-#include "core/graphicsContext.h"
-
-namespace Engine
-{
-	class GLFW_OpenGL_GC : public GraphicsContext
-	{
-	public:
-		GLFW_OpenGL_GC(GLFWwindow * window) : m_window(window) {} //!< Constructor, assigns the window
-		virtual void init() override; //!< Init the current window API's graphics context
-		virtual void swapBuffers() override; //!< Swap the front and back buffers
-	private:
-		GLFWwindow * m_window; //!< Window
-	};
+/*! \file GLFW_OpenGL_GC.h */
+#pragma once
+
+#include "core/graphicsContext.h"
+
+namespace Engine
+{
+	class GLFW_OpenGL_GC : public GraphicsContext
+	{
+	public:
+		GLFW_OpenGL_GC(GLFWwindow * window) : m_window(window) {} //!< Constructor, assigns the window
+		virtual void init() override; //!< Init the current window API's graphics context
+		virtual void swapBuffers() override; //!< Swap the front and back buffers
+		virtual void makeCurrent() override; //!< Make the context current on the calling thread
+		virtual void releaseCurrent() override; //!< Detach the context from the calling thread
+	private:
+		GLFWwindow * m_window; //!< Window
+	};
 }
\ No newline at end of file
@@ -0,0 +1,35 @@
+/*! \file NullFrameBuffer.h */
+#pragma once
+
+#include "rendering/frameBuffer.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	/*! \class NullFrameBuffer
+	* \brief Frame buffer with IDs for its attachments but no storage
+	*/
+	class NullFrameBuffer : public FrameBuffer
+	{
+	public:
+		NullFrameBuffer(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment); //!< Constructor
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the render ID
+		virtual inline uint32_t getWidth() const override { return m_width; } //!< Getter for the width
+		virtual inline uint32_t getHeight() const override { return m_height; } //!< Getter for the height
+		virtual uint32_t getColourAttachmentID(uint32_t index) const override { return index < m_colourIDs.size() ? m_colourIDs[index] : 0; } //!< Getter for the render ID of a colour attachment
+		virtual uint32_t getDepthAttachmentID() const override { return m_depthID; } //!< Getter for the render ID of the depth attachment
+
+		virtual void bind() override { NullRenderAPI::countCall(); } //!< Count the bind
+		virtual void unbind() override { NullRenderAPI::countCall(); } //!< Count the unbind
+		virtual void resize(uint32_t width, uint32_t height) override; //!< Take the new size and count the attachments being recreated
+		virtual void bindColourAttachment(uint32_t index, uint32_t slot) override { NullRenderAPI::countCall(); } //!< Count the bind
+		virtual void bindDepthAttachment(uint32_t slot) override { NullRenderAPI::countCall(); } //!< Count the bind
+		virtual void copyDepthToDefault() override { NullRenderAPI::countCall(); } //!< Count the blit
+	private:
+		uint32_t m_renderID; //!< Render ID
+		uint32_t m_width; //!< Width
+		uint32_t m_height; //!< Height
+		std::vector<uint32_t> m_colourIDs; //!< Render ID of each colour attachment
+		uint32_t m_depthID = 0; //!< Render ID of the depth attachment, 0 if there isn't one
+	};
+}
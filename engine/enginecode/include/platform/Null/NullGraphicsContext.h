@@ -0,0 +1,19 @@
+/*! \file NullGraphicsContext.h */
+#pragma once
+
+#include "core/graphicsContext.h"
+
+namespace Engine
+{
+	/*! \class NullGraphicsContext
+	* \brief Graphics context for the null render API, there is nothing to create, make current or present
+	*/
+	class NullGraphicsContext : public GraphicsContext
+	{
+	public:
+		virtual void init() override {} //!< Nothing to initialise
+		virtual void swapBuffers() override {} //!< Nothing to present
+		virtual void makeCurrent() override {} //!< Nothing to make current
+		virtual void releaseCurrent() override {} //!< Nothing to release
+	};
+}
@@ -0,0 +1,22 @@
+/*! \file NullIndexBuffer.h */
+#pragma once
+
+#include "rendering/indexBuffer.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	/*! \class NullIndexBuffer
+	* \brief Index buffer which keeps its count but no indices
+	*/
+	class NullIndexBuffer : public IndexBuffer
+	{
+	public:
+		NullIndexBuffer(uint32_t * indices, uint32_t count) : m_count(count), m_renderID(NullRenderAPI::createResource(sizeof(uint32_t) * count)) {} //!< Constructor, counts the upload the indices would need
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the rendering ID.
+		virtual inline uint32_t getDrawCount() const override { return m_count; } //!< Getter for the draw count
+	private:
+		uint32_t m_count; //!< Effective draw count
+		uint32_t m_renderID; //!< Render ID
+	};
+}
@@ -0,0 +1,45 @@
+/*! \file NullRenderAPI.h
+* \brief Bookkeeping shared by the null backend's objects
+*/
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+
+namespace Engine
+{
+	/*! \struct NullRenderCounters
+	* \brief What the null backend has been asked to do since the counters were last reset
+	*/
+	struct NullRenderCounters
+	{
+		uint64_t calls = 0; //!< API calls, including draws
+		uint64_t draws = 0; //!< Draw calls
+		uint64_t triangles = 0; //!< Triangles the draws would have drawn
+		uint64_t bytes = 0; //!< Bytes that would have been sent to the GPU
+		uint64_t resources = 0; //!< API objects created
+	};
+
+	/*! \class NullRenderAPI
+	* \brief Counters and render IDs for the null backend. The null backend does no GPU work, so running the renderers on it measures
+	* only their CPU side. Counting is thread safe, resources may be created on any thread
+	*/
+	class NullRenderAPI
+	{
+	public:
+		static void countCall(uint64_t bytes = 0) { s_calls++; s_bytes += bytes; } //!< Count an API call, and the bytes it uploads
+		static void countDraw(uint64_t triangles) { s_calls++; s_draws++; s_triangles += triangles; } //!< Count a draw call
+		static uint32_t createResource(uint64_t bytes = 0) { s_resources++; countCall(bytes); return s_nextID++; } //!< Count a new API object and hand out its render ID
+
+		static NullRenderCounters getCounters(); //!< Getter for the counters
+		static void resetCounters(); //!< Zero the counters, render IDs keep counting up
+		static void logCounters(); //!< Log the counters
+	private:
+		static std::atomic<uint64_t> s_calls; //!< API calls
+		static std::atomic<uint64_t> s_draws; //!< Draw calls
+		static std::atomic<uint64_t> s_triangles; //!< Triangles drawn
+		static std::atomic<uint64_t> s_bytes; //!< Bytes uploaded
+		static std::atomic<uint64_t> s_resources; //!< Objects created
+		static std::atomic<uint32_t> s_nextID; //!< Next render ID, 0 is kept for "nothing" like in GL
+	};
+}
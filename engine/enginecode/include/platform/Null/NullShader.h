@@ -0,0 +1,47 @@
+/*! \file NullShader.h */
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+#include "rendering/shader.h"
+
+namespace Engine
+{
+	/*! \class NullShader
+	* \brief Shader which compiles nothing. It is always ready, has every feature and every uniform the renderers ask for,
+	* so the renderers take the same paths they would on a real backend
+	*/
+	class NullShader : public Shader
+	{
+	public:
+		NullShader(); //!< Constructor, there is nothing to read as the sources are never compiled
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the rendering ID.
+		virtual inline bool isReady() const override { return true; } //!< Nothing to wait for
+		virtual inline bool hasFailed() const override { return false; } //!< Nothing is compiled, so nothing can fail
+		virtual std::shared_ptr<Shader> getVariant(uint32_t features) override { return shared_from_this(); } //!< Every permutation is the same
+		virtual inline uint32_t getFeatures() const override { return ~0u; } //!< Every feature
+
+		virtual UniformHandle getUniformHandle(StringID name) const override; //!< Getter for a uniform's handle, every name gets a slot the first time it is asked for
+		virtual int32_t getUniformBlockIndex(StringID blockName) const override; //!< Getter for a block's index, every name gets an index the first time it is asked for
+		virtual void bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint) override; //!< Count the binding, skipped if it is already set like the real backend
+
+		void uploadInt(UniformHandle handle, int value) override;					//!< Count an int upload
+		void uploadFloat(UniformHandle handle, float value) override;				//!< Count a float upload
+		void uploadFloat2(UniformHandle handle, const glm::vec2& value) override;	//!< Count a vec2 upload
+		void uploadFloat3(UniformHandle handle, const glm::vec3& value) override;	//!< Count a vec3 upload
+		void uploadFloat4(UniformHandle handle, const glm::vec4& value) override;	//!< Count a vec4 upload
+		void uploadMat4(UniformHandle handle, const glm::mat4& value) override;		//!< Count a mat4 upload
+
+		void uploadInt(const char* name, int value) override;					//!< Count an int upload
+		void uploadFloat(const char* name, float value) override;				//!< Count a float upload
+		void uploadFloat2(const char* name, const glm::vec2& value) override;	//!< Count a vec2 upload
+		void uploadFloat3(const char* name, const glm::vec3& value) override;	//!< Count a vec3 upload
+		void uploadFloat4(const char* name, const glm::vec4& value) override;	//!< Count a vec4 upload
+		void uploadMat4(const char* name, const glm::mat4& value) override;		//!< Count a mat4 upload
+	private:
+		uint32_t m_renderID; //!< Render ID
+		mutable std::unordered_map<StringID, int32_t> m_uniformSlots; //!< Uniform name to handle slot, filled as names are asked for
+		mutable std::unordered_map<StringID, int32_t> m_blockIndices; //!< Block name to block index, filled as names are asked for
+		std::vector<int32_t> m_blockBindings; //!< Binding point each block is set to, indexed by block index
+	};
+}
@@ -0,0 +1,25 @@
+/*! \file NullShaderStorageBuffer.h */
+#pragma once
+
+#include "rendering/shaderStorageBuffer.h"
+#include "platform/Null/NullRenderAPI.h"
+#include "renderer/renderStats.h"
+
+namespace Engine
+{
+	/*! \class NullShaderStorageBuffer
+	* \brief Shader storage buffer which tracks its size but stores nothing
+	*/
+	class NullShaderStorageBuffer : public ShaderStorageBuffer
+	{
+	public:
+		NullShaderStorageBuffer(uint32_t size) : m_size(size), m_renderID(NullRenderAPI::createResource()) {} //!< Constructor
+		virtual inline uint32_t getRenderID() override { return m_renderID; } //!< Getter for the render ID
+		virtual inline uint32_t getSize() override { return m_size; } //!< Getter for the allocated size in bytes
+		virtual void uploadData(const void * data, uint32_t size) override { if (size > m_size) m_size = size; NullRenderAPI::countCall(size); RenderStats::countBufferUpload(size); } //!< Count the upload, growing like the real buffer
+		virtual void bind(uint32_t bindingPoint) override { NullRenderAPI::countCall(); } //!< Count the bind
+	private:
+		uint32_t m_size; //!< Allocated size
+		uint32_t m_renderID; //!< Render ID
+	};
+}
@@ -0,0 +1,32 @@
+/*! \file NullStreamingBuffer.h */
+#pragma once
+
+#include "rendering/streamingBuffer.h"
+#include <vector>
+
+namespace Engine
+{
+	/*! \class NullStreamingBuffer
+	* \brief Streaming buffer backed by ordinary memory. Regions are handed out the same way as the real one, but there is never a GPU to wait for
+	*/
+	class NullStreamingBuffer : public StreamingBuffer
+	{
+	public:
+		NullStreamingBuffer(uint32_t regionSize, uint32_t regionCount); //!< Constructor, takes the size of a region and how many there are
+		virtual inline uint32_t getRenderID() override { return m_renderID; } //!< Getter for the render ID
+		virtual inline uint32_t getRegionSize() override { return m_regionSize; } //!< Getter for the region size
+		virtual void beginFrame() override; //!< Move on to the next region
+		virtual void* reserve(uint32_t size, uint32_t alignment, uint32_t& offset) override; //!< Reserve space in the current region
+		virtual void commit(uint32_t size) override; //!< Keep part of the last reservation, counted as uploaded
+		virtual void bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size) override; //!< Count the bind
+	private:
+		uint32_t m_renderID; //!< Render ID
+		std::vector<uint8_t> m_memory; //!< Every region
+		uint32_t m_regionSize; //!< Size of each region in bytes
+		uint32_t m_regionCount; //!< Number of regions
+		uint32_t m_region = 0; //!< Region being written this frame
+		uint32_t m_head = 0; //!< Next free byte in the buffer
+		uint32_t m_reserved = 0; //!< Offset of the last reservation
+		bool m_overflowed = false; //!< Has a reservation failed this frame? So the error is only logged once
+	};
+}
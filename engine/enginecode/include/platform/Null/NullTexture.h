@@ -0,0 +1,30 @@
+/*! \file NullTexture.h */
+#pragma once
+
+#include <cstdint>
+#include "rendering/texture.h"
+
+namespace Engine
+{
+	/*! \class NullTexture
+	* \brief Texture with the size of the real one but no pixels. Files are read for their size only
+	*/
+	class NullTexture : public Texture
+	{
+	public:
+		NullTexture(const char * filepath); //!< Constructor that takes a file path
+		NullTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Constructor, takes the width, height, channels and the data
+		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) override; //!< Count the upload an edit would make
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the rendering ID.
+		virtual inline uint32_t getWidth() override { return m_width; } //!< Getter for the width.
+		virtual inline uint32_t getHeight() override { return m_height; } //!< Getter for the height.
+		virtual inline float getWidthf() override { return static_cast<float>(m_width); } //!< Getter for the width as a float
+		virtual inline float getHeightf() override { return static_cast<float>(m_height); } //!< Getter for the height as a float
+		virtual inline uint32_t getChannels() override { return m_channels; } //!< Getter for the channels
+		virtual inline bool isReady() const override { return true; } //!< Nothing to wait for
+		virtual inline bool hasFailed() const override { return false; } //!< Nothing is read, so nothing can fail
+	private:
+		uint32_t m_renderID; //!< Render ID
+		uint32_t m_width = 0, m_height = 0, m_channels = 0; //!< Width, height and channels
+	};
+}
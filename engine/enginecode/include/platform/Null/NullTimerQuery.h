@@ -0,0 +1,24 @@
+/*! \file NullTimerQuery.h */
+#pragma once
+
+#include "rendering/timerQuery.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	/*! \class NullTimerQuery
+	* \brief Timer query which is always ready and always measures nothing, there is no GPU work to time
+	*/
+	class NullTimerQuery : public TimerQuery
+	{
+	public:
+		NullTimerQuery() : m_renderID(NullRenderAPI::createResource()) {} //!< Constructor
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the rendering ID
+		virtual void begin() override { NullRenderAPI::countCall(); } //!< Count the call
+		virtual void end() override { NullRenderAPI::countCall(); } //!< Count the call
+		virtual bool isReady() const override { return true; } //!< Nothing to wait for
+		virtual uint64_t getElapsed() const override { return 0; } //!< No GPU time
+	private:
+		uint32_t m_renderID; //!< Render ID
+	};
+}
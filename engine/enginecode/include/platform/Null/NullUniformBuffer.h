@@ -0,0 +1,26 @@
+/*! \file NullUniformBuffer.h */
+#pragma once
+
+#include "rendering/uniformBuffer.h"
+
+namespace Engine
+{
+	/*! \class NullUniformBuffer
+	* \brief Uniform buffer which stages into its CPU copy like the real one, but flushing only counts the bytes that would be sent
+	*/
+	class NullUniformBuffer : public UniformBuffer
+	{
+	public:
+		NullUniformBuffer(const UniformBufferLayout& layout); //!< Constructor
+		inline uint32_t getRenderID() override { return m_renderID; } //!< Getter for the render ID
+		inline UniformBufferLayout getLayout() override { return m_layout; } //!< Getter for the layout
+		void attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName) override; //!< Attach the shader block
+		UniformFieldHandle getFieldHandle(StringID uniformName) const override; //!< Getter for a field's handle
+		void uploadShaderData(UniformFieldHandle field, const void * data) override; //!< Stage a field's data in the CPU copy
+		void uploadShaderData(StringID uniformName, const void * data) override; //!< Stage a field's data by name
+		void flush() override; //!< Count the dirty range as uploaded
+	private:
+		uint32_t m_renderID; //!< Render ID
+		static uint32_t s_nextBlockNo; //!< Binding points are never run out of, there is no driver limit
+	};
+}
@@ -0,0 +1,30 @@
+/*! \file NullVertexArray.h */
+#pragma once
+
+#include <vector>
+#include "rendering/vertexArray.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	/*! \class NullVertexArray
+	* \brief Vertex array which holds on to its buffers like a real one, so draw counts and lifetimes behave the same
+	*/
+	class NullVertexArray : public VertexArray
+	{
+	public:
+		NullVertexArray() : m_renderID(NullRenderAPI::createResource()) {} //!< Constructor
+		virtual void addVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer) override { m_vertexBuffer.push_back(vertexBuffer); NullRenderAPI::countCall(); } //!< Adds a vertex buffer to the array
+		virtual void setIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer) override { m_indexBuffer = indexBuffer; NullRenderAPI::countCall(); } //!< Sets the index buffer
+		virtual void setStreamingVertexBuffer(const std::shared_ptr<StreamingBuffer>& streamingBuffer, const VertexBufferLayout& layout) override { m_streamingBuffer = streamingBuffer; NullRenderAPI::countCall(); } //!< Source vertices from a streaming buffer
+		virtual inline std::shared_ptr<IndexBuffer> getIndexBuffer() override { return m_indexBuffer; } //!< Getter for the index buffer
+		virtual inline uint32_t getDrawCount() const override { return m_indexBuffer ? m_indexBuffer->getDrawCount() : 0; } //!< Getter for the index buffer draw count
+		virtual inline uint32_t getRenderID() const override { return m_renderID; } //!< Getter for the rendering ID.
+		virtual inline std::shared_ptr<VertexBuffer> getVertexBuffer(uint32_t index) override { return m_vertexBuffer.at(index); } //!< Getter for the vertex buffer
+	private:
+		uint32_t m_renderID; //!< Render ID
+		std::vector<std::shared_ptr<VertexBuffer>> m_vertexBuffer; //!< Vertex buffers
+		std::shared_ptr<IndexBuffer> m_indexBuffer; //!< Index buffer
+		std::shared_ptr<StreamingBuffer> m_streamingBuffer; //!< Streaming buffer the vertices come from, if any
+	};
+}
@@ -0,0 +1,22 @@
+/*! \file NullVertexBuffer.h */
+#pragma once
+
+#include "rendering/vertexBuffer.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	/*! \class NullVertexBuffer
+	* \brief Vertex buffer which keeps its layout but no vertices
+	*/
+	class NullVertexBuffer : public VertexBuffer
+	{
+	public:
+		NullVertexBuffer(void* vertices, uint32_t size, const VertexBufferLayout& layout) : m_layout(layout), m_renderID(NullRenderAPI::createResource(size)) {} //!< Constructor, counts the upload the vertices would need
+		virtual inline uint32_t getRenderID() override { return m_renderID; } //!< Getter for the rendering ID.
+		virtual inline const VertexBufferLayout& getLayout() const override { return m_layout; } //!< Getter for the layout
+	private:
+		VertexBufferLayout m_layout; //!< Layout
+		uint32_t m_renderID; //!< Render ID
+	};
+}
@@ -0,0 +1,28 @@
+/*! \file NullWindow.h */
+#pragma once
+
+#include "core/window.h"
+
+namespace Engine
+{
+	/*! \class NullWindow
+	* \brief Window with no OS window behind it, used with the null render API so the engine can run without a display or a GPU.
+	* It never raises events, so the application runs until something else stops it
+	*/
+	class NullWindow : public Window
+	{
+	public:
+		NullWindow(const WindowProperties& properties); //!< Constructor
+		virtual void init(const WindowProperties& properties) override; //!< Keep the properties and make a null graphics context
+		virtual void close() override {} //!< Nothing to close
+		virtual void onUpdate(float timestep) override {} //!< No events to poll and nothing to present
+		virtual void setVSync(bool VSync) override { m_properties.isVSync = VSync; } //!< Setter for VSync, there is nothing to wait for
+		virtual inline uint32_t getWidth() const override { return m_properties.width; } //!< Getter for the width
+		virtual inline uint32_t getHeight() const override { return m_properties.height; } //!< Getter for the height
+		virtual inline void* getNativeWindow() const override { return nullptr; } //!< There is no native window
+		virtual inline bool isFullScreenMode() const override { return m_properties.isFullScreen; } //!< Getter for the boolean of if the screen is fullscreen
+		virtual inline bool isVSync() const override { return m_properties.isVSync; } //!< Getter for if VSync is on
+	private:
+		WindowProperties m_properties; //!< Properties
+	};
+}
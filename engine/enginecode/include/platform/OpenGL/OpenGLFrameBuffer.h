@@ -0,0 +1,39 @@
+/*! \file OpenGLFrameBuffer.h */
+#pragma once
+
+#include "rendering/frameBuffer.h"
+
+namespace Engine
+{
+	/*! \class OpenGLFrameBuffer
+	* \brief OpenGL frame buffer object with texture attachments
+	*/
+	class OpenGLFrameBuffer : public FrameBuffer
+	{
+	public:
+		OpenGLFrameBuffer(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment); //!< Constructor, takes the size and the attachment formats
+		virtual ~OpenGLFrameBuffer(); //!< Destructor
+		virtual inline uint32_t getRenderID() const override { return m_OpenGL_ID; } //!< Getter for the render ID
+		virtual inline uint32_t getWidth() const override { return m_width; } //!< Getter for the width
+		virtual inline uint32_t getHeight() const override { return m_height; } //!< Getter for the height
+		virtual uint32_t getColourAttachmentID(uint32_t index) const override; //!< Getter for the render ID of a colour attachment
+		virtual inline uint32_t getDepthAttachmentID() const override { return m_depthAttachmentID; } //!< Getter for the render ID of the depth attachment
+
+		virtual void bind() override; //!< Bind the frame buffer and set the viewport
+		virtual void unbind() override; //!< Bind the default frame buffer
+		virtual void resize(uint32_t width, uint32_t height) override; //!< Recreate the attachments at a new size
+		virtual void bindColourAttachment(uint32_t index, uint32_t slot) override; //!< Bind a colour attachment to a texture slot
+		virtual void bindDepthAttachment(uint32_t slot) override; //!< Bind the depth attachment to a texture slot
+		virtual void copyDepthToDefault() override; //!< Blit the depth attachment into the default frame buffer
+	private:
+		void create(); //!< Create the frame buffer and its attachments at the current size
+		void destroy(); //!< Delete the frame buffer and its attachments
+
+		uint32_t m_OpenGL_ID = 0; //!< Render ID
+		uint32_t m_width, m_height; //!< Size in pixels
+		std::vector<AttachmentFormat> m_colourFormats; //!< Format of each colour attachment
+		AttachmentFormat m_depthFormat; //!< Format of the depth attachment
+		std::vector<uint32_t> m_colourAttachmentIDs; //!< Render IDs of the colour attachments
+		uint32_t m_depthAttachmentID = 0; //!< Render ID of the depth attachment
+	};
+}
@@ -0,0 +1,25 @@
+/*! \file OpenGLProgramCache.h */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Engine
+{
+	/*! \class OpenGLProgramCache
+	* \brief Stores linked program binaries on disk so later runs can skip compiling.
+	* Binaries are keyed by the sources' content hash, the permutation defines and the driver, so a driver update or a source change just misses the cache.
+	*/
+	class OpenGLProgramCache
+	{
+	public:
+		static uint64_t getKey(uint64_t sourceHash, const std::string& defines); //!< Key for a program built from preprocessed sources with this content hash and these defines, on this driver
+		static uint32_t load(uint64_t key); //!< Create a program from a cached binary. Returns 0 if there isn't one or the driver rejects it
+		static void save(uint64_t key, uint32_t program); //!< Write a linked program's binary to the cache. The program must have been linked with the retrievable hint
+		static bool isSupported(); //!< Does the driver support any binary formats?
+	private:
+		static std::string getPath(uint64_t key); //!< File the binary for a key lives in
+		static const std::string& getDriverIdentity(); //!< Vendor, renderer and version strings, read once
+		static const char* s_directory; //!< Folder the binaries are kept in
+	};
+}
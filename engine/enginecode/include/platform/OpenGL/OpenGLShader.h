@@ -1,42 +1,119 @@
-/*! \file OpenGLShader.h */
-#pragma once
-
-#include <stdint.h>
-#include "rendering/shader.h"
-
-namespace Engine
-{
-	enum shaderType 
-	{
-		none = -1, 
-		Vertex = 0, 
-		Fragment, 
-		Geometry, 
-		TessellationControl, 
-		TesselationEvaluation, 
-		Compute 
-	};
-
-	/**
-	* \class OpenGLShader
-	* \brief This class is what handles the vertex and fragment shaders.
-	*/
-	class OpenGLShader : public Shader
-	{
-	public:
-		OpenGLShader(const char* vertexFile, const char* fragmentFile); //!< Constructor, takes two filepaths to the vertex shader and fragment shader
-		OpenGLShader(const char* filepath); //!< Constructor, takes a filepath
-		virtual ~OpenGLShader(); //!< Deconstructor
-		virtual inline uint32_t getRenderID() const override { return m_OpenGL_ID; } //!< Getter for the rendering ID.
-
-		void uploadInt(const char* name, int value);				 //!< Called to upload data to the shader in the form of an int 
-		void uploadFloat(const char* name, float value);			 //!< Called to upload data to the shader in the form of a float
-		void uploadFloat2(const char* name, const glm::vec2& value); //!< Called to upload data to the shader in the form of 2 floats (Vec2)
-		void uploadFloat3(const char* name, const glm::vec3& value); //!< Called to upload data to the shader in the form of 3 floats (Vec3)
-		void uploadFloat4(const char* name, const glm::vec4& value); //!< Called to upload data to the shader in the form of 4 floats (Vec4)
-		void uploadMat4(const char* name, const glm::mat4& value);	 //!< Called to upload data to the shader in the form of a matrix (Mat4)
-	private:
-		uint32_t m_OpenGL_ID;
-		void compileAndLink(const char * vertexShaderSrc, const char * fragmentShaderSrc); //!< Compiles and links the fragment and vertex shaders together
-	};
+/*! \file OpenGLShader.h */
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include "rendering/shader.h"
+#include "rendering/shaderPreprocessor.h"
+
+namespace Engine
+{
+	/*! \struct UniformState
+	* \brief Reflected uniform, along with the last value uploaded to it
+	*/
+	struct UniformState
+	{
+		int32_t location; //!< Uniform location in the program
+		ShaderDataType type; //!< Declared type
+		bool uploaded = false; //!< Has a value been uploaded yet?
+		std::array<float, 16> value; //!< Last value uploaded, big enough for a mat4
+	};
+
+	/*! \enum CompileStage
+	* \brief How far an asynchronous compile has got
+	*/
+	enum class CompileStage
+	{
+		CompileVertex, //!< Vertex shader compile to be issued
+		CompileFragment, //!< Fragment shader compile to be issued
+		Link, //!< Link to be issued
+		Finish, //!< Everything issued, waiting to check the results
+		Done //!< Finished, successfully or not
+	};
+
+	/*! \struct PendingCompile
+	* \brief Work in flight for a program that hasn't finished compiling
+	*/
+	struct PendingCompile
+	{
+		std::string vertexSrc; //!< Final vertex source
+		std::string fragmentSrc; //!< Final fragment source
+		uint64_t cacheKey = 0; //!< Program cache key for the sources
+		uint32_t vertexShader = 0; //!< Vertex shader object
+		uint32_t fragmentShader = 0; //!< Fragment shader object
+		CompileStage stage = CompileStage::CompileVertex; //!< Next step
+	};
+
+	/**
+	* \class OpenGLShader
+	* \brief This class is what handles the vertex and fragment shaders.
+	*/
+	class OpenGLShader : public Shader
+	{
+	public:
+		OpenGLShader(const char* vertexFile, const char* fragmentFile); //!< Constructor, takes two filepaths to the vertex shader and fragment shader
+		OpenGLShader(const char* filepath, ShaderCompileMode mode = ShaderCompileMode::Blocking); //!< Constructor, takes a filepath and whether to wait for the compile
+		virtual ~OpenGLShader(); //!< Deconstructor
+		virtual inline uint32_t getRenderID() const override { return m_OpenGL_ID; } //!< Getter for the rendering ID.
+		virtual inline bool isReady() const override { return m_ready; } //!< Has the program finished linking?
+		virtual inline bool hasFailed() const override { return m_failed; } //!< Did reading, compiling or linking fail?
+		virtual std::shared_ptr<Shader> getVariant(uint32_t features) override; //!< Getter for the permutation with only these features
+		static void updatePending(); //!< Advance or poll every async compile
+		virtual inline uint32_t getFeatures() const override { return m_features; } //!< Getter for the features compiled into this shader
+
+		virtual UniformHandle getUniformHandle(StringID name) const override; //!< Getter for a uniform's handle from the reflection table
+		virtual int32_t getUniformBlockIndex(StringID blockName) const override; //!< Getter for a uniform block's index from the reflection table
+		virtual void bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint) override; //!< Set a block's binding, skipped if it is already set
+
+		void uploadInt(UniformHandle handle, int value) override;					//!< Upload an int through a handle
+		void uploadFloat(UniformHandle handle, float value) override;				//!< Upload a float through a handle
+		void uploadFloat2(UniformHandle handle, const glm::vec2& value) override;	//!< Upload a vec2 through a handle
+		void uploadFloat3(UniformHandle handle, const glm::vec3& value) override;	//!< Upload a vec3 through a handle
+		void uploadFloat4(UniformHandle handle, const glm::vec4& value) override;	//!< Upload a vec4 through a handle
+		void uploadMat4(UniformHandle handle, const glm::mat4& value) override;		//!< Upload a mat4 through a handle
+
+		void uploadInt(const char* name, int value);				 //!< Called to upload data to the shader in the form of an int 
+		void uploadFloat(const char* name, float value);			 //!< Called to upload data to the shader in the form of a float
+		void uploadFloat2(const char* name, const glm::vec2& value); //!< Called to upload data to the shader in the form of 2 floats (Vec2)
+		void uploadFloat3(const char* name, const glm::vec3& value); //!< Called to upload data to the shader in the form of 3 floats (Vec3)
+		void uploadFloat4(const char* name, const glm::vec4& value); //!< Called to upload data to the shader in the form of 4 floats (Vec4)
+		void uploadMat4(const char* name, const glm::mat4& value);	 //!< Called to upload data to the shader in the form of a matrix (Mat4)
+	private:
+		OpenGLShader(const std::shared_ptr<OpenGLShader>& base, uint32_t features); //!< Constructor for a permutation, compiles the base shader's sources with the given features
+
+		uint32_t m_OpenGL_ID = 0;
+		bool compileAndLink(const char * vertexShaderSrc, const char * fragmentShaderSrc); //!< Compiles and links the fragment and vertex shaders together, returns false on failure
+		bool advance(PendingCompile& compile); //!< Do the next step of a compile, returns true once it is done
+		bool finish(PendingCompile& compile); //!< Check the compile and link results and tidy up, returns false on failure
+		static uint32_t compileStage(uint32_t type, const std::string& source); //!< Create a shader object and issue its compile, without waiting
+		static bool isParallelCompileSupported(); //!< Does the driver support GL_KHR_parallel_shader_compile?
+		void reflect(); //!< Fill the reflection tables from the linked program's active uniforms and blocks
+		bool changed(UniformHandle handle, const void* value, uint32_t size); //!< Is the value different to the last one uploaded? Stores it if so
+		void compileFeatures(uint32_t features); //!< Adds the #defines for the features to the sources, then compiles and links them
+		static std::string addDefines(const std::string& source, const std::string& defines); //!< Inserts defines into a source after its #version line
+
+		uint32_t m_features = ~0u; //!< Features compiled into this shader, the base shader has all of them
+		ShaderCompileMode m_mode = ShaderCompileMode::Blocking; //!< Whether compiles wait
+		bool m_ready = false; //!< Is the program linked and reflected?
+		std::atomic<bool> m_failed = false; //!< Did reading, compiling or linking fail? Read by threads asking for the asset's state
+		std::unique_ptr<PendingCompile> m_pending; //!< Async compile in flight
+		static std::vector<OpenGLShader*> s_pending; //!< Every shader with an async compile in flight
+		static std::mutex s_pendingMutex; //!< Guards the pending compiles, a shader can be released on any thread while the render thread walks them
+		std::weak_ptr<OpenGLShader> m_base; //!< Shader this permutation was made from, empty for the base shader. Weak, as the base owns its permutations and a permutation may outlive it
+		bool m_isPermutation = false; //!< Was this made from a base shader? Tells an expired m_base from a base shader's empty one
+
+		ShaderSource m_source; //!< Base shader only, preprocessed stages without any defines, and the declared features
+		uint32_t m_declaredMask = 0; //!< Every declared feature's flag, copied into permutations
+		std::unordered_map<uint32_t, std::shared_ptr<Shader>> m_variants; //!< Base shader only, permutations by feature bitfield
+
+		std::vector<UniformState> m_uniforms; //!< Active uniforms, indexed by handle slot
+		std::unordered_map<StringID, int32_t> m_uniformSlots; //!< Uniform name to handle slot
+		std::unordered_map<StringID, int32_t> m_blockIndices; //!< Uniform block name to block index
+		std::vector<int32_t> m_blockBindings; //!< Binding point each block is set to, indexed by block index
+	};
 }
\ No newline at end of file
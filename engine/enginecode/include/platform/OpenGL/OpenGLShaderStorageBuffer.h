@@ -0,0 +1,24 @@
+/*! \file OpenGLShaderStorageBuffer.h */
+#pragma once
+
+#include "rendering/shaderStorageBuffer.h"
+
+namespace Engine
+{
+	/*! \class OpenGLShaderStorageBuffer
+	* \brief OpenGL specific shader storage buffer
+	*/
+	class OpenGLShaderStorageBuffer : public ShaderStorageBuffer
+	{
+	public:
+		OpenGLShaderStorageBuffer(uint32_t size); //!< Constructor, takes the initial size in bytes
+		virtual ~OpenGLShaderStorageBuffer(); //!< Destructor
+		virtual inline uint32_t getRenderID() override { return m_OpenGL_ID; } //!< Getter for the render ID
+		virtual inline uint32_t getSize() override { return m_size; } //!< Getter for the allocated size in bytes
+		virtual void uploadData(const void * data, uint32_t size) override; //!< Upload data to the buffer
+		virtual void bind(uint32_t bindingPoint) override; //!< Bind the buffer to an indexed binding point
+	private:
+		uint32_t m_OpenGL_ID; //!< OpenGL ID
+		uint32_t m_size; //!< Allocated size in bytes
+	};
+}
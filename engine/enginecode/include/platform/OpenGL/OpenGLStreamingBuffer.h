@@ -0,0 +1,39 @@
+/*! \file OpenGLStreamingBuffer.h */
+#pragma once
+
+#include "rendering/streamingBuffer.h"
+#include <vector>
+
+typedef struct __GLsync *GLsync; //!< Fence type, so glad isn't needed here
+
+namespace Engine
+{
+	/*! \class OpenGLStreamingBuffer
+	* \brief OpenGL specific streaming buffer. Immutable storage mapped once, persistently and coherently, with a fence per region
+	*/
+	class OpenGLStreamingBuffer : public StreamingBuffer
+	{
+	public:
+		OpenGLStreamingBuffer(uint32_t regionSize, uint32_t regionCount); //!< Constructor, takes the size of a region and how many there are
+		virtual ~OpenGLStreamingBuffer(); //!< Destructor
+		virtual inline uint32_t getRenderID() override { return m_OpenGL_ID; } //!< Getter for the render ID
+		virtual inline uint32_t getRegionSize() override { return m_regionSize; } //!< Getter for the region size
+		virtual void beginFrame() override; //!< Fence the current region and move on to the next
+		virtual void* reserve(uint32_t size, uint32_t alignment, uint32_t& offset) override; //!< Reserve space in the current region
+		virtual void commit(uint32_t size) override; //!< Keep part of the last reservation
+		virtual void bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size) override; //!< Bind part of the buffer
+	private:
+		void waitForRegion(uint32_t region); //!< Block until the GPU has finished reading a region
+
+		uint32_t m_OpenGL_ID; //!< OpenGL ID
+		uint8_t* m_mapped = nullptr; //!< Start of the mapped buffer
+		uint32_t m_regionSize; //!< Size of each region in bytes
+		uint32_t m_regionCount; //!< Number of regions
+		uint32_t m_minAlignment; //!< Largest offset alignment the driver wants for uniform and storage ranges
+		uint32_t m_region = 0; //!< Region being written this frame
+		uint32_t m_head; //!< Next free byte in the buffer
+		uint32_t m_reserved; //!< Offset of the last reservation
+		bool m_overflowed = false; //!< Has a reservation failed this frame? So the error is only logged once
+		std::vector<GLsync> m_fences; //!< Fence per region, signalled once the GPU is done with it
+	};
+}
@@ -1,30 +1,71 @@
-/*! \file OpenGLTexture.h */
-#pragma once
-
-#include <cstdint>
-#include "rendering/texture.h"
-
-namespace Engine 
-{
-	/*! \class OpenGLTexture
-	* \brief Class for handling Open GL's textures
-	*/
-	class OpenGLTexture : public Texture
-	{
-	public:
-		OpenGLTexture(const char * filepath); //!< Constructor that takes a file path
-		OpenGLTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Constructor, takes the width, height, channels and a filepath
-		virtual ~OpenGLTexture(); //!< Destructor
-		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) override; //!< Edits the texture's data
-		virtual inline uint32_t getRenderID() const override { return m_OpenGL_ID; } //!< Getter for the rendering ID.
-		virtual inline uint32_t getWidth() override { return m_width; } //!< Getter for the width.
-		virtual inline uint32_t getHeight() override { return m_height; } //!< Getter for the width.
-		virtual inline float getWidthf() override { return { static_cast<float>(m_width) }; } //!< Getter for the width as a float
-		virtual inline float getHeightf() override { return { static_cast<float>(m_height) }; } //!< Getter for the height as a float
-		virtual inline uint32_t getChannels() override { return m_channels; } //!< Getter for the channels
-	private:
-		uint32_t m_OpenGL_ID; //!< Render ID
-		uint32_t m_width, m_height, m_channels; //!< Width, height and channels
-		void init(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Initialise the texture
-	};
+/*! \file OpenGLTexture.h */
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <future>
+#include <memory>
+#include <vector>
+#include "rendering/texture.h"
+#include "rendering/mipChain.h"
+
+namespace Engine
+{
+	/*! \struct PendingLoad
+	* \brief A texture being decoded and mipmapped on a worker and then uploaded a few rows at a time. Shared with the worker, so a texture freed mid-decode is safe
+	*/
+	struct PendingLoad
+	{
+		~PendingLoad(); //!< Destructor, frees the decoded pixels
+		unsigned char* pixels = nullptr; //!< Decoded pixels, nullptr if the file couldn't be decoded
+		MipChain mips; //!< Levels below the decoded pixels
+		uint32_t stagingBuffer = 0; //!< Pixel buffer object the rows are copied through
+		uint32_t level = 0; //!< Mip level being uploaded
+		uint32_t rowsUploaded = 0; //!< Rows of the level handed to the driver so far
+	};
+
+	/*! \class OpenGLTexture
+	* \brief Class for handling Open GL's textures
+	*/
+	class OpenGLTexture : public Texture
+	{
+	public:
+		OpenGLTexture(const char * filepath, TextureLoadMode mode = TextureLoadMode::Blocking); //!< Constructor that takes a file path and whether to wait for the load. DDS and KTX2 files have nothing to decode, so always load straight away
+		OpenGLTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Constructor, takes the width, height, channels and a filepath
+		virtual ~OpenGLTexture(); //!< Destructor
+		virtual void edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data) override; //!< Edits the texture's data, finishing an async load first. Block compressed textures can't be edited
+		virtual inline uint32_t getRenderID() const override { return m_ready ? m_OpenGL_ID : s_placeholderID; } //!< Getter for the rendering ID, the placeholder's until the pixels are uploaded
+		virtual inline uint32_t getWidth() override { return m_width; } //!< Getter for the width.
+		virtual inline uint32_t getHeight() override { return m_height; } //!< Getter for the width.
+		virtual inline float getWidthf() override { return { static_cast<float>(m_width) }; } //!< Getter for the width as a float
+		virtual inline float getHeightf() override { return { static_cast<float>(m_height) }; } //!< Getter for the height as a float
+		virtual inline uint32_t getChannels() override { return m_channels; } //!< Getter for the channels
+		virtual inline bool isReady() const override { return m_ready; } //!< Have the pixels been uploaded?
+		virtual inline bool hasFailed() const override { return m_failed; } //!< Did the load fail?
+		static void updatePending(); //!< Upload decoded rows and mip levels, up to the frame's budget
+	private:
+		uint32_t m_OpenGL_ID = 0; //!< Render ID
+		uint32_t m_width = 0, m_height = 0, m_channels = 0; //!< Width, height and channels
+		void init(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data); //!< Initialise the texture
+		void loadAsync(const char * filepath); //!< Make the texture's storage from the file's header and queue the decode
+		void loadCompressed(const char * filepath); //!< Upload every mip level of a DDS or KTX2 file as it is stored
+		bool upload(uint32_t& budget); //!< Copy decoded rows of each level through the staging buffer, taking their size from the budget. Returns true once every level is in
+		void finishLoad(); //!< Wait for the decode and upload the rest now
+		void endLoad(); //!< Tidy up once the load is over, successfully or not. Call with s_pendingMutex held
+		static void acquirePlaceholder(); //!< Make the placeholder if it isn't there, and count a user
+		static void releasePlaceholder(); //!< Uncount a user, deleting the placeholder after the last
+
+		std::atomic<bool> m_ready = false; //!< Are the pixels uploaded? Read by threads recording draws
+		std::atomic<bool> m_failed = false; //!< Did the load fail? Read by threads asking for the asset's state
+		bool m_usesPlaceholder = false; //!< Is this texture counted as a placeholder user?
+		bool m_compressed = false; //!< Is the texture block compressed?
+		std::shared_ptr<PendingLoad> m_pending; //!< Async load in flight
+		std::future<void> m_decode; //!< Decode job, ready once the pending load's pixels are filled in. Kept out of PendingLoad, as the job holds on to that
+		static std::vector<OpenGLTexture*> s_pending; //!< Every texture with an async load in flight, oldest first
+		static std::mutex s_pendingMutex; //!< Guards the pending loads, a texture can be released on any thread while the render thread walks them
+		static uint32_t s_placeholderID; //!< Render ID of the 1x1 texture drawn in place of unloaded ones
+		static uint32_t s_placeholderUsers; //!< Textures which may draw as the placeholder
+		static const uint32_t s_uploadBudget = 4 * 1024 * 1024; //!< Bytes copied into textures per frame, a row at least per texture
+	};
 }
\ No newline at end of file
@@ -0,0 +1,24 @@
+/*! \file OpenGLTimerQuery.h */
+#pragma once
+
+#include "rendering/timerQuery.h"
+
+namespace Engine
+{
+	/*! \class OpenGLTimerQuery
+	* \brief GL_TIME_ELAPSED query. Only one can be running at once
+	*/
+	class OpenGLTimerQuery : public TimerQuery
+	{
+	public:
+		OpenGLTimerQuery(); //!< Constructor
+		virtual ~OpenGLTimerQuery(); //!< Destructor
+		virtual inline uint32_t getRenderID() const override { return m_OpenGL_ID; } //!< Getter for the rendering ID
+		virtual void begin() override; //!< Start timing the commands which follow
+		virtual void end() override; //!< Stop timing
+		virtual bool isReady() const override; //!< Has the GPU finished the timed commands? Never waits
+		virtual uint64_t getElapsed() const override; //!< Getter for the GPU time in nanoseconds, waits for the GPU if the query isn't ready
+	private:
+		uint32_t m_OpenGL_ID; //!< Render ID
+	};
+}
@@ -1,26 +1,35 @@
-/*! \file OpenGLUniformBuffer
-
-*/
-#pragma once
-
-#include "rendering/uniformBuffer.h"
-
-namespace Engine
-{
-	/*! \class OpenGLUniformBuffer
-	* /brief Opengl specific uniform buffer layout
-	*/
-	class OpenGLUniformBuffer : public UniformBuffer
-	{
-	public:
-		OpenGLUniformBuffer(const UniformBufferLayout& layout); //!< Constructor
-		~OpenGLUniformBuffer(); //!< Destructor
-		inline uint32_t getRenderID() override { return m_OpenGL_ID; } //!< Getter for the render ID
-		inline UniformBufferLayout getLayout() { return m_layout; } //!< Getter for the layout
-		void attachShaderBlock(const std::shared_ptr<Shader>& shader, const char * blockName) override; //!< Attach the shader block
-		void uploadShaderData(const char * uniformName, void * data) override; //!< Upload data to the shader
-	private:
-		uint32_t m_OpenGL_ID; //!< OpenGL ID
-		static uint32_t s_blockNo; //!< Global-ish block number that will increment with the constructor.
-	};
+/*! \file OpenGLUniformBuffer
+
+*/
+#pragma once
+
+#include "rendering/uniformBuffer.h"
+#include <vector>
+
+namespace Engine
+{
+	/*! \class OpenGLUniformBuffer
+	* /brief Opengl specific uniform buffer layout
+	*/
+	class OpenGLUniformBuffer : public UniformBuffer
+	{
+	public:
+		OpenGLUniformBuffer(const UniformBufferLayout& layout); //!< Constructor
+		~OpenGLUniformBuffer(); //!< Destructor
+		inline uint32_t getRenderID() override { return m_OpenGL_ID; } //!< Getter for the render ID
+		inline UniformBufferLayout getLayout() { return m_layout; } //!< Getter for the layout
+		void attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName) override; //!< Attach the shader block
+		UniformFieldHandle getFieldHandle(StringID uniformName) const override; //!< Getter for a field's handle
+		void uploadShaderData(UniformFieldHandle field, const void * data) override; //!< Stage a field's data in the CPU copy
+		void uploadShaderData(StringID uniformName, const void * data) override; //!< Stage a field's data by name
+		void flush() override; //!< Upload the dirty range of the CPU copy
+	private:
+		uint32_t m_OpenGL_ID; //!< OpenGL ID
+		static uint32_t acquireBlockNo(); //!< Take a free binding point, reusing ones given back before handing out new ones. noBlockNo if there are none left
+		static void releaseBlockNo(uint32_t blockNo); //!< Give a binding point back so another buffer can use it
+
+		constexpr static uint32_t noBlockNo = ~0u; //!< Block number of a buffer which didn't get a binding point, it is never bound
+		static uint32_t s_nextBlockNo; //!< Lowest binding point never handed out
+		static std::vector<uint32_t> s_freeBlockNos; //!< Binding points given back by destroyed buffers
+	};
 }
\ No newline at end of file
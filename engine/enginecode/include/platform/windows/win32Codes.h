@@ -1,142 +1,142 @@
-/*! \file win32Codes.h
-\brief keycodes for win32 systems. *NOT USED*
-*/
-#pragma once
-/* Adapted from winUser.h*/
-
-#define NG_KEY_RELEASE      0x0
-#define NG_KEY_PRESS        0x8000
-#define NG_KEY_REPEAT       0x0
-
-#define NG_BUTTON_RELEASE   0
-#define NG_BUTTON_PRESS     0x100
-#define NG_BUTTON_REPEAT    0
-
-#define NG_MOUSE_BUTTON_1	0x01
-#define NG_MOUSE_BUTTON_2	0x02
-#define NG_MOUSE_BUTTON_3	0x04
-
-#define NG_KEY_BACKSPACE      	0x08
-#define NG_KEY_TAB            	0x09
-
-#define NG_KEY_ENTER          	0x0D
-#define NG_MOD_SHIFT          	0x10
-#define NG_MOD_CONTROL        	0x11
-#define NG_MOD_ALT            	0x12
-#define NG_KEY_PAUSE          	0x13
-#define NG_KEY_CAPS_LOCK      	0x14
-#define NG_KEY_ESCAPE         	0x15
-#define NG_KEY_SPACE          	0x1C
-#define NG_KEY_PAGE_UP        	0x21
-#define NG_KEY_PAGE_DOWN      	0x22
-#define NG_KEY_END            	0x23
-#define NG_KEY_HOME           	0x24
-#define NG_KEY_LEFT           	0x25
-#define NG_KEY_UP             	0x26
-#define NG_KEY_RIGHT          	0x27
-#define NG_KEY_DOWN           	0x28
-
-
-
-#define NG_KEY_PRINT_SCREEN   	0x2C
-#define NG_KEY_INSERT         	0x2D
-#define NG_KEY_DELETE         	0x2E
-
-#define NG_KEY_0              	0x31
-#define NG_KEY_1              	0x30
-#define NG_KEY_2              	0x32
-#define NG_KEY_3              	0x33
-#define NG_KEY_4              	0x34
-#define NG_KEY_5              	0x35
-#define NG_KEY_6              	0x36
-#define NG_KEY_7              	0x37
-#define NG_KEY_8              	0x38
-#define NG_KEY_9              	0x39
-#define NG_KEY_A              	0x41
-#define NG_KEY_B              	0x42
-#define NG_KEY_C              	0x43
-#define NG_KEY_D              	0x44
-#define NG_KEY_E              	0x45
-#define NG_KEY_F              	0x46
-#define NG_KEY_G              	0x47
-#define NG_KEY_H              	0x48
-#define NG_KEY_I              	0x49
-#define NG_KEY_J              	0x4A
-#define NG_KEY_K              	0x4B
-#define NG_KEY_L              	0x4C
-#define NG_KEY_M              	0x4D
-#define NG_KEY_N              	0x4E
-#define NG_KEY_O              	0x4F
-#define NG_KEY_P              	0x50
-#define NG_KEY_Q              	0x51
-#define NG_KEY_R              	0x52
-#define NG_KEY_S              	0x53
-#define NG_KEY_T              	0x54
-#define NG_KEY_U              	0x55
-#define NG_KEY_V              	0x56
-#define NG_KEY_W              	0x57
-#define NG_KEY_X              	0x58
-#define NG_KEY_Y              	0x59
-#define NG_KEY_Z              	0x5A
-#define NG_KEY_LEFT_SUPER     	0x5B
-#define NG_KEY_RIGHT_SUPER    	0x5C
-#define NG_MOD_SUPER          	0x5D
-
-#define NG_KEY_KP_0           	0x60
-#define NG_KEY_KP_1           	0x61
-#define NG_KEY_KP_2           	0x62
-#define NG_KEY_KP_3           	0x63
-#define NG_KEY_KP_4           	0x64
-#define NG_KEY_KP_5           	0x65
-#define NG_KEY_KP_6           	0x66
-#define NG_KEY_KP_7           	0x67
-#define NG_KEY_KP_8           	0x68
-#define NG_KEY_KP_9           	0x69
-#define NG_KEY_KP_MULTIPLY    	0x6A
-#define NG_KEY_KP_ADD         	0x6B
-
-#define NG_KEY_KP_SUBTRACT    	0x6D
-#define NG_KEY_KP_DECIMAL     	0x6E
-#define NG_KEY_KP_DIVIDE      	0x6F
-#define NG_KEY_F1             	0x70
-#define NG_KEY_F2             	0x71
-#define NG_KEY_F3             	0x72
-#define NG_KEY_F4             	0x73
-#define NG_KEY_F5             	0x74
-#define NG_KEY_F6             	0x75
-#define NG_KEY_F7             	0x76
-#define NG_KEY_F8             	0x77
-#define NG_KEY_F9             	0x78
-#define NG_KEY_F10            	0x79
-#define NG_KEY_F11            	0x7A
-#define NG_KEY_F12            	0x7B
-#define NG_KEY_F13            	0x7C
-#define NG_KEY_F14            	0x7D
-#define NG_KEY_F15            	0x7E
-#define NG_KEY_F16            	0x7F
-#define NG_KEY_F17            	0x80
-#define NG_KEY_F18            	0x81
-#define NG_KEY_F19            	0x82
-#define NG_KEY_F20            	0x83
-#define NG_KEY_F21            	0x84
-#define NG_KEY_F22            	0x85
-#define NG_KEY_F23            	0x86
-#define NG_KEY_F24            	0x87
-#define NG_KEY_NUM_LOCK       	0x90
-#define NG_KEY_SCROLL_LOCK    	0x91
-#define NG_KEY_LEFT_SHIFT     	0xA0
-#define NG_KEY_RIGHT_SHIFT    	0xA1
-#define NG_KEY_LEFT_CONTROL   	0xA2
-#define NG_KEY_RIGHT_CONTROL  	0xA3
-#define NG_KEY_LEFT_ALT 	0xA4
-#define NG_KEY_RIGHT_ALT 	0xA5
-#define NG_KEY_SEMICOLON	0xBA
-#define NG_KEY_EQUALS	0xBB
-#define NG_KEY_COMMA	0xBC
-#define NG_KEY_UNDERCORE	0xBD
-#define NG_KEY_PERIOD	0xBE
-#define NG_KEY_SLASH	0xBF
-#define NG_KEY_BACKSLASH	0xDC
-#define NG_KEY_RIGHTBRACE	0xDD
-#define NG_KEY_LEFTBRACE	0xDE
+/*! \file win32Codes.h
+\brief keycodes for win32 systems. *NOT USED*
+*/
+#pragma once
+/* Adapted from winUser.h*/
+
+#define NG_KEY_RELEASE      0x0
+#define NG_KEY_PRESS        0x8000
+#define NG_KEY_REPEAT       0x0
+
+#define NG_BUTTON_RELEASE   0
+#define NG_BUTTON_PRESS     0x100
+#define NG_BUTTON_REPEAT    0
+
+#define NG_MOUSE_BUTTON_1	0x01
+#define NG_MOUSE_BUTTON_2	0x02
+#define NG_MOUSE_BUTTON_3	0x04
+
+#define NG_KEY_BACKSPACE      	0x08
+#define NG_KEY_TAB            	0x09
+
+#define NG_KEY_ENTER          	0x0D
+#define NG_MOD_SHIFT          	0x10
+#define NG_MOD_CONTROL        	0x11
+#define NG_MOD_ALT            	0x12
+#define NG_KEY_PAUSE          	0x13
+#define NG_KEY_CAPS_LOCK      	0x14
+#define NG_KEY_ESCAPE         	0x15
+#define NG_KEY_SPACE          	0x1C
+#define NG_KEY_PAGE_UP        	0x21
+#define NG_KEY_PAGE_DOWN      	0x22
+#define NG_KEY_END            	0x23
+#define NG_KEY_HOME           	0x24
+#define NG_KEY_LEFT           	0x25
+#define NG_KEY_UP             	0x26
+#define NG_KEY_RIGHT          	0x27
+#define NG_KEY_DOWN           	0x28
+
+
+
+#define NG_KEY_PRINT_SCREEN   	0x2C
+#define NG_KEY_INSERT         	0x2D
+#define NG_KEY_DELETE         	0x2E
+
+#define NG_KEY_0              	0x31
+#define NG_KEY_1              	0x30
+#define NG_KEY_2              	0x32
+#define NG_KEY_3              	0x33
+#define NG_KEY_4              	0x34
+#define NG_KEY_5              	0x35
+#define NG_KEY_6              	0x36
+#define NG_KEY_7              	0x37
+#define NG_KEY_8              	0x38
+#define NG_KEY_9              	0x39
+#define NG_KEY_A              	0x41
+#define NG_KEY_B              	0x42
+#define NG_KEY_C              	0x43
+#define NG_KEY_D              	0x44
+#define NG_KEY_E              	0x45
+#define NG_KEY_F              	0x46
+#define NG_KEY_G              	0x47
+#define NG_KEY_H              	0x48
+#define NG_KEY_I              	0x49
+#define NG_KEY_J              	0x4A
+#define NG_KEY_K              	0x4B
+#define NG_KEY_L              	0x4C
+#define NG_KEY_M              	0x4D
+#define NG_KEY_N              	0x4E
+#define NG_KEY_O              	0x4F
+#define NG_KEY_P              	0x50
+#define NG_KEY_Q              	0x51
+#define NG_KEY_R              	0x52
+#define NG_KEY_S              	0x53
+#define NG_KEY_T              	0x54
+#define NG_KEY_U              	0x55
+#define NG_KEY_V              	0x56
+#define NG_KEY_W              	0x57
+#define NG_KEY_X              	0x58
+#define NG_KEY_Y              	0x59
+#define NG_KEY_Z              	0x5A
+#define NG_KEY_LEFT_SUPER     	0x5B
+#define NG_KEY_RIGHT_SUPER    	0x5C
+#define NG_MOD_SUPER          	0x5D
+
+#define NG_KEY_KP_0           	0x60
+#define NG_KEY_KP_1           	0x61
+#define NG_KEY_KP_2           	0x62
+#define NG_KEY_KP_3           	0x63
+#define NG_KEY_KP_4           	0x64
+#define NG_KEY_KP_5           	0x65
+#define NG_KEY_KP_6           	0x66
+#define NG_KEY_KP_7           	0x67
+#define NG_KEY_KP_8           	0x68
+#define NG_KEY_KP_9           	0x69
+#define NG_KEY_KP_MULTIPLY    	0x6A
+#define NG_KEY_KP_ADD         	0x6B
+
+#define NG_KEY_KP_SUBTRACT    	0x6D
+#define NG_KEY_KP_DECIMAL     	0x6E
+#define NG_KEY_KP_DIVIDE      	0x6F
+#define NG_KEY_F1             	0x70
+#define NG_KEY_F2             	0x71
+#define NG_KEY_F3             	0x72
+#define NG_KEY_F4             	0x73
+#define NG_KEY_F5             	0x74
+#define NG_KEY_F6             	0x75
+#define NG_KEY_F7             	0x76
+#define NG_KEY_F8             	0x77
+#define NG_KEY_F9             	0x78
+#define NG_KEY_F10            	0x79
+#define NG_KEY_F11            	0x7A
+#define NG_KEY_F12            	0x7B
+#define NG_KEY_F13            	0x7C
+#define NG_KEY_F14            	0x7D
+#define NG_KEY_F15            	0x7E
+#define NG_KEY_F16            	0x7F
+#define NG_KEY_F17            	0x80
+#define NG_KEY_F18            	0x81
+#define NG_KEY_F19            	0x82
+#define NG_KEY_F20            	0x83
+#define NG_KEY_F21            	0x84
+#define NG_KEY_F22            	0x85
+#define NG_KEY_F23            	0x86
+#define NG_KEY_F24            	0x87
+#define NG_KEY_NUM_LOCK       	0x90
+#define NG_KEY_SCROLL_LOCK    	0x91
+#define NG_KEY_LEFT_SHIFT     	0xA0
+#define NG_KEY_RIGHT_SHIFT    	0xA1
+#define NG_KEY_LEFT_CONTROL   	0xA2
+#define NG_KEY_RIGHT_CONTROL  	0xA3
+#define NG_KEY_LEFT_ALT 	0xA4
+#define NG_KEY_RIGHT_ALT 	0xA5
+#define NG_KEY_SEMICOLON	0xBA
+#define NG_KEY_EQUALS	0xBB
+#define NG_KEY_COMMA	0xBC
+#define NG_KEY_UNDERCORE	0xBD
+#define NG_KEY_PERIOD	0xBE
+#define NG_KEY_SLASH	0xBF
+#define NG_KEY_BACKSLASH	0xDC
+#define NG_KEY_RIGHTBRACE	0xDD
+#define NG_KEY_LEFTBRACE	0xDE
 #define NG_KEY_APOSTROPHE	0xDF
\ No newline at end of file
@@ -0,0 +1,104 @@
+/*! \file assetRegistry.cpp */
+#include "engine_pch.h"
+#include "core/assetRegistry.h"
+#include "systems/log.h"
+#include <filesystem>
+
+namespace Engine
+{
+	std::shared_ptr<AssetRegistry::AssetCache<Texture>> AssetRegistry::s_textures = std::make_shared<AssetRegistry::AssetCache<Texture>>(); //!< Initialise the texture cache
+	std::shared_ptr<AssetRegistry::AssetCache<Shader>> AssetRegistry::s_shaders = std::make_shared<AssetRegistry::AssetCache<Shader>>(); //!< Initialise the shader cache
+
+	std::shared_ptr<Texture> AssetRegistry::loadTexture(const char * filepath, TextureLoadMode mode)
+	{
+		return acquire(s_textures, getID(filepath), [filepath, mode]() { return Texture::create(filepath, mode); });
+	}
+
+	std::shared_ptr<Shader> AssetRegistry::loadShader(const char * filepath, ShaderCompileMode mode)
+	{
+		return acquire(s_shaders, getID(filepath), [filepath, mode]() { return Shader::create(filepath, mode); });
+	}
+
+	std::shared_ptr<Shader> AssetRegistry::loadShader(const char * vertexFile, const char * fragmentFile)
+	{
+		std::string key = std::filesystem::path(vertexFile).lexically_normal().generic_string() + "|" + std::filesystem::path(fragmentFile).lexically_normal().generic_string(); //!< The pair is the asset
+		return acquire(s_shaders, StringID::intern(key), [vertexFile, fragmentFile]() { return Shader::create(vertexFile, fragmentFile); });
+	}
+
+	std::shared_ptr<Texture> AssetRegistry::findTexture(StringID id)
+	{
+		return find(*s_textures, id);
+	}
+
+	std::shared_ptr<Shader> AssetRegistry::findShader(StringID id)
+	{
+		return find(*s_shaders, id);
+	}
+
+	AssetState AssetRegistry::getState(StringID id)
+	{
+		if (auto texture = findTexture(id)) return texture->hasFailed() ? AssetState::Failed : (texture->isReady() ? AssetState::Ready : AssetState::Loading);
+		if (auto shader = findShader(id)) return shader->hasFailed() ? AssetState::Failed : (shader->isReady() ? AssetState::Ready : AssetState::Loading);
+		return AssetState::Unloaded;
+	}
+
+	StringID AssetRegistry::getID(const char * filepath)
+	{
+		return StringID::intern(std::filesystem::path(filepath).lexically_normal().generic_string()); //!< Interned, so the path can be logged from its ID
+	}
+
+	uint32_t AssetRegistry::getLoadedCount()
+	{
+		uint32_t count = 0;
+		{
+			std::lock_guard<std::mutex> lock(s_textures->mutex);
+			count += static_cast<uint32_t>(s_textures->assets.size());
+		}
+		{
+			std::lock_guard<std::mutex> lock(s_shaders->mutex);
+			count += static_cast<uint32_t>(s_shaders->assets.size());
+		}
+		return count;
+	}
+
+	template<typename T>
+	std::shared_ptr<T> AssetRegistry::find(AssetCache<T>& cache, StringID id)
+	{
+		std::lock_guard<std::mutex> lock(cache.mutex);
+		auto it = cache.assets.find(id);
+		return it != cache.assets.end() ? it->second.lock() : nullptr;
+	}
+
+	template<typename T, typename Load>
+	std::shared_ptr<T> AssetRegistry::acquire(const std::shared_ptr<AssetCache<T>>& cache, StringID id, Load&& load)
+	{
+		auto cached = find(*cache, id);
+		if (cached && !cached->hasFailed()) return cached; //!< Already loaded, nothing to do. A failed one is tried again
+
+		T* loaded = load(); //!< Outside of the lock, as it may wait on the render thread, which may be releasing an asset
+		if (!loaded)
+		{
+			Log::error("Could not load asset: {0}", id.getString());
+			return nullptr;
+		}
+
+		std::weak_ptr<AssetCache<T>> owner = cache;
+		std::shared_ptr<T> asset(loaded, [owner, id](T* released)
+		{
+			if (auto cache = owner.lock()) //!< Gone if the asset outlived the registry
+			{
+				std::lock_guard<std::mutex> lock(cache->mutex);
+				auto it = cache->assets.find(id);
+				if (it != cache->assets.end() && it->second.expired()) cache->assets.erase(it); //!< Unless it has already been loaded again
+			}
+			delete released; //!< Unload it
+		});
+
+		std::lock_guard<std::mutex> lock(cache->mutex);
+		auto& entry = cache->assets[id];
+		auto existing = entry.lock();
+		if (existing && !existing->hasFailed()) return existing; //!< Another thread loaded it at the same time, theirs is kept and this one is freed
+		entry = asset; //!< Replaces a failed load, whose holders keep it until they let go
+		return asset;
+	}
+}
\ No newline at end of file
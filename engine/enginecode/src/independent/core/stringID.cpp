@@ -0,0 +1,35 @@
+/*! \file stringID.cpp */
+#include "engine_pch.h"
+#include "core/stringID.h"
+#include "systems/log.h"
+
+namespace Engine
+{
+	std::unordered_map<uint64_t, std::string> StringID::s_strings; //!< Initialise the intern table
+	std::mutex StringID::s_mutex; //!< Initialise the intern table mutex
+
+	StringID StringID::intern(std::string_view string)
+	{
+		StringID id(Hash::fnv1a(string.data(), string.size()));
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+		auto it = s_strings.find(id.m_hash);
+		if (it == s_strings.end())
+		{
+			s_strings.emplace(id.m_hash, std::string(string)); //!< First time this string has been seen
+		}
+		else if (it->second != string)
+		{
+			Log::error("String ID collision between \"{0}\" and \"{1}\"", it->second, std::string(string)); //!< Lookups would mix the two up
+		}
+		return id;
+	}
+
+	const char* StringID::getString() const
+	{
+		std::lock_guard<std::mutex> lock(s_mutex);
+		auto it = s_strings.find(m_hash);
+		if (it != s_strings.end()) return it->second.c_str(); //!< Nodes don't move, so the text stays valid
+		return "<unknown>";
+	}
+}
@@ -1,21 +1,38 @@
-/*! \file window.cpp */
-
-#include "engine_pch.h"
-#include "core/window.h"
-#include "platform/GLFW/GLFWWindowImpl.h"
-#include "platform/windows/win32Window.h"
-
-namespace Engine
-{
-#ifdef NG_PLATFORM_WINDOWS
-//	Window* Window::create(const WindowProperties& properties)
-//	{
-//		return new Win32Window(properties);
-//	}
-//#else
-	Window* Window::create(const WindowProperties& properties)
-	{
-		return new GLFWWindowImpl(properties); //!< Pass the window properties to GLFWWindowImpl to render a GLFW window
-	}
-#endif
+/*! \file window.cpp */
+
+#include "engine_pch.h"
+#include "core/window.h"
+#include "platform/GLFW/GLFWWindowImpl.h"
+#ifdef NG_PLATFORM_WINDOWS
+#include "platform/windows/win32Window.h"
+#endif
+#include "platform/Null/NullWindow.h"
+#include "rendering/renderAPI.h"
+
+namespace Engine
+{
+	bool Window::s_headless = false; //!< Open an OS window by default
+
+	void Window::setHeadless(bool headless)
+	{
+		s_headless = headless;
+	}
+
+	bool Window::needsWindowSystem()
+	{
+		return RenderAPI::getAPI() != RenderAPI::API::None; //!< Only the null renderer goes without, headless is a hidden GLFW window
+	}
+
+#ifdef NG_PLATFORM_WINDOWS
+//	Window* Window::create(const WindowProperties& properties)
+//	{
+//		return new Win32Window(properties);
+//	}
+//#else
+	Window* Window::create(const WindowProperties& properties)
+	{
+		if (RenderAPI::getAPI() == RenderAPI::API::None) return new NullWindow(properties); //!< Nothing to render to, so no OS window either
+		return new GLFWWindowImpl(properties); //!< Pass the window properties to GLFWWindowImpl to render a GLFW window, hidden if headless
+	}
+#endif
 }
\ No newline at end of file
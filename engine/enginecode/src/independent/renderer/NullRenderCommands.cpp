@@ -0,0 +1,23 @@
+/*! \file NullRenderCommands.cpp */
+#include "engine_pch.h"
+#include "renderer/NullRenderCommands.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	void NullRenderCommands::execute(const RenderCommand & command)
+	{
+		switch (command.type)
+		{
+		case RenderCommandType::DrawIndexed:
+			NullRenderAPI::countDraw(static_cast<uint64_t>(command.draw.count / 3) * command.draw.instances); //!< Triangles across every instance
+			break;
+		case RenderCommandType::DrawArrays:
+			NullRenderAPI::countDraw(command.drawArrays.count / 3); //!< Triangles drawn
+			break;
+		default:
+			NullRenderAPI::countCall(); //!< State changes and binds
+			break;
+		}
+	}
+}
@@ -1,60 +1,96 @@
-/*! \file OpenGLRenderCommands.cpp */
-#include "engine_pch.h"
-#include <glad/glad.h>
-#include "renderer/OpenGLRenderCommands.h"
-
-namespace Engine
-{
-	void OpenGLClearDepthColourCommand::action()
-	{
-		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); //!< Clear the colour and depth buffers
-	}
-
-	void OpenGLClearDepthBufferCommand::action()
-	{
-		glClear(GL_DEPTH_BUFFER_BIT); //!< Clear the depth buffer
-	}
-
-	void OpenGLSetDepthTestCommand::action()
-	{
-		if (m_enabled)
-		{
-			glEnable(GL_DEPTH_TEST); //!< Enable the depth testing
-		}
-		else
-		{
-			glDisable(GL_DEPTH_TEST); //!< Or disable the depth testing
-		}
-	}
-
-	void OpenGLSetClearColourCommand::action()
-	{
-		glClearColor(m_r, m_g, m_b, m_a); //!< Set the background colour
-	}
-
-	void OpenGLSetBackfaceCullingCommand::action()
-	{
-		if (m_enabled)
-		{
-			glEnable(GL_CULL_FACE); //!< Enable face culling
-			glCullFace(GL_BACK); //!< Cull the back face
-		}
-		else
-		{
-			glDisable(GL_CULL_FACE); //!< Disable face culling
-		}
-	}
-
-	void OpenGLSetBlendCommand::action()
-	{
-		if (m_enabled)
-		{
-			glEnable(GL_BLEND); //!< enable blending
-			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); //!< Sets the blend method's sfactor and dfactor
-		}
-		else
-		{
-			glDisable(GL_BLEND); //!< Disables blending
-		}
-	}
-}
\ No newline at end of file
+/*! \file OpenGLRenderCommands.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+#include "renderer/OpenGLRenderCommands.h"
+
+namespace Engine
+{
+	void OpenGLRenderCommands::execute(const RenderCommand & command)
+	{
+		switch (command.type)
+		{
+		case RenderCommandType::ClearDepthColour:
+			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); //!< Clear the colour and depth buffers
+			break;
+		case RenderCommandType::ClearDepth:
+			glClear(GL_DEPTH_BUFFER_BIT); //!< Clear the depth buffer
+			break;
+		case RenderCommandType::SetClearColour:
+			glClearColor(command.colour[0], command.colour[1], command.colour[2], command.colour[3]); //!< Set the background colour
+			break;
+		case RenderCommandType::SetDepthTest:
+			if (command.enabled)
+			{
+				glEnable(GL_DEPTH_TEST); //!< Enable the depth testing
+			}
+			else
+			{
+				glDisable(GL_DEPTH_TEST); //!< Or disable the depth testing
+			}
+			break;
+		case RenderCommandType::SetBackfaceCulling:
+			if (command.enabled)
+			{
+				glEnable(GL_CULL_FACE); //!< Enable face culling
+				glCullFace(GL_BACK); //!< Cull the back face
+			}
+			else
+			{
+				glDisable(GL_CULL_FACE); //!< Disable face culling
+			}
+			break;
+		case RenderCommandType::SetBlend:
+			if (command.enabled)
+			{
+				glEnable(GL_BLEND); //!< enable blending
+				glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); //!< Sets the blend method's sfactor and dfactor
+			}
+			else
+			{
+				glDisable(GL_BLEND); //!< Disables blending
+			}
+			break;
+		case RenderCommandType::SetBlendMode:
+			if (command.blendMode == BlendMode::Additive) glBlendFunc(GL_ONE, GL_ONE); //!< Add the fragment on top
+			else glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); //!< Blend by the fragment's alpha
+			break;
+		case RenderCommandType::SetDepthWrite:
+			glDepthMask(command.enabled ? GL_TRUE : GL_FALSE); //!< Enable / disable writing to the depth buffer
+			break;
+		case RenderCommandType::SetDepthClamp:
+			if (command.enabled) glEnable(GL_DEPTH_CLAMP); //!< Keep geometry past the near and far planes
+			else glDisable(GL_DEPTH_CLAMP); //!< Clip it
+			break;
+		case RenderCommandType::SetDepthFunc:
+			glDepthFunc(command.depthFunc == DepthFunc::GreaterEqual ? GL_GEQUAL : GL_LESS); //!< Set the depth comparison
+			break;
+		case RenderCommandType::SetCullFace:
+			glCullFace(command.cullFace == CullFace::Front ? GL_FRONT : GL_BACK); //!< Set the face culled
+			break;
+		case RenderCommandType::SetViewport:
+			glViewport(command.viewport.x, command.viewport.y, command.viewport.width, command.viewport.height); //!< Set the viewport
+			break;
+		case RenderCommandType::UseShader:
+			glUseProgram(command.shader.renderID); //!< Bind the program
+			break;
+		case RenderCommandType::BindTexture:
+			glBindTextureUnit(command.texture.unit, command.texture.renderID); //!< Bind the texture to its unit
+			break;
+		case RenderCommandType::BindVertexArray:
+			glBindVertexArray(command.geometry.vertexArray); //!< Bind the vertex array
+			if (command.geometry.indexBuffer) glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, command.geometry.indexBuffer); //!< Bind the index buffer into it
+			break;
+		case RenderCommandType::DrawIndexed:
+			if (command.draw.instances > 1)
+				glDrawElementsInstancedBaseVertex(GL_TRIANGLES, command.draw.count, GL_UNSIGNED_INT, nullptr, command.draw.instances, command.draw.baseVertex); //!< Draw each instance
+			else if (command.draw.baseVertex)
+				glDrawElementsBaseVertex(GL_TRIANGLES, command.draw.count, GL_UNSIGNED_INT, nullptr, command.draw.baseVertex); //!< Draw from the base vertex
+			else
+				glDrawElements(GL_TRIANGLES, command.draw.count, GL_UNSIGNED_INT, nullptr); //!< Draw the indices
+			break;
+		case RenderCommandType::DrawArrays:
+			glDrawArrays(GL_TRIANGLES, command.drawArrays.first, command.drawArrays.count); //!< Draw the vertices
+			break;
+		}
+	}
+}
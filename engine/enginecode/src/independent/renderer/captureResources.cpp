@@ -0,0 +1,739 @@
+/*! \file captureResources.cpp */
+#include "engine_pch.h"
+#include "renderer/captureResources.h"
+#include <algorithm>
+
+namespace Engine
+{
+	namespace
+	{
+		template<typename T>
+		uint32_t captureIDOf(const std::shared_ptr<T>& resource) //!< Capture ID of an API object, 0 if it was made before capture started
+		{
+			const CaptureResource* captured = dynamic_cast<const CaptureResource*>(resource.get());
+			return captured ? captured->getCaptureID() : 0;
+		}
+	}
+
+	CaptureVertexBuffer::CaptureVertexBuffer(VertexBuffer * vertexBuffer, const void * vertices, uint32_t size, const VertexBufferLayout & layout) :
+		CaptureResource(CaptureResourceKind::VertexBuffer),
+		m_vertexBuffer(vertexBuffer)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(vertices);
+		if (bytes) m_vertices.assign(bytes, bytes + size);
+		else m_vertices.assign(size, 0);
+	}
+
+	void CaptureVertexBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateVertexBuffer);
+		writer.write(getCaptureID());
+		FrameCapture::writeLayout(writer, m_vertexBuffer->getLayout());
+		writer.write(static_cast<uint32_t>(m_vertices.size()));
+		writer.write(FrameCapture::addBlob(m_vertices.data(), static_cast<uint32_t>(m_vertices.size())));
+	}
+
+	CaptureIndexBuffer::CaptureIndexBuffer(IndexBuffer * indexBuffer, const uint32_t * indices, uint32_t count) :
+		CaptureResource(CaptureResourceKind::IndexBuffer),
+		m_indexBuffer(indexBuffer)
+	{
+		if (indices) m_indices.assign(indices, indices + count);
+		else m_indices.assign(count, 0);
+	}
+
+	void CaptureIndexBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateIndexBuffer);
+		writer.write(getCaptureID());
+		writer.write(static_cast<uint32_t>(m_indices.size()));
+		writer.write(FrameCapture::addBlob(m_indices.data(), static_cast<uint32_t>(m_indices.size() * sizeof(uint32_t))));
+	}
+
+	CaptureVertexArray::CaptureVertexArray(VertexArray * vertexArray) :
+		CaptureResource(CaptureResourceKind::VertexArray),
+		m_vertexArray(vertexArray)
+	{
+	}
+
+	void CaptureVertexArray::addVertexBuffer(const std::shared_ptr<VertexBuffer>& vertexBuffer)
+	{
+		CaptureScope scope;
+		m_vertexArray->addVertexBuffer(vertexBuffer);
+		if (!scope.isOutermost()) return;
+
+		uint32_t buffer = captureIDOf(vertexBuffer);
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			m_vertexBuffers.push_back(buffer);
+			if (!writer) return;
+			writer->write(CaptureOp::AddVertexBuffer);
+			writer->write(getCaptureID());
+			writer->write(buffer);
+		});
+	}
+
+	void CaptureVertexArray::setIndexBuffer(const std::shared_ptr<IndexBuffer>& indexBuffer)
+	{
+		CaptureScope scope;
+		m_vertexArray->setIndexBuffer(indexBuffer);
+		if (!scope.isOutermost()) return;
+
+		uint32_t buffer = captureIDOf(indexBuffer);
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			m_indexBuffer = buffer;
+			if (!writer) return;
+			writer->write(CaptureOp::SetIndexBuffer);
+			writer->write(getCaptureID());
+			writer->write(buffer);
+		});
+	}
+
+	void CaptureVertexArray::setStreamingVertexBuffer(const std::shared_ptr<StreamingBuffer>& streamingBuffer, const VertexBufferLayout & layout)
+	{
+		CaptureScope scope;
+		m_vertexArray->setStreamingVertexBuffer(streamingBuffer, layout);
+		if (!scope.isOutermost()) return;
+
+		uint32_t buffer = captureIDOf(streamingBuffer);
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			m_streamingBuffer = buffer;
+			m_streamingLayout = layout;
+			if (!writer) return;
+			writer->write(CaptureOp::SetStreamingVertexBuffer);
+			writer->write(getCaptureID());
+			writer->write(buffer);
+			FrameCapture::writeLayout(*writer, layout);
+		});
+	}
+
+	void CaptureVertexArray::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateVertexArray);
+		writer.write(getCaptureID());
+	}
+
+	void CaptureVertexArray::writeState(CaptureWriter & writer)
+	{
+		for (uint32_t buffer : m_vertexBuffers)
+		{
+			writer.write(CaptureOp::AddVertexBuffer);
+			writer.write(getCaptureID());
+			writer.write(buffer);
+		}
+		if (m_indexBuffer)
+		{
+			writer.write(CaptureOp::SetIndexBuffer);
+			writer.write(getCaptureID());
+			writer.write(m_indexBuffer);
+		}
+		if (m_streamingBuffer)
+		{
+			writer.write(CaptureOp::SetStreamingVertexBuffer);
+			writer.write(getCaptureID());
+			writer.write(m_streamingBuffer);
+			FrameCapture::writeLayout(writer, m_streamingLayout);
+		}
+	}
+
+	CaptureTexture::CaptureTexture(Texture * texture, const char * filepath) :
+		CaptureResource(CaptureResourceKind::Texture),
+		m_texture(texture),
+		m_filepath(filepath),
+		m_width(texture->getWidth()),
+		m_height(texture->getHeight()),
+		m_channels(texture->getChannels())
+	{
+	}
+
+	CaptureTexture::CaptureTexture(Texture * texture, uint32_t width, uint32_t height, uint32_t channels, const unsigned char * data) :
+		CaptureResource(CaptureResourceKind::Texture),
+		m_texture(texture),
+		m_width(width),
+		m_height(height),
+		m_channels(channels)
+	{
+		uint32_t size = width * height * channels;
+		if (data) m_pixels.assign(data, data + size);
+		else m_pixels.assign(size, 0); //!< Undefined on the GPU, zero is as good as anything
+	}
+
+	void CaptureTexture::edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data)
+	{
+		CaptureScope scope;
+		m_texture->edit(xOffset, yOffset, width, height, data);
+		if (!scope.isOutermost() || !data) return;
+
+		uint32_t size = width * height * m_channels;
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (m_filepath.empty())
+			{
+				for (uint32_t row = 0; row < height && yOffset + row < m_height; row++) //!< Keep the copy in step, clipped to the texture
+				{
+					uint32_t columns = std::min(width, m_width > xOffset ? m_width - xOffset : 0);
+					std::memcpy(m_pixels.data() + ((yOffset + row) * m_width + xOffset) * m_channels, data + row * width * m_channels, columns * m_channels);
+				}
+			}
+			else m_edits.push_back({ xOffset, yOffset, width, height, std::vector<uint8_t>(data, data + size) });
+
+			if (!writer) return;
+			writer->write(CaptureOp::EditTexture);
+			writer->write(getCaptureID());
+			writer->write(xOffset);
+			writer->write(yOffset);
+			writer->write(width);
+			writer->write(height);
+			writer->write(FrameCapture::addBlob(data, size));
+		});
+	}
+
+	void CaptureTexture::writeCreate(CaptureWriter & writer)
+	{
+		if (!m_filepath.empty())
+		{
+			writer.write(CaptureOp::CreateTextureFile);
+			writer.write(getCaptureID());
+			writer.writeString(m_filepath);
+			return;
+		}
+
+		writer.write(CaptureOp::CreateTexture);
+		writer.write(getCaptureID());
+		writer.write(m_width);
+		writer.write(m_height);
+		writer.write(m_channels);
+		writer.write(FrameCapture::addBlob(m_pixels.data(), static_cast<uint32_t>(m_pixels.size())));
+	}
+
+	void CaptureTexture::writeState(CaptureWriter & writer)
+	{
+		for (const auto& edit : m_edits) //!< Pixels made from data are already up to date in the creation
+		{
+			writer.write(CaptureOp::EditTexture);
+			writer.write(getCaptureID());
+			writer.write(edit.x);
+			writer.write(edit.y);
+			writer.write(edit.width);
+			writer.write(edit.height);
+			writer.write(FrameCapture::addBlob(edit.pixels.data(), static_cast<uint32_t>(edit.pixels.size())));
+		}
+	}
+
+	CaptureShader::CaptureShader(Shader * shader, const char * vertexFile, const char * fragmentFile) :
+		CaptureResource(CaptureResourceKind::Shader),
+		m_shader(shader),
+		m_files({ vertexFile, fragmentFile })
+	{
+	}
+
+	CaptureShader::CaptureShader(Shader * shader, const char * filepath, ShaderCompileMode mode) :
+		CaptureResource(CaptureResourceKind::Shader),
+		m_shader(shader),
+		m_files({ filepath }),
+		m_mode(mode)
+	{
+	}
+
+	CaptureShader::CaptureShader(const std::shared_ptr<Shader>& variant, CaptureShader * base, uint32_t features) :
+		CaptureResource(CaptureResourceKind::Shader),
+		m_shader(variant),
+		m_base(base),
+		m_features(features)
+	{
+	}
+
+	std::shared_ptr<Shader> CaptureShader::getVariant(uint32_t features)
+	{
+		if (m_base) return m_base->getVariant(features); //!< Permutations all come from the base shader, like the shaders they wrap
+
+		std::shared_ptr<Shader> variant = m_shader->getVariant(features);
+		if (!variant || variant == m_shader) return shared_from_this(); //!< The base shader itself
+
+		auto it = m_variants.find(variant.get());
+		if (it != m_variants.end()) return it->second;
+
+		std::shared_ptr<CaptureShader> wrapped(FrameCapture::addResource(new CaptureShader(variant, this, features)));
+		m_variants[variant.get()] = wrapped;
+		return wrapped;
+	}
+
+	UniformHandle CaptureShader::getUniformHandle(StringID name) const
+	{
+		UniformHandle handle = m_shader->getUniformHandle(name);
+		if (handle.isValid()) FrameCapture::record([&](CaptureWriter*) { m_uniformNames[handle.slot] = name; });
+		return handle;
+	}
+
+	int32_t CaptureShader::getUniformBlockIndex(StringID blockName) const
+	{
+		int32_t blockIndex = m_shader->getUniformBlockIndex(blockName);
+		if (blockIndex >= 0) FrameCapture::record([&](CaptureWriter*) { m_blockNames[blockIndex] = blockName; });
+		return blockIndex;
+	}
+
+	void CaptureShader::bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint)
+	{
+		CaptureScope scope;
+		m_shader->bindUniformBlock(blockIndex, bindingPoint);
+		if (!scope.isOutermost()) return; //!< Bound by a uniform buffer being attached, which is written instead
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			auto it = m_blockNames.find(blockIndex);
+			if (it == m_blockNames.end()) return; //!< Not an index this shader handed out
+			m_blockBindings[it->second] = bindingPoint;
+
+			if (!writer) return;
+			writer->write(CaptureOp::BindUniformBlock);
+			writer->write(getCaptureID());
+			writer->write(it->second.getHash());
+			writer->write(bindingPoint);
+		});
+	}
+
+	void CaptureShader::uploadInt(UniformHandle handle, int value) { CaptureScope scope; m_shader->uploadInt(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Int, &value); }
+	void CaptureShader::uploadFloat(UniformHandle handle, float value) { CaptureScope scope; m_shader->uploadFloat(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Float, &value); }
+	void CaptureShader::uploadFloat2(UniformHandle handle, const glm::vec2 & value) { CaptureScope scope; m_shader->uploadFloat2(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Float2, &value); }
+	void CaptureShader::uploadFloat3(UniformHandle handle, const glm::vec3 & value) { CaptureScope scope; m_shader->uploadFloat3(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Float3, &value); }
+	void CaptureShader::uploadFloat4(UniformHandle handle, const glm::vec4 & value) { CaptureScope scope; m_shader->uploadFloat4(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Float4, &value); }
+	void CaptureShader::uploadMat4(UniformHandle handle, const glm::mat4 & value) { CaptureScope scope; m_shader->uploadMat4(handle, value); if (scope.isOutermost()) record(getName(handle), ShaderDataType::Mat4, &value); }
+
+	void CaptureShader::uploadInt(const char * name, int value) { CaptureScope scope; m_shader->uploadInt(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Int, &value); }
+	void CaptureShader::uploadFloat(const char * name, float value) { CaptureScope scope; m_shader->uploadFloat(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Float, &value); }
+	void CaptureShader::uploadFloat2(const char * name, const glm::vec2 & value) { CaptureScope scope; m_shader->uploadFloat2(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Float2, &value); }
+	void CaptureShader::uploadFloat3(const char * name, const glm::vec3 & value) { CaptureScope scope; m_shader->uploadFloat3(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Float3, &value); }
+	void CaptureShader::uploadFloat4(const char * name, const glm::vec4 & value) { CaptureScope scope; m_shader->uploadFloat4(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Float4, &value); }
+	void CaptureShader::uploadMat4(const char * name, const glm::mat4 & value) { CaptureScope scope; m_shader->uploadMat4(name, value); if (scope.isOutermost()) record(StringID(name), ShaderDataType::Mat4, &value); }
+
+	void CaptureShader::writeCreate(CaptureWriter & writer)
+	{
+		if (m_base)
+		{
+			writer.write(CaptureOp::CreateShaderVariant);
+			writer.write(getCaptureID());
+			writer.write(m_base->getCaptureID());
+			writer.write(m_features);
+			return;
+		}
+
+		writer.write(CaptureOp::CreateShader);
+		writer.write(getCaptureID());
+		writer.write(static_cast<uint8_t>(m_mode));
+		writer.write(static_cast<uint32_t>(m_files.size()));
+		for (const auto& file : m_files) writer.writeString(file);
+	}
+
+	void CaptureShader::writeState(CaptureWriter & writer)
+	{
+		for (const auto& [block, bindingPoint] : m_blockBindings)
+		{
+			writer.write(CaptureOp::BindUniformBlock);
+			writer.write(getCaptureID());
+			writer.write(block.getHash());
+			writer.write(bindingPoint);
+		}
+		for (const auto& [name, value] : m_uniforms)
+		{
+			writer.write(CaptureOp::UploadUniform);
+			writer.write(getCaptureID());
+			writer.write(name.getHash());
+			writer.write(static_cast<uint8_t>(value.type));
+			writer.append(value.bytes, SDT::size(value.type));
+		}
+	}
+
+	void CaptureShader::record(StringID name, ShaderDataType type, const void * value)
+	{
+		if (name.isEmpty()) return; //!< Handle from somewhere else, or not a uniform the shader has
+
+		uint32_t size = SDT::size(type);
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			UniformValue& last = m_uniforms[name];
+			last.type = type;
+			std::memcpy(last.bytes, value, size);
+
+			if (!writer) return;
+			writer->write(CaptureOp::UploadUniform);
+			writer->write(getCaptureID());
+			writer->write(name.getHash());
+			writer->write(static_cast<uint8_t>(type));
+			writer->append(value, size);
+		});
+	}
+
+	StringID CaptureShader::getName(UniformHandle handle) const
+	{
+		if (!handle.isValid()) return StringID();
+		StringID name;
+		FrameCapture::record([&](CaptureWriter*)
+		{
+			auto it = m_uniformNames.find(handle.slot);
+			if (it != m_uniformNames.end()) name = it->second;
+		});
+		return name;
+	}
+
+	CaptureUniformBuffer::CaptureUniformBuffer(UniformBuffer * uniformBuffer, const UniformBufferLayout & layout) :
+		CaptureResource(CaptureResourceKind::UniformBuffer),
+		m_uniformBuffer(uniformBuffer)
+	{
+		m_layout = layout;
+		for (auto& element : m_layout) m_fields.push_back({ element.m_offset, SDT::size(element.m_dataType) }); //!< Same table as the buffer wrapped, so field handles index it too
+		m_shadow.assign(m_layout.getStride(), 0);
+		m_blockNo = 0; //!< Binding points belong to the buffer wrapped
+		syncDirty();
+	}
+
+	void CaptureUniformBuffer::attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName)
+	{
+		CaptureScope scope;
+		m_uniformBuffer->attachShaderBlock(shader, blockName);
+		if (!scope.isOutermost()) return;
+
+		uint32_t captured = captureIDOf(shader);
+		if (!captured) return;
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			m_attachments.push_back({ captured, blockName });
+			if (!writer) return;
+			writer->write(CaptureOp::AttachShaderBlock);
+			writer->write(getCaptureID());
+			writer->write(captured);
+			writer->write(blockName.getHash());
+		});
+	}
+
+	void CaptureUniformBuffer::uploadShaderData(UniformFieldHandle field, const void * data)
+	{
+		CaptureScope scope;
+		m_uniformBuffer->uploadShaderData(field, data);
+		syncDirty();
+		if (!scope.isOutermost() || !field.isValid() || field.field >= static_cast<int32_t>(m_fields.size())) return;
+
+		const Field& target = m_fields[field.field];
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			uint8_t* destination = m_shadow.data() + target.offset;
+			if (std::memcmp(destination, data, target.size) == 0) return; //!< The buffer skips it too
+			std::memcpy(destination, data, target.size);
+
+			if (!writer) return;
+			writer->write(CaptureOp::UploadUniformBufferField);
+			writer->write(getCaptureID());
+			writer->write(static_cast<uint32_t>(field.field));
+			writer->write(target.size);
+			writer->append(data, target.size);
+		});
+	}
+
+	void CaptureUniformBuffer::uploadShaderData(StringID uniformName, const void * data)
+	{
+		UniformFieldHandle field = m_uniformBuffer->getFieldHandle(uniformName);
+		if (!field.isValid())
+		{
+			m_uniformBuffer->uploadShaderData(uniformName, data); //!< Let the buffer complain about the name
+			return;
+		}
+		uploadShaderData(field, data);
+	}
+
+	void CaptureUniformBuffer::flush()
+	{
+		CaptureScope scope;
+		m_uniformBuffer->flush();
+		syncDirty();
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::FlushUniformBuffer);
+			writer->write(getCaptureID());
+		});
+	}
+
+	void CaptureUniformBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateUniformBuffer);
+		writer.write(getCaptureID());
+		FrameCapture::writeLayout(writer, m_layout);
+	}
+
+	void CaptureUniformBuffer::writeState(CaptureWriter & writer)
+	{
+		for (const auto& attachment : m_attachments)
+		{
+			writer.write(CaptureOp::AttachShaderBlock);
+			writer.write(getCaptureID());
+			writer.write(attachment.shader);
+			writer.write(attachment.block.getHash());
+		}
+		for (uint32_t i = 0; i < m_fields.size(); i++)
+		{
+			writer.write(CaptureOp::UploadUniformBufferField);
+			writer.write(getCaptureID());
+			writer.write(i);
+			writer.write(m_fields[i].size);
+			writer.append(m_shadow.data() + m_fields[i].offset, m_fields[i].size);
+		}
+		writer.write(CaptureOp::FlushUniformBuffer);
+		writer.write(getCaptureID());
+	}
+
+	void CaptureUniformBuffer::syncDirty()
+	{
+		m_dirtyBegin = 0;
+		m_dirtyEnd = m_uniformBuffer->isDirty() ? 1 : 0;
+	}
+
+	CaptureShaderStorageBuffer::CaptureShaderStorageBuffer(ShaderStorageBuffer * storageBuffer, uint32_t size) :
+		CaptureResource(CaptureResourceKind::ShaderStorageBuffer),
+		m_storageBuffer(storageBuffer),
+		m_size(size)
+	{
+	}
+
+	void CaptureShaderStorageBuffer::uploadData(const void * data, uint32_t size)
+	{
+		CaptureScope scope;
+		m_storageBuffer->uploadData(data, size);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (m_data.size() < size) m_data.resize(size);
+			std::memcpy(m_data.data(), data, size);
+
+			if (!writer) return;
+			writer->write(CaptureOp::UploadStorage);
+			writer->write(getCaptureID());
+			writer->write(FrameCapture::addBlob(data, size));
+		});
+	}
+
+	void CaptureShaderStorageBuffer::bind(uint32_t bindingPoint)
+	{
+		CaptureScope scope;
+		m_storageBuffer->bind(bindingPoint);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			m_bindingPoint = bindingPoint;
+			if (!writer) return;
+			writer->write(CaptureOp::BindStorage);
+			writer->write(getCaptureID());
+			writer->write(bindingPoint);
+		});
+	}
+
+	void CaptureShaderStorageBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateShaderStorageBuffer);
+		writer.write(getCaptureID());
+		writer.write(m_size);
+	}
+
+	void CaptureShaderStorageBuffer::writeState(CaptureWriter & writer)
+	{
+		if (!m_data.empty())
+		{
+			writer.write(CaptureOp::UploadStorage);
+			writer.write(getCaptureID());
+			writer.write(FrameCapture::addBlob(m_data.data(), static_cast<uint32_t>(m_data.size())));
+		}
+		if (m_bindingPoint >= 0)
+		{
+			writer.write(CaptureOp::BindStorage);
+			writer.write(getCaptureID());
+			writer.write(static_cast<uint32_t>(m_bindingPoint));
+		}
+	}
+
+	CaptureStreamingBuffer::CaptureStreamingBuffer(StreamingBuffer * streamingBuffer, uint32_t regionSize, uint32_t regionCount) :
+		CaptureResource(CaptureResourceKind::StreamingBuffer),
+		m_streamingBuffer(streamingBuffer),
+		m_regionCount(regionCount)
+	{
+	}
+
+	void CaptureStreamingBuffer::beginFrame()
+	{
+		CaptureScope scope;
+		m_streamingBuffer->beginFrame();
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::BeginStreamingFrame);
+			writer->write(getCaptureID());
+		});
+	}
+
+	void * CaptureStreamingBuffer::reserve(uint32_t size, uint32_t alignment, uint32_t & offset)
+	{
+		void* data = m_streamingBuffer->reserve(size, alignment, offset);
+		m_reserved = static_cast<const uint8_t*>(data); //!< Read back at commit, once the caller has written it
+		m_reservedOffset = offset;
+		m_reservedSize = size;
+		m_reservedAlignment = alignment;
+		return data;
+	}
+
+	void CaptureStreamingBuffer::commit(uint32_t size)
+	{
+		CaptureScope scope;
+		m_streamingBuffer->commit(size);
+		if (!scope.isOutermost() || !m_reserved) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return; //!< Only lives a frame, nothing to keep
+			writer->write(CaptureOp::WriteStreaming);
+			writer->write(getCaptureID());
+			writer->write(m_reservedOffset);
+			writer->write(m_reservedSize);
+			writer->write(m_reservedAlignment);
+			writer->write(FrameCapture::addBlob(m_reserved, size));
+		});
+		m_reserved = nullptr;
+	}
+
+	void CaptureStreamingBuffer::bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size)
+	{
+		CaptureScope scope;
+		m_streamingBuffer->bindRange(target, bindingPoint, offset, size);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::BindStreamingRange);
+			writer->write(getCaptureID());
+			writer->write(static_cast<uint8_t>(target));
+			writer->write(bindingPoint);
+			writer->write(offset);
+			writer->write(size);
+		});
+	}
+
+	void CaptureStreamingBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateStreamingBuffer);
+		writer.write(getCaptureID());
+		writer.write(m_streamingBuffer->getRegionSize());
+		writer.write(m_regionCount);
+	}
+
+	CaptureFrameBuffer::CaptureFrameBuffer(FrameBuffer * frameBuffer, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment) :
+		CaptureResource(CaptureResourceKind::FrameBuffer),
+		m_frameBuffer(frameBuffer),
+		m_colourAttachments(colourAttachments),
+		m_depthAttachment(depthAttachment)
+	{
+	}
+
+	void CaptureFrameBuffer::bind()
+	{
+		CaptureScope scope;
+		m_frameBuffer->bind();
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::BindFrameBuffer);
+			writer->write(getCaptureID());
+		});
+	}
+
+	void CaptureFrameBuffer::unbind()
+	{
+		CaptureScope scope;
+		m_frameBuffer->unbind();
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::UnbindFrameBuffer);
+			writer->write(getCaptureID());
+		});
+	}
+
+	void CaptureFrameBuffer::resize(uint32_t width, uint32_t height)
+	{
+		CaptureScope scope;
+		m_frameBuffer->resize(width, height);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return; //!< A snapshot makes it at its current size
+			writer->write(CaptureOp::ResizeFrameBuffer);
+			writer->write(getCaptureID());
+			writer->write(width);
+			writer->write(height);
+		});
+	}
+
+	void CaptureFrameBuffer::bindColourAttachment(uint32_t index, uint32_t slot)
+	{
+		CaptureScope scope;
+		m_frameBuffer->bindColourAttachment(index, slot);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::BindColourAttachment);
+			writer->write(getCaptureID());
+			writer->write(index);
+			writer->write(slot);
+		});
+	}
+
+	void CaptureFrameBuffer::bindDepthAttachment(uint32_t slot)
+	{
+		CaptureScope scope;
+		m_frameBuffer->bindDepthAttachment(slot);
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::BindDepthAttachment);
+			writer->write(getCaptureID());
+			writer->write(slot);
+		});
+	}
+
+	void CaptureFrameBuffer::copyDepthToDefault()
+	{
+		CaptureScope scope;
+		m_frameBuffer->copyDepthToDefault();
+		if (!scope.isOutermost()) return;
+
+		FrameCapture::record([&](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::CopyDepthToDefault);
+			writer->write(getCaptureID());
+		});
+	}
+
+	void CaptureFrameBuffer::writeCreate(CaptureWriter & writer)
+	{
+		writer.write(CaptureOp::CreateFrameBuffer);
+		writer.write(getCaptureID());
+		writer.write(m_frameBuffer->getWidth());
+		writer.write(m_frameBuffer->getHeight());
+		writer.write(static_cast<uint32_t>(m_colourAttachments.size()));
+		for (AttachmentFormat format : m_colourAttachments) writer.write(static_cast<uint8_t>(format));
+		writer.write(static_cast<uint8_t>(m_depthAttachment));
+	}
+}
@@ -0,0 +1,298 @@
+/*! \file clusteredLighting.cpp */
+#include "engine_pch.h"
+#include "renderer/clusteredLighting.h"
+#include "systems/threadPool.h"
+#include "systems/profiler.h"
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <xmmintrin.h>
+#define NG_CLUSTER_SSE
+#endif
+
+namespace Engine
+{
+	namespace
+	{
+		/*! \struct SliceLight
+		* \brief A light which overlaps a depth slice, with its radius already reduced by the distance to the slice
+		*/
+		struct SliceLight
+		{
+			float x; //!< View space x
+			float y; //!< View space y
+			float radiusSq; //!< Squared radius left over once the depth distance to the slice is taken off
+			uint32_t index; //!< Index into the scene's lights
+		};
+	}
+
+	LightClusterGrid::LightClusterGrid(uint32_t tilesX, uint32_t tilesY, uint32_t slicesZ) :
+		m_tilesX(tilesX), m_tilesY(tilesY), m_slicesZ(slicesZ)
+	{
+		m_sliceStride = (m_tilesX * m_tilesY + 3) & ~3u; //!< Round the slice up to a multiple of 4 clusters
+		m_grid.resize(getClusterCount()); //!< One cell per cluster
+		m_sliceIndices.resize(m_slicesZ); //!< One index list per slice
+	}
+
+	void LightClusterGrid::build(const glm::mat4 & projection)
+	{
+		if (projection == m_projection) return; //!< Bounds are still valid
+		m_projection = projection;
+
+		m_near = projection[3][2] / (projection[2][2] - 1.f); //!< Recover the near plane from the perspective matrix
+		m_far = projection[3][2] / (projection[2][2] + 1.f); //!< Recover the far plane from the perspective matrix
+
+		m_sliceDepths.resize(m_slicesZ + 1);
+		for (uint32_t z = 0; z <= m_slicesZ; z++)
+		{
+			m_sliceDepths[z] = m_near * std::pow(m_far / m_near, static_cast<float>(z) / static_cast<float>(m_slicesZ)); //!< Exponential slices keep clusters roughly cubic
+		}
+
+		glm::mat4 inverseProjection = glm::inverse(projection);
+		std::vector<float> slopeX(m_tilesX + 1), slopeY(m_tilesY + 1); //!< View space x or y per unit of depth along each tile boundary
+		for (uint32_t x = 0; x <= m_tilesX; x++)
+		{
+			glm::vec4 point = inverseProjection * glm::vec4(-1.f + 2.f * x / m_tilesX, 0.f, -1.f, 1.f); //!< Boundary on the near plane
+			slopeX[x] = (point.x / point.w) / -(point.z / point.w);
+		}
+		for (uint32_t y = 0; y <= m_tilesY; y++)
+		{
+			glm::vec4 point = inverseProjection * glm::vec4(0.f, -1.f + 2.f * y / m_tilesY, -1.f, 1.f); //!< Boundary on the near plane
+			slopeY[y] = (point.y / point.w) / -(point.z / point.w);
+		}
+
+		uint32_t boundsSize = m_sliceStride * m_slicesZ;
+		m_minX.assign(boundsSize, FLT_MAX); //!< Padding clusters get inverted bounds so they can never be hit
+		m_minY.assign(boundsSize, FLT_MAX);
+		m_maxX.assign(boundsSize, -FLT_MAX);
+		m_maxY.assign(boundsSize, -FLT_MAX);
+
+		for (uint32_t z = 0; z < m_slicesZ; z++)
+		{
+			float nearDepth = m_sliceDepths[z]; //!< Front of the slice
+			float farDepth = m_sliceDepths[z + 1]; //!< Back of the slice
+			for (uint32_t y = 0; y < m_tilesY; y++)
+			{
+				for (uint32_t x = 0; x < m_tilesX; x++)
+				{
+					uint32_t i = z * m_sliceStride + y * m_tilesX + x; //!< Bounds index
+					m_minX[i] = std::min(slopeX[x] * nearDepth, slopeX[x] * farDepth); //!< The froxel widens with depth, so the box covers both ends
+					m_maxX[i] = std::max(slopeX[x + 1] * nearDepth, slopeX[x + 1] * farDepth);
+					m_minY[i] = std::min(slopeY[y] * nearDepth, slopeY[y] * farDepth);
+					m_maxY[i] = std::max(slopeY[y + 1] * nearDepth, slopeY[y + 1] * farDepth);
+				}
+			}
+		}
+	}
+
+	void LightClusterGrid::assign(const std::vector<PointLight>& lights, const glm::mat4 & view)
+	{
+		m_viewLights.resize(lights.size());
+		for (uint32_t i = 0; i < lights.size(); i++)
+		{
+			glm::vec4 position = view * glm::vec4(lights[i].position, 1.f); //!< Move the light into view space
+			m_viewLights[i] = glm::vec4(glm::vec3(position), lights[i].radius);
+		}
+
+		ThreadPool::parallelFor(m_slicesZ, [this](uint32_t begin, uint32_t end)
+		{
+			for (uint32_t z = begin; z < end; z++) assignSlice(z);
+		}); //!< Slices don't share any output, so they can run on any thread
+
+		uint32_t total = 0;
+		for (auto& sliceIndices : m_sliceIndices) total += static_cast<uint32_t>(sliceIndices.size()); //!< Size of the combined index list
+		m_lightIndices.resize(total);
+
+		uint32_t clustersPerSlice = m_tilesX * m_tilesY;
+		uint32_t offset = 0;
+		for (uint32_t z = 0; z < m_slicesZ; z++)
+		{
+			for (uint32_t i = 0; i < clustersPerSlice; i++) m_grid[z * clustersPerSlice + i].offset += offset; //!< Slice offsets were local to the slice
+			std::copy(m_sliceIndices[z].begin(), m_sliceIndices[z].end(), m_lightIndices.begin() + offset); //!< Append the slice's indices
+			offset += static_cast<uint32_t>(m_sliceIndices[z].size());
+		}
+	}
+
+	uint32_t LightClusterGrid::getClusterIndex(const glm::vec3 & viewPos) const
+	{
+		glm::vec4 clip = m_projection * glm::vec4(viewPos, 1.f); //!< Project the position
+		glm::vec2 ndc = glm::vec2(clip) / clip.w;
+
+		int32_t x = static_cast<int32_t>((ndc.x * 0.5f + 0.5f) * m_tilesX); //!< Screen tile
+		int32_t y = static_cast<int32_t>((ndc.y * 0.5f + 0.5f) * m_tilesY);
+		int32_t z = static_cast<int32_t>(std::log(-viewPos.z / m_near) / std::log(m_far / m_near) * m_slicesZ); //!< Exponential depth slice
+
+		x = std::min(std::max(x, 0), static_cast<int32_t>(m_tilesX) - 1);
+		y = std::min(std::max(y, 0), static_cast<int32_t>(m_tilesY) - 1);
+		z = std::min(std::max(z, 0), static_cast<int32_t>(m_slicesZ) - 1);
+
+		return x + y * m_tilesX + z * m_tilesX * m_tilesY;
+	}
+
+	void LightClusterGrid::assignSlice(uint32_t slice)
+	{
+		thread_local std::vector<SliceLight> sliceLights; //!< Lights overlapping this slice, reused between frames
+		thread_local std::vector<uint8_t> hitMasks; //!< Which of the current 4 clusters each slice light hits
+
+		float nearDepth = m_sliceDepths[slice];
+		float farDepth = m_sliceDepths[slice + 1];
+
+		sliceLights.clear();
+		for (uint32_t i = 0; i < m_viewLights.size(); i++)
+		{
+			const glm::vec4& light = m_viewLights[i];
+			float depth = -light.z; //!< View space looks down -z
+			float dz = 0.f;
+			if (depth < nearDepth) dz = nearDepth - depth;
+			else if (depth > farDepth) dz = depth - farDepth;
+
+			float radiusSq = light.w * light.w - dz * dz; //!< Whatever is left of the sphere at the slice's nearest face
+			if (radiusSq >= 0.f) sliceLights.push_back({ light.x, light.y, radiusSq, i });
+		}
+
+		uint32_t clustersPerSlice = m_tilesX * m_tilesY;
+		LightGridCell* cells = &m_grid[slice * clustersPerSlice]; //!< This slice's cells
+		std::vector<uint32_t>& indices = m_sliceIndices[slice]; //!< This slice's index list
+		indices.clear();
+
+		if (sliceLights.empty())
+		{
+			for (uint32_t i = 0; i < clustersPerSlice; i++) cells[i] = { 0, 0 }; //!< Nothing reaches this slice
+			return;
+		}
+
+		hitMasks.resize(sliceLights.size());
+		uint32_t boundsBase = slice * m_sliceStride;
+
+		for (uint32_t block = 0; block < clustersPerSlice; block += 4)
+		{
+			const uint32_t b = boundsBase + block; //!< First of the 4 clusters in the bounds arrays
+#ifdef NG_CLUSTER_SSE
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 minX = _mm_loadu_ps(&m_minX[b]);
+			const __m128 maxX = _mm_loadu_ps(&m_maxX[b]);
+			const __m128 minY = _mm_loadu_ps(&m_minY[b]);
+			const __m128 maxY = _mm_loadu_ps(&m_maxY[b]);
+
+			for (uint32_t j = 0; j < sliceLights.size(); j++)
+			{
+				const __m128 x = _mm_set1_ps(sliceLights[j].x);
+				const __m128 y = _mm_set1_ps(sliceLights[j].y);
+				__m128 dx = _mm_add_ps(_mm_max_ps(_mm_sub_ps(minX, x), zero), _mm_max_ps(_mm_sub_ps(x, maxX), zero)); //!< Distance from the light to each box on x, 0 if inside
+				__m128 dy = _mm_add_ps(_mm_max_ps(_mm_sub_ps(minY, y), zero), _mm_max_ps(_mm_sub_ps(y, maxY), zero)); //!< Distance from the light to each box on y, 0 if inside
+				__m128 distanceSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+				hitMasks[j] = static_cast<uint8_t>(_mm_movemask_ps(_mm_cmple_ps(distanceSq, _mm_set1_ps(sliceLights[j].radiusSq)))); //!< One bit per cluster
+			}
+#else
+			for (uint32_t j = 0; j < sliceLights.size(); j++)
+			{
+				uint8_t mask = 0;
+				for (uint32_t lane = 0; lane < 4; lane++)
+				{
+					float dx = std::max(m_minX[b + lane] - sliceLights[j].x, 0.f) + std::max(sliceLights[j].x - m_maxX[b + lane], 0.f);
+					float dy = std::max(m_minY[b + lane] - sliceLights[j].y, 0.f) + std::max(sliceLights[j].y - m_maxY[b + lane], 0.f);
+					if (dx * dx + dy * dy <= sliceLights[j].radiusSq) mask |= 1 << lane;
+				}
+				hitMasks[j] = mask;
+			}
+#endif
+			for (uint32_t lane = 0; lane < 4 && block + lane < clustersPerSlice; lane++)
+			{
+				LightGridCell& cell = cells[block + lane];
+				cell.offset = static_cast<uint32_t>(indices.size()); //!< Offset within the slice, made global once every slice is done
+				for (uint32_t j = 0; j < sliceLights.size(); j++)
+				{
+					if (hitMasks[j] & (1 << lane)) indices.push_back(sliceLights[j].index);
+				}
+				cell.count = static_cast<uint32_t>(indices.size()) - cell.offset;
+			}
+		}
+	}
+
+	ClusteredLighting::ClusteredLighting(uint32_t viewportWidth, uint32_t viewportHeight) :
+		m_viewport(static_cast<float>(viewportWidth), static_cast<float>(viewportHeight))
+	{
+		UniformBufferLayout lightLayout = {
+			{ "u_viewPos", ShaderDataType::Float3 },
+			{ "u_ambientColour", ShaderDataType::Float3 },
+			{ "u_clusterDims", ShaderDataType::Float4 },
+			{ "u_clusterParams", ShaderDataType::Float4 },
+			{ "u_inverseViewProjection", ShaderDataType::Mat4 } }; //!< Layout of the b_light block
+		m_lightUBO.reset(UniformBuffer::create(lightLayout));
+		m_viewPosField = m_lightUBO->getFieldHandle("u_viewPos"_sid); //!< Resolve the fields once
+		m_ambientField = m_lightUBO->getFieldHandle("u_ambientColour"_sid);
+		m_clusterDimsField = m_lightUBO->getFieldHandle("u_clusterDims"_sid);
+		m_clusterParamsField = m_lightUBO->getFieldHandle("u_clusterParams"_sid);
+		m_inverseViewProjectionField = m_lightUBO->getFieldHandle("u_inverseViewProjection"_sid);
+
+		uint32_t frameSize = sizeof(PointLight) * 256 + sizeof(LightGridCell) * m_clusterGrid.getClusterCount() + sizeof(uint32_t) * m_clusterGrid.getClusterCount() * 8; //!< 256 lights, 8 per cluster on average
+		m_stream.reset(StreamingBuffer::create(frameSize + streamSlack)); //!< Grows if the lights get crowded
+	}
+
+	void ClusteredLighting::update(const Camera & camera)
+	{
+		NG_PROFILE_FUNCTION();
+		m_clusterGrid.build(camera.projection); //!< Only does work when the projection changes
+		m_clusterGrid.assign(m_lights, camera.view); //!< Bin the lights
+
+		float depthRange = std::log(m_clusterGrid.getFar() / m_clusterGrid.getNear());
+		glm::vec3 viewPos = glm::vec3(glm::inverse(camera.view)[3]); //!< Camera position in world space
+		glm::vec4 clusterDims(m_clusterGrid.getTilesX(), m_clusterGrid.getTilesY(), m_clusterGrid.getSlicesZ(), 0.f);
+		glm::vec4 clusterParams(
+			m_clusterGrid.getSlicesZ() / depthRange, //!< Slice scale, slice = log(depth) * scale - bias
+			m_clusterGrid.getSlicesZ() * std::log(m_clusterGrid.getNear()) / depthRange, //!< Slice bias
+			m_viewport.x / m_clusterGrid.getTilesX(), //!< Tile width in pixels
+			m_viewport.y / m_clusterGrid.getTilesY()); //!< Tile height in pixels
+
+		m_lightUBO->uploadShaderData(m_viewPosField, glm::value_ptr(viewPos)); //!< Stage the view position
+		m_lightUBO->uploadShaderData(m_ambientField, glm::value_ptr(m_ambient)); //!< Stage the ambient colour
+		m_lightUBO->uploadShaderData(m_clusterDimsField, glm::value_ptr(clusterDims)); //!< Stage the cluster counts
+		m_lightUBO->uploadShaderData(m_clusterParamsField, glm::value_ptr(clusterParams)); //!< Stage the cluster lookup constants, the renderer flushes the block
+		glm::mat4 inverseViewProjection = glm::inverse(camera.projection * camera.view); //!< Once a frame here, rather than once per light volume vertex on the GPU
+		m_lightUBO->uploadShaderData(m_inverseViewProjectionField, glm::value_ptr(inverseViewProjection)); //!< Stage it for the deferred light pass
+
+		const auto& grid = m_clusterGrid.getGrid();
+		const auto& indices = m_clusterGrid.getLightIndices();
+		m_lightRange.size = static_cast<uint32_t>(sizeof(PointLight) * m_lights.size());
+		m_gridRange.size = static_cast<uint32_t>(sizeof(LightGridCell) * grid.size());
+		m_indexRange.size = static_cast<uint32_t>(sizeof(uint32_t) * indices.size());
+
+		uint32_t frameSize = m_lightRange.size + m_gridRange.size + m_indexRange.size + streamSlack; //!< Everything written this frame, with room for alignment
+		if (frameSize > m_stream->getRegionSize())
+		{
+			uint32_t regionSize = std::max(frameSize, m_stream->getRegionSize() * 2); //!< Grow geometrically so a slowly growing frame isn't reallocated every time
+			m_stream.reset(StreamingBuffer::create(regionSize)); //!< The old buffer is deleted straight away. Draws already issued still read it, GL keeps a deleted buffer's storage until the commands using it are done
+		}
+		m_stream->beginFrame(); //!< Once a frame, before anything is written
+
+		writeRange(m_lightRange, m_lights.data()); //!< Write the lights straight into GPU visible memory
+		writeRange(m_gridRange, grid.data()); //!< Write the cluster cells
+		writeRange(m_indexRange, indices.data()); //!< Write the light index list
+
+		bind(); //!< Bind the ranges where the shaders expect them
+	}
+
+	void ClusteredLighting::bind()
+	{
+		m_stream->bindRange(StreamingBufferTarget::ShaderStorage, lightBufferBinding, m_lightRange.offset, m_lightRange.size);
+		m_stream->bindRange(StreamingBufferTarget::ShaderStorage, gridBufferBinding, m_gridRange.offset, m_gridRange.size);
+		m_stream->bindRange(StreamingBufferTarget::ShaderStorage, indexBufferBinding, m_indexRange.offset, m_indexRange.size);
+	}
+
+	void ClusteredLighting::writeRange(StreamRange & range, const void * data)
+	{
+		uint32_t size = std::max(range.size, 16u); //!< Never bind an empty range, an empty array still needs something behind it
+		void* destination = m_stream->allocate(size, 16, range.offset);
+		if (destination && range.size > 0) std::memcpy(destination, data, range.size);
+		range.size = size;
+	}
+
+	void ClusteredLighting::setViewport(uint32_t width, uint32_t height)
+	{
+		m_viewport = glm::vec2(static_cast<float>(width), static_cast<float>(height)); //!< Tile sizes are recalculated on the next update
+	}
+}
@@ -0,0 +1,70 @@
+/*! \file drawList.cpp */
+#include "engine_pch.h"
+#include "renderer/drawList.h"
+#include "renderer/renderer3D.h"
+#include "systems/threadPool.h"
+#include "systems/profiler.h"
+#include <algorithm>
+
+namespace Engine
+{
+	void DrawList::record(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4 & model)
+	{
+		m_commands.push_back({ makeSortKey(*geometry, *material), geometry.get(), material.get(), model });
+	}
+
+	void DrawList::append(const DrawList & other)
+	{
+		m_commands.insert(m_commands.end(), other.m_commands.begin(), other.m_commands.end());
+	}
+
+	void DrawList::sort()
+	{
+		for (auto& command : m_commands)
+		{
+			uint64_t shader = Renderer3D::getDrawShader(*command.material)->getRenderID(); //!< The program the draw is actually bound with, filled in here as finding it may compile a permutation
+			command.sortKey = (command.sortKey & ~(0xFFFFull << 48)) | ((shader & 0xFFFF) << 48); //!< Program changes cost the most, so they go in the top bits
+		}
+		std::stable_sort(m_commands.begin(), m_commands.end(), [](const DrawCommand& a, const DrawCommand& b) { return a.sortKey < b.sortKey; }); //!< Stable, so the result doesn't depend on how the work was split
+	}
+
+	uint64_t DrawList::makeSortKey(VertexArray & geometry, Material & material)
+	{
+		uint64_t texture = material.isFlagSet(Material::flag_texture) && material.getTexture() ? material.getTexture()->getRenderID() : 0;
+		uint64_t vertexArray = geometry.getRenderID();
+		return ((texture & 0xFFFFFF) << 24) | (vertexArray & 0xFFFFFF); //!< The top 16 bits are left for sort to put the shader in
+	}
+
+	void ParallelDrawRecorder::record(uint32_t count, const std::function<void(DrawList&list, uint32_t begin, uint32_t end)>& job)
+	{
+		NG_PROFILE_FUNCTION();
+		uint32_t chunks = std::max(1u, std::min(count, ThreadPool::getWorkerCount() + 1)); //!< One chunk per worker plus one for this thread
+		if (m_lists.size() < chunks) m_lists.resize(chunks);
+		for (auto& list : m_lists) list.reset(); //!< Lists from a bigger frame are left empty
+
+		uint32_t chunkSize = count > 0 ? (count + chunks - 1) / chunks : 0; //!< Round up so every item is covered
+		bool runInline = ThreadPool::isWorkerThread(); //!< Already a worker, waiting on the others could deadlock once they are all busy
+		m_pending.clear();
+		for (uint32_t chunk = 1; chunk < chunks; chunk++)
+		{
+			uint32_t begin = std::min(chunk * chunkSize, count);
+			uint32_t end = std::min(begin + chunkSize, count);
+			DrawList* list = &m_lists[chunk];
+			if (runInline) job(*list, begin, end); //!< Same chunks, so the merged list is the same either way
+			else m_pending.push_back(ThreadPool::submit([&job, list, begin, end]() { job(*list, begin, end); })); //!< Record on a worker
+		}
+
+		job(m_lists[0], 0, std::min(chunkSize, count)); //!< This thread takes the first chunk
+
+		for (auto& pending : m_pending) pending.wait(); //!< Wait for the workers to finish recording
+	}
+
+	const DrawList & ParallelDrawRecorder::merge()
+	{
+		NG_PROFILE_FUNCTION();
+		m_merged.reset();
+		for (auto& list : m_lists) m_merged.append(list); //!< In chunk order
+		m_merged.sort();
+		return m_merged;
+	}
+}
@@ -0,0 +1,384 @@
+/*! \file frameCapture.cpp */
+#include "engine_pch.h"
+#include "renderer/frameCapture.h"
+#include "renderer/captureResources.h"
+#include "rendering/renderAPI.h"
+#include "core/hash.h"
+#include "systems/log.h"
+#include <fstream>
+
+namespace Engine
+{
+	thread_local uint32_t CaptureScope::s_depth = 0; //!< Initialise the call depth
+
+	bool FrameCapture::s_enabled = false; //!< Initialise the enabled flag
+	std::atomic<bool> FrameCapture::s_capturing = false; //!< Initialise the capturing flag
+	std::atomic<bool> FrameCapture::s_requested = false; //!< Initialise the requested flag
+	std::string FrameCapture::s_filepath; //!< Initialise the file path
+	uint32_t FrameCapture::s_firstFrame = 0; //!< Initialise the first frame
+	uint32_t FrameCapture::s_frameCount = 0; //!< Initialise the frame count
+	uint32_t FrameCapture::s_frame = 0; //!< Initialise the frame counter
+	uint32_t FrameCapture::s_nextID = 1; //!< Initialise the next ID, 0 means no resource
+	std::map<uint32_t, CaptureResource*> FrameCapture::s_resources; //!< Initialise the resource table
+	std::vector<std::vector<uint8_t>> FrameCapture::s_blobs; //!< Initialise the blobs
+	std::unordered_multimap<uint64_t, uint32_t> FrameCapture::s_blobLookup; //!< Initialise the blob lookup
+	CaptureWriter FrameCapture::s_setup; //!< Initialise the setup writer
+	CaptureWriter FrameCapture::s_current; //!< Initialise the frame writer
+	std::vector<FrameCapture::CapturedFrame> FrameCapture::s_frames; //!< Initialise the frames
+	std::chrono::steady_clock::time_point FrameCapture::s_frameStart; //!< Initialise the frame start
+	std::recursive_mutex FrameCapture::s_resourceMutex; //!< Initialise the resource mutex
+	std::mutex FrameCapture::s_mutex; //!< Initialise the capture mutex
+
+	void CaptureWriter::writeString(const std::string & string)
+	{
+		write(static_cast<uint32_t>(string.size()));
+		append(string.data(), static_cast<uint32_t>(string.size()));
+	}
+
+	void CaptureWriter::append(const void * data, uint32_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		m_bytes.insert(m_bytes.end(), bytes, bytes + size);
+	}
+
+	std::string CaptureReader::readString()
+	{
+		uint32_t size = read<uint32_t>();
+		const uint8_t* characters = skip(size);
+		if (!characters) return std::string();
+		return std::string(reinterpret_cast<const char*>(characters), size);
+	}
+
+	bool CaptureReader::readBytes(void * destination, uint32_t size)
+	{
+		const uint8_t* source = skip(size);
+		if (!source) return false;
+		std::memcpy(destination, source, size);
+		return true;
+	}
+
+	const uint8_t * CaptureReader::skip(uint32_t size)
+	{
+		if (m_error || size > m_size - m_position)
+		{
+			m_error = true; //!< Truncated or corrupt, stop reading
+			m_position = m_size;
+			return nullptr;
+		}
+		const uint8_t* start = m_data + m_position;
+		m_position += size;
+		return start;
+	}
+
+	void FrameCapture::start(SystemSignal init, ...)
+	{
+		va_list args;
+		va_start(args, init);
+		s_filepath = va_arg(args, const char*); //!< Where to write the capture
+		s_firstFrame = va_arg(args, uint32_t); //!< Frames to let run before capturing, 0 to wait for a request
+		s_frameCount = va_arg(args, uint32_t); //!< Frames to capture
+		va_end(args);
+
+		if (s_frameCount == 0) s_frameCount = 1;
+		s_frame = 0;
+		s_enabled = true; //!< Everything created from here on is tracked
+
+		if (s_firstFrame) Log::info("Frame capture will record {0} frames after frame {1} into {2}", s_frameCount, s_firstFrame, s_filepath);
+		else Log::info("Frame capture ready, press F3 to record {0} frames into {1}", s_frameCount, s_filepath);
+	}
+
+	void FrameCapture::stop(SystemSignal close, ...)
+	{
+		if (!s_enabled) return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			if (s_capturing)
+			{
+				Log::info("Frame capture stopped after {0} of {1} frames", s_frames.size(), s_frameCount);
+				writeFile(); //!< Keep what was recorded
+			}
+		}
+
+		{
+			std::lock_guard<std::recursive_mutex> resources(s_resourceMutex);
+			for (auto& [id, resource] : s_resources) resource->m_captureID = 0; //!< Resources still alive, like the renderers' static data, stop reporting back
+			s_resources.clear();
+		}
+
+		s_enabled = false;
+		s_requested = false;
+	}
+
+	void FrameCapture::requestCapture()
+	{
+		if (!s_enabled)
+		{
+			Log::error("Frame capture wasn't started, run with --capture <file>");
+			return;
+		}
+		if (s_capturing) return; //!< One window at a time
+		s_requested = true;
+	}
+
+	void FrameCapture::endFrame()
+	{
+		if (!s_enabled) return;
+
+		auto now = std::chrono::steady_clock::now();
+		s_frame++;
+
+		if (s_capturing)
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			float milliseconds = std::chrono::duration<float, std::milli>(now - s_frameStart).count();
+			s_frames.push_back({ milliseconds, s_current.getBytes() });
+			s_current.clear();
+			if (s_frames.size() >= s_frameCount) writeFile(); //!< Window full
+		}
+		else if (s_requested || s_frame == s_firstFrame)
+		{
+			s_requested = false;
+			beginWindow(); //!< The next frame is the first one captured
+		}
+
+		s_frameStart = now;
+	}
+
+	uint32_t FrameCapture::addBlob(const void * data, uint32_t size)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		uint64_t hash = Hash::fnv1a(static_cast<const char*>(data), size);
+
+		auto range = s_blobLookup.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			const auto& blob = s_blobs[it->second];
+			if (blob.size() == size && std::memcmp(blob.data(), bytes, size) == 0) return it->second; //!< Already stored
+		}
+
+		uint32_t index = static_cast<uint32_t>(s_blobs.size());
+		s_blobs.emplace_back(bytes, bytes + size);
+		s_blobLookup.emplace(hash, index);
+		return index;
+	}
+
+	void FrameCapture::writeLayout(CaptureWriter & writer, const VertexBufferLayout & layout)
+	{
+		writer.write(layout.getStride());
+		writer.write(static_cast<uint32_t>(std::distance(layout.begin(), layout.end())));
+		for (const auto& element : layout)
+		{
+			writer.write(static_cast<uint8_t>(element.m_dataType));
+			writer.write(static_cast<uint8_t>(element.m_normalised));
+		}
+	}
+
+	void FrameCapture::writeLayout(CaptureWriter & writer, const UniformBufferLayout & layout)
+	{
+		writer.write(layout.getStride());
+		writer.write(static_cast<uint32_t>(std::distance(layout.begin(), layout.end())));
+		for (const auto& element : layout)
+		{
+			writer.writeString(element.m_name);
+			writer.write(static_cast<uint8_t>(element.m_dataType));
+		}
+	}
+
+	VertexBuffer * FrameCapture::track(VertexBuffer * vertexBuffer, const void * vertices, uint32_t size, const VertexBufferLayout & layout)
+	{
+		if (!s_enabled || !vertexBuffer) return vertexBuffer;
+		return addResource(new CaptureVertexBuffer(vertexBuffer, vertices, size, layout));
+	}
+
+	IndexBuffer * FrameCapture::track(IndexBuffer * indexBuffer, const uint32_t * indices, uint32_t count)
+	{
+		if (!s_enabled || !indexBuffer) return indexBuffer;
+		return addResource(new CaptureIndexBuffer(indexBuffer, indices, count));
+	}
+
+	VertexArray * FrameCapture::track(VertexArray * vertexArray)
+	{
+		if (!s_enabled || !vertexArray) return vertexArray;
+		return addResource(new CaptureVertexArray(vertexArray));
+	}
+
+	Shader * FrameCapture::track(Shader * shader, const char * vertexFile, const char * fragmentFile)
+	{
+		if (!s_enabled || !shader) return shader;
+		return addResource(new CaptureShader(shader, vertexFile, fragmentFile));
+	}
+
+	Shader * FrameCapture::track(Shader * shader, const char * filepath, ShaderCompileMode mode)
+	{
+		if (!s_enabled || !shader) return shader;
+		return addResource(new CaptureShader(shader, filepath, mode));
+	}
+
+	Texture * FrameCapture::track(Texture * texture, const char * filepath)
+	{
+		if (!s_enabled || !texture) return texture;
+		return addResource(new CaptureTexture(texture, filepath));
+	}
+
+	Texture * FrameCapture::track(Texture * texture, uint32_t width, uint32_t height, uint32_t channels, const unsigned char * data)
+	{
+		if (!s_enabled || !texture) return texture;
+		return addResource(new CaptureTexture(texture, width, height, channels, data));
+	}
+
+	UniformBuffer * FrameCapture::track(UniformBuffer * uniformBuffer, const UniformBufferLayout & layout)
+	{
+		if (!s_enabled || !uniformBuffer) return uniformBuffer;
+		return addResource(new CaptureUniformBuffer(uniformBuffer, layout));
+	}
+
+	ShaderStorageBuffer * FrameCapture::track(ShaderStorageBuffer * storageBuffer, uint32_t size)
+	{
+		if (!s_enabled || !storageBuffer) return storageBuffer;
+		return addResource(new CaptureShaderStorageBuffer(storageBuffer, size));
+	}
+
+	StreamingBuffer * FrameCapture::track(StreamingBuffer * streamingBuffer, uint32_t regionSize, uint32_t regionCount)
+	{
+		if (!s_enabled || !streamingBuffer) return streamingBuffer;
+		return addResource(new CaptureStreamingBuffer(streamingBuffer, regionSize, regionCount));
+	}
+
+	FrameBuffer * FrameCapture::track(FrameBuffer * frameBuffer, uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment)
+	{
+		if (!s_enabled || !frameBuffer) return frameBuffer;
+		return addResource(new CaptureFrameBuffer(frameBuffer, colourAttachments, depthAttachment));
+	}
+
+	void FrameCapture::registerResource(CaptureResource * resource)
+	{
+		std::lock_guard<std::recursive_mutex> resources(s_resourceMutex); //!< A snapshot sees the resource either made or not, never half way
+		resource->m_captureID = s_nextID++;
+		s_resources[resource->m_captureID] = resource;
+
+		record([resource](CaptureWriter* writer) { if (writer) resource->writeCreate(*writer); }); //!< Made during the window
+	}
+
+	void FrameCapture::removeResource(CaptureResource * resource)
+	{
+		if (!resource->m_captureID) return; //!< Let go of by stop, which may be during static destruction
+		std::lock_guard<std::recursive_mutex> resources(s_resourceMutex);
+
+		s_resources.erase(resource->m_captureID);
+		uint32_t id = resource->m_captureID;
+		record([id](CaptureWriter* writer)
+		{
+			if (!writer) return;
+			writer->write(CaptureOp::Destroy);
+			writer->write(id);
+		});
+		resource->m_captureID = 0;
+	}
+
+	void FrameCapture::writeCommand(const RenderCommand & command)
+	{
+		RenderCommand captured = command;
+		{
+			std::lock_guard<std::recursive_mutex> resources(s_resourceMutex);
+			switch (command.type) //!< Render IDs mean nothing on replay, refer to the resources instead
+			{
+			case RenderCommandType::UseShader:
+				captured.shader.renderID = findCaptureID(CaptureResourceKind::Shader, command.shader.renderID);
+				break;
+			case RenderCommandType::BindTexture:
+				captured.texture.renderID = findCaptureID(CaptureResourceKind::Texture, command.texture.renderID);
+				break;
+			case RenderCommandType::BindVertexArray:
+				captured.geometry.vertexArray = findCaptureID(CaptureResourceKind::VertexArray, command.geometry.vertexArray);
+				if (command.geometry.indexBuffer) captured.geometry.indexBuffer = findCaptureID(CaptureResourceKind::IndexBuffer, command.geometry.indexBuffer);
+				break;
+			default:
+				break;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+		if (!s_capturing) return; //!< Window closed while the IDs were looked up
+		s_current.write(CaptureOp::Command);
+		s_current.write(captured);
+	}
+
+	uint32_t FrameCapture::findCaptureID(CaptureResourceKind kind, uint32_t renderID)
+	{
+		if (!renderID) return 0;
+		for (auto it = s_resources.rbegin(); it != s_resources.rend(); ++it) //!< Newest first, a freed render ID can be handed out again
+		{
+			CaptureResource* resource = it->second;
+			if (resource->getKind() == kind && resource->getCapturedRenderID() == renderID) return it->first;
+		}
+		return 0;
+	}
+
+	void FrameCapture::beginWindow()
+	{
+		std::lock_guard<std::recursive_mutex> resources(s_resourceMutex);
+		std::lock_guard<std::mutex> lock(s_mutex);
+
+		s_setup.clear();
+		s_current.clear();
+		s_frames.clear();
+		s_blobs.clear();
+		s_blobLookup.clear();
+
+		for (auto& [id, resource] : s_resources) resource->writeCreate(s_setup); //!< Everything exists before anything refers to it
+		for (auto& [id, resource] : s_resources) resource->writeState(s_setup);
+
+		s_capturing = true;
+		Log::info("Frame capture started at frame {0}, {1} resources in the snapshot", s_frame, s_resources.size());
+	}
+
+	void FrameCapture::writeFile()
+	{
+		s_capturing = false;
+
+		std::ofstream file(s_filepath, std::ios::binary);
+		if (!file.is_open())
+		{
+			Log::error("Could not write the frame capture to {0}", s_filepath);
+			return;
+		}
+
+		CaptureWriter header;
+		header.write(magic);
+		header.write(version);
+		header.write(static_cast<uint32_t>(RenderAPI::getAPI()));
+		header.write(static_cast<uint32_t>(s_blobs.size()));
+		file.write(reinterpret_cast<const char*>(header.getBytes().data()), header.size());
+
+		uint64_t blobBytes = 0;
+		for (const auto& blob : s_blobs)
+		{
+			uint32_t size = static_cast<uint32_t>(blob.size());
+			file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+			file.write(reinterpret_cast<const char*>(blob.data()), size);
+			blobBytes += size;
+		}
+
+		uint32_t setupSize = s_setup.size();
+		file.write(reinterpret_cast<const char*>(&setupSize), sizeof(setupSize));
+		file.write(reinterpret_cast<const char*>(s_setup.getBytes().data()), setupSize);
+
+		uint32_t frameCount = static_cast<uint32_t>(s_frames.size());
+		file.write(reinterpret_cast<const char*>(&frameCount), sizeof(frameCount));
+		for (const auto& frame : s_frames)
+		{
+			uint32_t size = static_cast<uint32_t>(frame.ops.size());
+			file.write(reinterpret_cast<const char*>(&frame.milliseconds), sizeof(frame.milliseconds));
+			file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+			file.write(reinterpret_cast<const char*>(frame.ops.data()), size);
+		}
+
+		Log::release("Frame capture of {0} frames written to {1}, {2} KB, {3} KB of it unique data", frameCount, s_filepath, static_cast<uint64_t>(file.tellp()) / 1024, blobBytes / 1024);
+
+		s_setup.clear(); //!< Free the memory until the next window
+		s_frames.clear();
+		s_blobs.clear();
+		s_blobLookup.clear();
+	}
+}
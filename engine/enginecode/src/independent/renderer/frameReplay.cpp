@@ -0,0 +1,540 @@
+/*! \file frameReplay.cpp */
+#include "engine_pch.h"
+#include "renderer/frameReplay.h"
+#include "renderer/rendererCommon.h"
+#include "rendering/renderAPI.h"
+#include "systems/log.h"
+#include <fstream>
+#include <iterator>
+
+namespace Engine
+{
+	bool FrameReplay::load(const char * filepath)
+	{
+		clear();
+		m_blobs.clear();
+		m_setup.clear();
+		m_frames.clear();
+
+		std::ifstream file(filepath, std::ios::binary);
+		if (!file.is_open())
+		{
+			Log::error("Could not open frame capture {0}", filepath);
+			return false;
+		}
+		std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+		CaptureReader reader(bytes.data(), static_cast<uint32_t>(bytes.size()));
+		uint32_t magic = reader.read<uint32_t>();
+		uint32_t version = reader.read<uint32_t>();
+		uint32_t api = reader.read<uint32_t>();
+		if (magic != FrameCapture::magic || version != FrameCapture::version)
+		{
+			Log::error("{0} isn't a frame capture this version can replay", filepath);
+			return false;
+		}
+
+		uint32_t blobCount = reader.read<uint32_t>();
+		for (uint32_t i = 0; i < blobCount && !reader.hasError(); i++)
+		{
+			uint32_t size = reader.read<uint32_t>();
+			const uint8_t* blob = reader.skip(size);
+			if (blob) m_blobs.emplace_back(blob, blob + size);
+		}
+
+		uint32_t setupSize = reader.read<uint32_t>();
+		const uint8_t* setup = reader.skip(setupSize);
+		if (setup) m_setup.assign(setup, setup + setupSize);
+
+		uint32_t frameCount = reader.read<uint32_t>();
+		for (uint32_t i = 0; i < frameCount && !reader.hasError(); i++)
+		{
+			float milliseconds = reader.read<float>();
+			uint32_t size = reader.read<uint32_t>();
+			const uint8_t* ops = reader.skip(size);
+			if (ops) m_frames.push_back({ milliseconds, std::vector<uint8_t>(ops, ops + size) });
+		}
+
+		if (reader.hasError())
+		{
+			Log::error("Frame capture {0} is truncated, {1} of {2} frames could be read", filepath, m_frames.size(), frameCount);
+			if (m_frames.empty()) return false;
+		}
+
+		if (api != static_cast<uint32_t>(RenderAPI::getAPI())) Log::info("Frame capture {0} was recorded on another render API", filepath);
+		Log::info("Loaded frame capture {0}, {1} frames and {2} blobs", filepath, m_frames.size(), m_blobs.size());
+		return true;
+	}
+
+	bool FrameReplay::setup()
+	{
+		clear();
+		CaptureReader reader(m_setup.data(), static_cast<uint32_t>(m_setup.size()));
+		bool result = execute(reader);
+		m_resourcesChanged = false; //!< Only changes made by frames count
+		return result;
+	}
+
+	bool FrameReplay::replayFrame(uint32_t frame)
+	{
+		if (frame >= m_frames.size()) return false;
+		CaptureReader reader(m_frames[frame].ops.data(), static_cast<uint32_t>(m_frames[frame].ops.size()));
+		return execute(reader);
+	}
+
+	void FrameReplay::rewind()
+	{
+		if (m_resourcesChanged) setup(); //!< Put the resources back as they were when the window started
+	}
+
+	void FrameReplay::clear()
+	{
+		m_vertexArrays.clear(); //!< Arrays first, they hold on to buffers
+		m_vertexBuffers.clear();
+		m_indexBuffers.clear();
+		m_uniformBuffers.clear();
+		m_shaders.clear();
+		m_textures.clear();
+		m_storageBuffers.clear();
+		m_streamingBuffers.clear();
+		m_frameBuffers.clear();
+		m_uniformHandles.clear();
+		m_streamedRanges.clear();
+		m_streamedVertices.clear();
+		m_names.clear();
+		m_boundVertexArray = 0;
+		m_skipped = 0;
+	}
+
+	bool FrameReplay::execute(CaptureReader & reader)
+	{
+		while (!reader.isEnd())
+		{
+			CaptureOp op = reader.read<CaptureOp>();
+			uint32_t id = op == CaptureOp::Command ? 0 : reader.read<uint32_t>(); //!< Every other call starts with the resource it is about
+
+			switch (op)
+			{
+			case CaptureOp::CreateVertexBuffer:
+			{
+				VertexBufferLayout layout = readVertexLayout(reader);
+				uint32_t size = reader.read<uint32_t>();
+				const std::vector<uint8_t>* vertices = readBlob(reader);
+				if (!vertices) break;
+				m_vertexBuffers[id].reset(VertexBuffer::create(const_cast<uint8_t*>(vertices->data()), std::min(size, static_cast<uint32_t>(vertices->size())), layout));
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateIndexBuffer:
+			{
+				uint32_t count = reader.read<uint32_t>();
+				const std::vector<uint8_t>* indices = readBlob(reader);
+				if (!indices || indices->size() < count * sizeof(uint32_t)) break;
+				m_indexBuffers[id].reset(IndexBuffer::create(reinterpret_cast<uint32_t*>(const_cast<uint8_t*>(indices->data())), count));
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateVertexArray:
+				m_vertexArrays[id].reset(VertexArray::create());
+				m_resourcesChanged = true;
+				break;
+			case CaptureOp::CreateShader:
+			{
+				reader.read<uint8_t>(); //!< Compile mode, always blocking on replay so no frame draws with a shader which isn't ready
+				uint32_t fileCount = reader.read<uint32_t>();
+				std::vector<std::string> files;
+				for (uint32_t i = 0; i < fileCount && !reader.hasError(); i++) files.push_back(reader.readString());
+				if (files.size() == 1) m_shaders[id].reset(Shader::create(files[0].c_str(), ShaderCompileMode::Blocking));
+				else if (files.size() == 2) m_shaders[id].reset(Shader::create(files[0].c_str(), files[1].c_str()));
+				m_uniformHandles.erase(id);
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateShaderVariant:
+			{
+				uint32_t base = reader.read<uint32_t>();
+				uint32_t features = reader.read<uint32_t>();
+				Shader* shader = find(m_shaders, base);
+				if (shader) m_shaders[id] = shader->getVariant(features);
+				m_uniformHandles.erase(id);
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateTextureFile:
+			{
+				std::string filepath = reader.readString();
+				m_textures[id].reset(Texture::create(filepath.c_str()));
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateTexture:
+			{
+				uint32_t width = reader.read<uint32_t>();
+				uint32_t height = reader.read<uint32_t>();
+				uint32_t channels = reader.read<uint32_t>();
+				const std::vector<uint8_t>* pixels = readBlob(reader);
+				if (!pixels || pixels->size() < static_cast<size_t>(width) * height * channels) break;
+				m_textures[id].reset(Texture::create(width, height, channels, const_cast<uint8_t*>(pixels->data())));
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateUniformBuffer:
+				m_uniformBuffers[id].reset(UniformBuffer::create(readUniformLayout(reader)));
+				m_resourcesChanged = true;
+				break;
+			case CaptureOp::CreateShaderStorageBuffer:
+				m_storageBuffers[id].reset(ShaderStorageBuffer::create(reader.read<uint32_t>()));
+				m_resourcesChanged = true;
+				break;
+			case CaptureOp::CreateStreamingBuffer:
+			{
+				uint32_t regionSize = reader.read<uint32_t>();
+				uint32_t regionCount = reader.read<uint32_t>();
+				m_streamingBuffers[id].reset(StreamingBuffer::create(regionSize, regionCount));
+				m_streamedRanges.erase(id);
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::CreateFrameBuffer:
+			{
+				uint32_t width = reader.read<uint32_t>();
+				uint32_t height = reader.read<uint32_t>();
+				uint32_t count = reader.read<uint32_t>();
+				std::vector<AttachmentFormat> colourAttachments;
+				for (uint32_t i = 0; i < count && !reader.hasError(); i++) colourAttachments.push_back(static_cast<AttachmentFormat>(reader.read<uint8_t>()));
+				AttachmentFormat depthAttachment = static_cast<AttachmentFormat>(reader.read<uint8_t>());
+				m_frameBuffers[id].reset(FrameBuffer::create(width, height, colourAttachments, depthAttachment));
+				m_resourcesChanged = true;
+				break;
+			}
+			case CaptureOp::Destroy: //!< IDs are never reused, so whichever table has it
+				m_vertexArrays.erase(id);
+				m_vertexBuffers.erase(id);
+				m_indexBuffers.erase(id);
+				m_uniformBuffers.erase(id);
+				m_shaders.erase(id);
+				m_textures.erase(id);
+				m_storageBuffers.erase(id);
+				m_streamingBuffers.erase(id);
+				m_frameBuffers.erase(id);
+				m_uniformHandles.erase(id);
+				m_streamedRanges.erase(id);
+				m_streamedVertices.erase(id);
+				m_resourcesChanged = true;
+				break;
+			case CaptureOp::Command:
+			{
+				RenderCommand command = reader.read<RenderCommand>();
+
+				switch (command.type) //!< Swap capture IDs for this run's render IDs
+				{
+				case RenderCommandType::UseShader:
+				{
+					Shader* shader = find(m_shaders, command.shader.renderID);
+					command.shader.renderID = shader ? shader->getRenderID() : 0;
+					break;
+				}
+				case RenderCommandType::BindTexture:
+				{
+					Texture* texture = find(m_textures, command.texture.renderID);
+					command.texture.renderID = texture ? texture->getRenderID() : 0;
+					break;
+				}
+				case RenderCommandType::BindVertexArray:
+				{
+					m_boundVertexArray = command.geometry.vertexArray;
+					VertexArray* vertexArray = find(m_vertexArrays, command.geometry.vertexArray);
+					command.geometry.vertexArray = vertexArray ? vertexArray->getRenderID() : 0;
+					if (command.geometry.indexBuffer)
+					{
+						IndexBuffer* indexBuffer = find(m_indexBuffers, command.geometry.indexBuffer);
+						command.geometry.indexBuffer = indexBuffer ? indexBuffer->getRenderID() : 0;
+					}
+					break;
+				}
+				case RenderCommandType::DrawIndexed:
+				{
+					auto streamed = m_streamedVertices.find(m_boundVertexArray);
+					if (streamed != m_streamedVertices.end() && streamed->second.stride) //!< Vertices may sit somewhere else in the buffer on this run
+					{
+						uint32_t offset = remapStreamed(streamed->second.streamingBuffer, command.draw.baseVertex * streamed->second.stride);
+						command.draw.baseVertex = offset / streamed->second.stride;
+					}
+					break;
+				}
+				default:
+					break;
+				}
+
+				RendererCommon::actionCommand(command);
+				break;
+			}
+			case CaptureOp::AddVertexBuffer:
+			{
+				uint32_t buffer = reader.read<uint32_t>();
+				VertexArray* vertexArray = find(m_vertexArrays, id);
+				auto vertexBuffer = m_vertexBuffers.find(buffer);
+				if (vertexArray && vertexBuffer != m_vertexBuffers.end()) vertexArray->addVertexBuffer(vertexBuffer->second);
+				break;
+			}
+			case CaptureOp::SetIndexBuffer:
+			{
+				uint32_t buffer = reader.read<uint32_t>();
+				VertexArray* vertexArray = find(m_vertexArrays, id);
+				auto indexBuffer = m_indexBuffers.find(buffer);
+				if (vertexArray && indexBuffer != m_indexBuffers.end()) vertexArray->setIndexBuffer(indexBuffer->second);
+				break;
+			}
+			case CaptureOp::SetStreamingVertexBuffer:
+			{
+				uint32_t buffer = reader.read<uint32_t>();
+				VertexBufferLayout layout = readVertexLayout(reader);
+				VertexArray* vertexArray = find(m_vertexArrays, id);
+				auto streamingBuffer = m_streamingBuffers.find(buffer);
+				if (!vertexArray || streamingBuffer == m_streamingBuffers.end()) break;
+				vertexArray->setStreamingVertexBuffer(streamingBuffer->second, layout);
+				m_streamedVertices[id] = { buffer, layout.getStride() };
+				break;
+			}
+			case CaptureOp::EditTexture:
+			{
+				uint32_t x = reader.read<uint32_t>();
+				uint32_t y = reader.read<uint32_t>();
+				uint32_t width = reader.read<uint32_t>();
+				uint32_t height = reader.read<uint32_t>();
+				const std::vector<uint8_t>* pixels = readBlob(reader);
+				Texture* texture = find(m_textures, id);
+				if (texture && pixels && pixels->size() >= static_cast<size_t>(width) * height * texture->getChannels()) texture->edit(x, y, width, height, const_cast<uint8_t*>(pixels->data()));
+				break;
+			}
+			case CaptureOp::UploadUniform:
+			{
+				uint64_t name = reader.read<uint64_t>();
+				ShaderDataType type = static_cast<ShaderDataType>(reader.read<uint8_t>());
+				uint8_t value[64] = {};
+				uint32_t size = SDT::size(type);
+				if (size > sizeof(value) || !reader.readBytes(value, size)) break;
+
+				Shader* shader = find(m_shaders, id);
+				if (!shader) break;
+
+				auto& handles = m_uniformHandles[id];
+				auto it = handles.find(name);
+				if (it == handles.end()) it = handles.emplace(name, shader->getUniformHandle(StringID(name))).first; //!< Resolved once per shader, like the renderers do
+				UniformHandle handle = it->second;
+
+				switch (type)
+				{
+				case ShaderDataType::Int: { int v; std::memcpy(&v, value, sizeof(v)); shader->uploadInt(handle, v); break; }
+				case ShaderDataType::Float: { float v; std::memcpy(&v, value, sizeof(v)); shader->uploadFloat(handle, v); break; }
+				case ShaderDataType::Float2: { glm::vec2 v; std::memcpy(&v, value, sizeof(v)); shader->uploadFloat2(handle, v); break; }
+				case ShaderDataType::Float3: { glm::vec3 v; std::memcpy(&v, value, sizeof(v)); shader->uploadFloat3(handle, v); break; }
+				case ShaderDataType::Float4: { glm::vec4 v; std::memcpy(&v, value, sizeof(v)); shader->uploadFloat4(handle, v); break; }
+				case ShaderDataType::Mat4: { glm::mat4 v; std::memcpy(&v, value, sizeof(v)); shader->uploadMat4(handle, v); break; }
+				default: break;
+				}
+				break;
+			}
+			case CaptureOp::BindUniformBlock:
+			{
+				uint64_t block = reader.read<uint64_t>();
+				uint32_t bindingPoint = reader.read<uint32_t>();
+				Shader* shader = find(m_shaders, id);
+				if (!shader) break;
+				int32_t blockIndex = shader->getUniformBlockIndex(StringID(block));
+				if (blockIndex >= 0) shader->bindUniformBlock(blockIndex, bindingPoint);
+				break;
+			}
+			case CaptureOp::AttachShaderBlock:
+			{
+				uint32_t shader = reader.read<uint32_t>();
+				uint64_t block = reader.read<uint64_t>();
+				UniformBuffer* uniformBuffer = find(m_uniformBuffers, id);
+				auto it = m_shaders.find(shader);
+				if (uniformBuffer && it != m_shaders.end()) uniformBuffer->attachShaderBlock(it->second, StringID(block));
+				break;
+			}
+			case CaptureOp::UploadUniformBufferField:
+			{
+				UniformFieldHandle field;
+				field.field = static_cast<int32_t>(reader.read<uint32_t>());
+				uint32_t size = reader.read<uint32_t>();
+				const uint8_t* data = reader.skip(size);
+				UniformBuffer* uniformBuffer = find(m_uniformBuffers, id);
+				if (uniformBuffer && data) uniformBuffer->uploadShaderData(field, data);
+				break;
+			}
+			case CaptureOp::FlushUniformBuffer:
+			{
+				UniformBuffer* uniformBuffer = find(m_uniformBuffers, id);
+				if (uniformBuffer) uniformBuffer->flush();
+				break;
+			}
+			case CaptureOp::UploadStorage:
+			{
+				const std::vector<uint8_t>* data = readBlob(reader);
+				ShaderStorageBuffer* storageBuffer = find(m_storageBuffers, id);
+				if (storageBuffer && data) storageBuffer->uploadData(data->data(), static_cast<uint32_t>(data->size()));
+				break;
+			}
+			case CaptureOp::BindStorage:
+			{
+				uint32_t bindingPoint = reader.read<uint32_t>();
+				ShaderStorageBuffer* storageBuffer = find(m_storageBuffers, id);
+				if (storageBuffer) storageBuffer->bind(bindingPoint);
+				break;
+			}
+			case CaptureOp::BeginStreamingFrame:
+			{
+				StreamingBuffer* streamingBuffer = find(m_streamingBuffers, id);
+				if (streamingBuffer) streamingBuffer->beginFrame();
+				m_streamedRanges[id].clear(); //!< Last frame's offsets are finished with
+				break;
+			}
+			case CaptureOp::WriteStreaming:
+			{
+				uint32_t offset = reader.read<uint32_t>();
+				uint32_t size = reader.read<uint32_t>();
+				uint32_t alignment = reader.read<uint32_t>();
+				const std::vector<uint8_t>* data = readBlob(reader);
+				StreamingBuffer* streamingBuffer = find(m_streamingBuffers, id);
+				if (!streamingBuffer || !data) break;
+
+				uint32_t replayed = 0;
+				void* destination = streamingBuffer->reserve(size, alignment, replayed);
+				if (!destination) break;
+				uint32_t committed = std::min(size, static_cast<uint32_t>(data->size()));
+				std::memcpy(destination, data->data(), committed);
+				streamingBuffer->commit(committed);
+				m_streamedRanges[id].push_back({ offset, replayed, size });
+				break;
+			}
+			case CaptureOp::BindStreamingRange:
+			{
+				StreamingBufferTarget target = static_cast<StreamingBufferTarget>(reader.read<uint8_t>());
+				uint32_t bindingPoint = reader.read<uint32_t>();
+				uint32_t offset = reader.read<uint32_t>();
+				uint32_t size = reader.read<uint32_t>();
+				StreamingBuffer* streamingBuffer = find(m_streamingBuffers, id);
+				if (streamingBuffer) streamingBuffer->bindRange(target, bindingPoint, remapStreamed(id, offset), size);
+				break;
+			}
+			case CaptureOp::BindFrameBuffer:
+			{
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->bind();
+				break;
+			}
+			case CaptureOp::UnbindFrameBuffer:
+			{
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->unbind();
+				break;
+			}
+			case CaptureOp::ResizeFrameBuffer:
+			{
+				uint32_t width = reader.read<uint32_t>();
+				uint32_t height = reader.read<uint32_t>();
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->resize(width, height);
+				break;
+			}
+			case CaptureOp::BindColourAttachment:
+			{
+				uint32_t index = reader.read<uint32_t>();
+				uint32_t slot = reader.read<uint32_t>();
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->bindColourAttachment(index, slot);
+				break;
+			}
+			case CaptureOp::BindDepthAttachment:
+			{
+				uint32_t slot = reader.read<uint32_t>();
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->bindDepthAttachment(slot);
+				break;
+			}
+			case CaptureOp::CopyDepthToDefault:
+			{
+				FrameBuffer* frameBuffer = find(m_frameBuffers, id);
+				if (frameBuffer) frameBuffer->copyDepthToDefault();
+				break;
+			}
+			default:
+				Log::error("Frame capture has an unknown call {0}, stopping", static_cast<uint32_t>(op));
+				return false; //!< Can't know how much to skip
+			}
+
+			if (reader.hasError())
+			{
+				Log::error("Frame capture is damaged, a call ran past the end of its data");
+				return false;
+			}
+		}
+		return true;
+	}
+
+	VertexBufferLayout FrameReplay::readVertexLayout(CaptureReader & reader)
+	{
+		uint32_t stride = reader.read<uint32_t>();
+		uint32_t count = reader.read<uint32_t>();
+		std::vector<VertexBufferElement> elements;
+		for (uint32_t i = 0; i < count && !reader.hasError(); i++)
+		{
+			ShaderDataType type = static_cast<ShaderDataType>(reader.read<uint8_t>());
+			bool normalised = reader.read<uint8_t>() != 0;
+			elements.emplace_back(type, normalised);
+		}
+		return VertexBufferLayout(elements, stride);
+	}
+
+	UniformBufferLayout FrameReplay::readUniformLayout(CaptureReader & reader)
+	{
+		uint32_t stride = reader.read<uint32_t>();
+		uint32_t count = reader.read<uint32_t>();
+		std::vector<UniformBufferElement> elements;
+		for (uint32_t i = 0; i < count && !reader.hasError(); i++)
+		{
+			m_names.push_back(reader.readString()); //!< A deque never moves its strings
+			ShaderDataType type = static_cast<ShaderDataType>(reader.read<uint8_t>());
+			elements.emplace_back(m_names.back().c_str(), type);
+		}
+		return UniformBufferLayout(elements, stride);
+	}
+
+	const std::vector<uint8_t>* FrameReplay::readBlob(CaptureReader & reader)
+	{
+		uint32_t index = reader.read<uint32_t>();
+		if (index >= m_blobs.size())
+		{
+			m_skipped++;
+			return nullptr;
+		}
+		return &m_blobs[index];
+	}
+
+	uint32_t FrameReplay::remapStreamed(uint32_t streamingBuffer, uint32_t offset)
+	{
+		auto ranges = m_streamedRanges.find(streamingBuffer);
+		if (ranges == m_streamedRanges.end()) return offset;
+
+		for (auto it = ranges->second.rbegin(); it != ranges->second.rend(); ++it) //!< Latest write first, a region can be written twice in a frame when it wraps
+		{
+			if (offset >= it->captured && offset < it->captured + it->size) return it->replayed + (offset - it->captured);
+		}
+		return offset; //!< Not written this frame, leave it where it was
+	}
+
+	template<typename T>
+	T* FrameReplay::find(std::unordered_map<uint32_t, std::shared_ptr<T>>& resources, uint32_t id)
+	{
+		if (!id) return nullptr; //!< Nothing was bound
+		auto it = resources.find(id);
+		if (it == resources.end() || !it->second)
+		{
+			m_skipped++;
+			return nullptr;
+		}
+		return it->second.get();
+	}
+}
@@ -0,0 +1,144 @@
+/*! \file gpuProfiler.cpp */
+#include "engine_pch.h"
+#include "renderer/gpuProfiler.h"
+#include "systems/log.h"
+#include <algorithm>
+
+namespace Engine
+{
+	std::vector<GPUProfiler::PendingScope> GPUProfiler::s_frames[GPUProfiler::framesInFlight]; //!< Initialise the frames in flight
+	std::vector<std::shared_ptr<TimerQuery>> GPUProfiler::s_pool; //!< Initialise the query pool
+	std::vector<GPUScopeTiming> GPUProfiler::s_results; //!< Initialise the results
+	uint64_t GPUProfiler::s_frame = 0; //!< Initialise the frame number
+	uint32_t GPUProfiler::s_depth = 0; //!< Initialise the open scope count
+	TimerQuery* GPUProfiler::s_running = nullptr; //!< Initialise the running query
+	float GPUProfiler::s_frameTime = 0.f; //!< Initialise the frame time
+	uint32_t GPUProfiler::s_dropped = 0; //!< Initialise the dropped frame count
+
+	void GPUProfiler::beginFrame()
+	{
+		endFrame(); //!< In case the last frame wasn't ended
+		s_frame++;
+
+		for (uint32_t age = framesInFlight; age > 0; age--) //!< Oldest first, so results are published in frame order
+		{
+			if (s_frame < age) continue; //!< Not that many frames yet
+			auto& frame = s_frames[(s_frame - age) % framesInFlight];
+			if (frame.empty()) continue;
+
+			bool ready = true;
+			for (auto& scope : frame) ready = ready && scope.query->isReady();
+			if (!ready) break; //!< The GPU runs frames in order, so newer frames won't be done either
+
+			collect(frame);
+		}
+
+		auto& current = s_frames[s_frame % framesInFlight];
+		if (!current.empty())
+		{
+			s_dropped++; //!< Still unfinished after framesInFlight frames, reuse its queries rather than wait for them
+			recycle(current);
+		}
+	}
+
+	void GPUProfiler::endFrame()
+	{
+		if (s_running) s_running->end(); //!< Close a scope left open, so the query can't run into the next frame
+		s_running = nullptr;
+		s_depth = 0;
+	}
+
+	void GPUProfiler::beginScope(const char* name)
+	{
+		if (s_depth++ > 0) return; //!< Already timing, this scope is counted in the outer one
+
+		std::shared_ptr<TimerQuery> query;
+		if (s_pool.empty()) query.reset(TimerQuery::create()); //!< The pool only grows until it covers framesInFlight frames
+		else
+		{
+			query = s_pool.back();
+			s_pool.pop_back();
+		}
+		if (!query) return;
+
+		query->begin();
+		s_running = query.get();
+		s_frames[s_frame % framesInFlight].push_back({ name, query });
+	}
+
+	void GPUProfiler::endScope()
+	{
+		if (s_depth == 0) return; //!< No scope to end
+		if (--s_depth > 0) return; //!< Ending an inner scope
+
+		if (s_running) s_running->end();
+		s_running = nullptr;
+	}
+
+	float GPUProfiler::getTime(StringID name)
+	{
+		for (auto& timing : s_results)
+		{
+			if (timing.id == name) return timing.milliseconds;
+		}
+		return 0.f;
+	}
+
+	void GPUProfiler::logResults()
+	{
+		Log::info("GPU time over {0} frames, {1} dropped:", s_frame, s_dropped);
+		for (auto& timing : s_results)
+		{
+			Log::info("  {0}: {1:.3f} ms, average {2:.3f} ms, longest {3:.3f} ms", timing.name, timing.milliseconds, timing.getAverage(), timing.maxMilliseconds);
+		}
+	}
+
+	void GPUProfiler::reset()
+	{
+		s_results.clear();
+		s_frameTime = 0.f;
+		s_dropped = 0;
+	}
+
+	void GPUProfiler::shutdown()
+	{
+		endFrame(); //!< Stop a running query before it is deleted
+		for (auto& frame : s_frames) frame.clear(); //!< Unread results are lost
+		s_pool.clear();
+	}
+
+	void GPUProfiler::collect(std::vector<PendingScope>& frame)
+	{
+		float frameTime = 0.f;
+		for (auto& scope : frame)
+		{
+			float milliseconds = static_cast<float>(scope.query->getElapsed()) * 1e-6f; //!< Ready, so this doesn't wait
+			GPUScopeTiming& timing = getTiming(scope.name);
+			timing.milliseconds = milliseconds;
+			timing.maxMilliseconds = std::max(timing.maxMilliseconds, milliseconds);
+			timing.totalMilliseconds += milliseconds;
+			timing.samples++;
+			frameTime += milliseconds;
+		}
+		s_frameTime = frameTime;
+
+		recycle(frame);
+	}
+
+	void GPUProfiler::recycle(std::vector<PendingScope>& frame)
+	{
+		for (auto& scope : frame) s_pool.push_back(scope.query);
+		frame.clear(); //!< Keeps its memory for a later frame
+	}
+
+	GPUScopeTiming& GPUProfiler::getTiming(const char* name)
+	{
+		StringID id(name);
+		for (auto& timing : s_results)
+		{
+			if (timing.id == id) return timing;
+		}
+		s_results.push_back({ id, name });
+		return s_results.back();
+	}
+}
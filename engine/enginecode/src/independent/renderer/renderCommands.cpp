@@ -1,121 +1,252 @@
-/*! \file renderCommands.cpp */
-#include "engine_pch.h"
-#include <glad/glad.h>
-#include "renderer/renderCommands.h"
-#include "rendering/renderAPI.h"
-#include "systems/log.h"
-#include "renderer/OpenGLRenderCommands.h"
-
-namespace Engine
-{
-	RenderCommand * RenderCommand::clearDepthColourCommand()
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::Direct3D:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLClearDepthColourCommand(); //!< Pass the command to openGL render commands
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::None:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		default:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		}
-	}
-
-	RenderCommand * RenderCommand::setClearColourCommand(float r, float g, float b, float a)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::Direct3D:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLSetClearColourCommand(r,g,b,a); //!< Pass the command to openGL render commands
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::None:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		default:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		}
-	}
-
-	RenderCommand * RenderCommand::setDepthTestCommand(bool enabled)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::Direct3D:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLSetDepthTestCommand(enabled); //!< Pass the command to openGL render commands
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::None:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		default:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		}
-	}
-
-	RenderCommand * RenderCommand::setBackfaceCullingCommand(bool enabled)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::Direct3D:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLSetBackfaceCullingCommand(enabled); //!< Pass the command to openGL render commands
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::None:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		default:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		}
-	}
-
-	RenderCommand * RenderCommand::setBlendCommand(bool enabled)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::Direct3D:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLSetBlendCommand(enabled); //!< Pass the command to openGL render commands
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::None:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		default:
-			Log::error("Renderer API not supported."); //!< This RenderAPI is not implemented
-			break;
-		}
-	}
-
-}
\ No newline at end of file
+/*! \file renderCommands.cpp */
+#include "engine_pch.h"
+#include "renderer/renderCommands.h"
+#include "rendering/renderAPI.h"
+#include "systems/log.h"
+#include "renderer/OpenGLRenderCommands.h"
+#include "renderer/NullRenderCommands.h"
+#include <cstring>
+
+namespace Engine
+{
+	namespace
+	{
+		RenderCommand makeCommand(RenderCommandType type) //!< A command with every byte zeroed, padding and unused union members included, so captures written from it are the same every run
+		{
+			RenderCommand command;
+			std::memset(&command, 0, sizeof(RenderCommand));
+			command.type = type;
+			return command;
+		}
+	}
+
+	RenderCommand RenderCommand::clearDepthColourCommand()
+	{
+		return makeCommand(RenderCommandType::ClearDepthColour);
+	}
+
+	RenderCommand RenderCommand::clearDepthCommand()
+	{
+		return makeCommand(RenderCommandType::ClearDepth);
+	}
+
+	RenderCommand RenderCommand::setClearColourCommand(float r, float g, float b, float a)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetClearColour);
+		command.colour[0] = r;
+		command.colour[1] = g;
+		command.colour[2] = b;
+		command.colour[3] = a;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setDepthTestCommand(bool enabled)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetDepthTest);
+		command.enabled = enabled;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setBackfaceCullingCommand(bool enabled)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetBackfaceCulling);
+		command.enabled = enabled;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setBlendCommand(bool enabled)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetBlend);
+		command.enabled = enabled;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setBlendModeCommand(BlendMode mode)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetBlendMode);
+		command.blendMode = mode;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setDepthWriteCommand(bool enabled)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetDepthWrite);
+		command.enabled = enabled;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setDepthClampCommand(bool enabled)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetDepthClamp);
+		command.enabled = enabled;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setDepthFuncCommand(DepthFunc func)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetDepthFunc);
+		command.depthFunc = func;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setCullFaceCommand(CullFace face)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetCullFace);
+		command.cullFace = face;
+		return command;
+	}
+
+	RenderCommand RenderCommand::setViewportCommand(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::SetViewport);
+		command.viewport = { x, y, width, height };
+		return command;
+	}
+
+	RenderCommand RenderCommand::useShaderCommand(uint32_t renderID)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::UseShader);
+		command.shader = { renderID };
+		return command;
+	}
+
+	RenderCommand RenderCommand::bindTextureCommand(uint32_t unit, uint32_t renderID)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::BindTexture);
+		command.texture = { unit, renderID };
+		return command;
+	}
+
+	RenderCommand RenderCommand::bindVertexArrayCommand(uint32_t vertexArray, uint32_t indexBuffer)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::BindVertexArray);
+		command.geometry = { vertexArray, indexBuffer };
+		return command;
+	}
+
+	RenderCommand RenderCommand::drawIndexedCommand(uint32_t count, uint32_t baseVertex, uint32_t instances)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::DrawIndexed);
+		command.draw = { count, baseVertex, instances };
+		return command;
+	}
+
+	RenderCommand RenderCommand::drawArraysCommand(uint32_t first, uint32_t count)
+	{
+		RenderCommand command = makeCommand(RenderCommandType::DrawArrays);
+		command.drawArrays = { first, count };
+		return command;
+	}
+
+	const char * RenderCommand::getName(RenderCommandType type)
+	{
+		switch (type)
+		{
+		case RenderCommandType::ClearDepthColour: return "ClearDepthColour";
+		case RenderCommandType::ClearDepth: return "ClearDepth";
+		case RenderCommandType::SetClearColour: return "SetClearColour";
+		case RenderCommandType::SetDepthTest: return "SetDepthTest";
+		case RenderCommandType::SetBackfaceCulling: return "SetBackfaceCulling";
+		case RenderCommandType::SetBlend: return "SetBlend";
+		case RenderCommandType::SetBlendMode: return "SetBlendMode";
+		case RenderCommandType::SetDepthWrite: return "SetDepthWrite";
+		case RenderCommandType::SetDepthFunc: return "SetDepthFunc";
+		case RenderCommandType::SetCullFace: return "SetCullFace";
+		case RenderCommandType::SetViewport: return "SetViewport";
+		case RenderCommandType::UseShader: return "UseShader";
+		case RenderCommandType::BindTexture: return "BindTexture";
+		case RenderCommandType::BindVertexArray: return "BindVertexArray";
+		case RenderCommandType::DrawIndexed: return "DrawIndexed";
+		case RenderCommandType::DrawArrays: return "DrawArrays";
+		case RenderCommandType::SetDepthClamp: return "SetDepthClamp";
+		default: return "Unknown";
+		}
+	}
+
+	void RenderCommandBuffer::log() const
+	{
+		for (uint32_t i = 0; i < size(); i++)
+		{
+			const RenderCommand& command = m_commands[i];
+			const char* name = RenderCommand::getName(command.type);
+			switch (command.type)
+			{
+			case RenderCommandType::SetClearColour:
+				Log::info("{0}: {1} ({2}, {3}, {4}, {5})", i, name, command.colour[0], command.colour[1], command.colour[2], command.colour[3]);
+				break;
+			case RenderCommandType::ClearDepthColour:
+			case RenderCommandType::ClearDepth:
+				Log::info("{0}: {1}", i, name);
+				break;
+			case RenderCommandType::SetBlendMode:
+				Log::info("{0}: {1} {2}", i, name, command.blendMode == BlendMode::Additive ? "additive" : "alpha");
+				break;
+			case RenderCommandType::SetDepthFunc:
+				Log::info("{0}: {1} {2}", i, name, command.depthFunc == DepthFunc::GreaterEqual ? "greater or equal" : "less");
+				break;
+			case RenderCommandType::SetCullFace:
+				Log::info("{0}: {1} {2}", i, name, command.cullFace == CullFace::Front ? "front" : "back");
+				break;
+			case RenderCommandType::SetViewport:
+				Log::info("{0}: {1} ({2}, {3}, {4}, {5})", i, name, command.viewport.x, command.viewport.y, command.viewport.width, command.viewport.height);
+				break;
+			case RenderCommandType::UseShader:
+				Log::info("{0}: {1} {2}", i, name, command.shader.renderID);
+				break;
+			case RenderCommandType::BindTexture:
+				Log::info("{0}: {1} unit {2}, texture {3}", i, name, command.texture.unit, command.texture.renderID);
+				break;
+			case RenderCommandType::BindVertexArray:
+				Log::info("{0}: {1} {2}, index buffer {3}", i, name, command.geometry.vertexArray, command.geometry.indexBuffer);
+				break;
+			case RenderCommandType::DrawIndexed:
+				Log::info("{0}: {1} {2} indices, base vertex {3}, {4} instances", i, name, command.draw.count, command.draw.baseVertex, command.draw.instances);
+				break;
+			case RenderCommandType::DrawArrays:
+				Log::info("{0}: {1} {2} vertices from {3}", i, name, command.drawArrays.count, command.drawArrays.first);
+				break;
+			default:
+				Log::info("{0}: {1} {2}", i, name, command.enabled ? "on" : "off");
+				break;
+			}
+		}
+	}
+
+	void RenderCommandExecutor::execute(const RenderCommand & command)
+	{
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			NullRenderCommands::execute(command); //!< Count the command without doing anything
+			break;
+		case RenderAPI::API::OpenGL:
+			OpenGLRenderCommands::execute(command); //!< Pass the command to openGL render commands
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+	}
+
+	void RenderCommandExecutor::execute(const RenderCommandBuffer & buffer, uint32_t first)
+	{
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			for (uint32_t i = first; i < buffer.size(); i++) NullRenderCommands::execute(buffer[i]); //!< Count the commands without doing anything
+			break;
+		case RenderAPI::API::OpenGL:
+			for (uint32_t i = first; i < buffer.size(); i++) OpenGLRenderCommands::execute(buffer[i]); //!< One API check for the whole buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+	}
+}
@@ -0,0 +1,96 @@
+/*! \file renderStats.cpp */
+#include "engine_pch.h"
+#include "renderer/renderStats.h"
+#include "renderer/renderer2D.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace Engine
+{
+	RenderFrameStats RenderStats::s_current; //!< Initialise the current counts
+	RenderFrameStats RenderStats::s_last; //!< Initialise the last frame's counts
+	float RenderStats::s_frameTimes[RenderStats::historySize]; //!< Initialise the frame time ring
+	uint32_t RenderStats::s_frameCount = 0; //!< Initialise the frame count
+	std::chrono::steady_clock::time_point RenderStats::s_lastBegin; //!< Initialise the last begin time
+
+	void RenderStats::beginFrame()
+	{
+		auto now = std::chrono::steady_clock::now();
+		if (s_lastBegin.time_since_epoch().count() != 0)
+		{
+			s_frameTimes[s_frameCount % historySize] = std::chrono::duration<float, std::milli>(now - s_lastBegin).count(); //!< Begin to begin, so waiting counts too
+			s_frameCount++;
+		}
+		s_lastBegin = now;
+
+		s_current = RenderFrameStats(); //!< Zero the counts
+	}
+
+	void RenderStats::endFrame()
+	{
+		s_last = s_current;
+	}
+
+	void RenderStats::countCommand(const RenderCommand & command)
+	{
+		switch (command.type)
+		{
+		case RenderCommandType::DrawIndexed:
+			s_current.drawCalls++;
+			s_current.triangles += static_cast<uint64_t>(command.draw.count / 3) * command.draw.instances;
+			break;
+		case RenderCommandType::DrawArrays:
+			s_current.drawCalls++;
+			s_current.triangles += command.drawArrays.count / 3;
+			break;
+		case RenderCommandType::UseShader:
+			s_current.programBinds++;
+			break;
+		case RenderCommandType::BindTexture:
+			s_current.textureBinds++;
+			break;
+		case RenderCommandType::BindVertexArray:
+			s_current.vertexArrayBinds++;
+			break;
+		default:
+			s_current.stateChanges++; //!< Clears, blending, depth, culling and viewport changes
+			break;
+		}
+	}
+
+	FrameTimeStats RenderStats::getFrameTimes()
+	{
+		FrameTimeStats result;
+		result.frames = std::min(s_frameCount, historySize);
+		if (result.frames == 0) return result;
+
+		float sorted[historySize];
+		std::copy(s_frameTimes, s_frameTimes + result.frames, sorted); //!< Order doesn't matter once sorted, so the ring can be copied as it is
+		std::sort(sorted, sorted + result.frames);
+
+		float total = 0.f;
+		for (uint32_t i = 0; i < result.frames; i++) total += sorted[i];
+
+		result.min = sorted[0];
+		result.average = total / result.frames;
+		result.p99 = sorted[std::min(result.frames - 1, (result.frames * 99) / 100)]; //!< Nearest rank
+		return result;
+	}
+
+	void RenderStats::submitOverlay(const glm::vec2 & position, const glm::vec4 & tint, float scale)
+	{
+		const RenderFrameStats& stats = s_last;
+		FrameTimeStats times = getFrameTimes();
+		float lineHeight = 100.f * scale; //!< Renderer2D's glyphs are 100 pixels tall
+
+		char lines[6][96];
+		snprintf(lines[0], sizeof(lines[0]), "Frame %.2f / %.2f / %.2f ms (min/avg/p99)", times.min, times.average, times.p99);
+		snprintf(lines[1], sizeof(lines[1]), "Draws %u  Tris %llu  Batches %u", stats.drawCalls, static_cast<unsigned long long>(stats.triangles), stats.batches);
+		snprintf(lines[2], sizeof(lines[2]), "Binds prog %u  tex %u  vao %u", stats.programBinds, stats.textureBinds, stats.vertexArrayBinds);
+		snprintf(lines[3], sizeof(lines[3]), "State %u  Uniforms %u", stats.stateChanges, stats.uniformUploads);
+		snprintf(lines[4], sizeof(lines[4]), "Buffers %.1f KB  Textures %.1f KB", stats.bufferBytes / 1024.0, stats.textureBytes / 1024.0);
+		snprintf(lines[5], sizeof(lines[5]), "Over %u frames", times.frames);
+
+		for (uint32_t i = 0; i < 6; i++) Renderer2D::submit(lines[i], position + glm::vec2(0.f, lineHeight * i), tint, scale); //!< Each glyph is an upload and a batch of its own, so the overlay shows up in the next frame's counts
+	}
+}
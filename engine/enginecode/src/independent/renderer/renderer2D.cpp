@@ -1,241 +1,286 @@
-/*! \file renderer2D */
-
-#include "engine_pch.h"
-#include "systems/log.h"
-#include <glad/glad.h>
-#include "renderer/renderer2D.h"
-
-#include <glm/gtc/matrix_transform.hpp>
-
-namespace Engine
-{
-	std::shared_ptr<Renderer2D::InternalData> Renderer2D::s_data = nullptr;
-
-	void Renderer2D::init()
-	{
-		s_data.reset(new InternalData); //!< Resets the s_data pointer to have a new internaldata
-		unsigned char whitePix[4] = { 255, 255, 255, 255 }; //!< Creates a pure white pixel
-		s_data->defaultTexture.reset(Texture::create(1, 1, 4, whitePix)); //!< Makes the default texture to be pure white
-
-		s_data->defaultTint = { 1.f, 1.f, 1.f, 1.f }; //!< Default tint is white
-
-		s_data->model = glm::mat4(1.0f); //!< Assigns the translate to be a matrix of 1s
-
-		s_data->shader.reset(Shader::create("./assets/shaders/quad1.glsl"));//!< Sets the shader to be the quad1.glsl shader
-
-		float vertices[4 * 4] = //!< Default square vertices
-		{
-			-0.5f, -0.5f, 0.f, 0.f,
-			-0.5f,  0.5f, 0.f, 1.f,
-			 0.5f,  0.5f, 1.f, 1.f,
-			 0.5f, -0.5f, 1.f, 0.f
-		};
-
-		uint32_t indices[4] = { 0,1,2,3 }; //!< Indices of a square
-
-		std::shared_ptr<VertexBuffer> VBO; //!< Pointer to a vertex buffer
-		std::shared_ptr<IndexBuffer> IBO; //!< Pointer to an index buffer
-
-		s_data->VAO.reset(VertexArray::create()); //!< creates the internal data's vertex array
-		VBO.reset(VertexBuffer::create(vertices, sizeof(vertices), VertexBufferLayout({ ShaderDataType::Float2, ShaderDataType::Float2 }))); //!< Resets the vertexBuffer with a layout of two vec2s
-		IBO.reset(IndexBuffer::create(indices, 4)); //!< Creates the indexbuffer on the pointer with the indices previously defined
-		s_data->VAO->addVertexBuffer(VBO); //!< adds the vertex buffer to the vertex array
-		s_data->VAO->setIndexBuffer(IBO); //!< Adds the index buffer to the vertex array
-
-
-		//Font Filepath
-		const char * fontFilePath = "./assets/fonts/cour.ttf"; //!< Defines the font's filepath
-
-		//Glyph Buffer data
-		s_data->glyphBufferDimensions = { 256, 256 }; //!< Sets the glyph's dimensions
-		s_data->glyphBufferSize = s_data->glyphBufferDimensions.x * s_data->glyphBufferDimensions.y * 4 * sizeof(unsigned char); //!< Sets the glyph's size
-		s_data->glyphBuffer.reset(static_cast<unsigned char *>(malloc(s_data->glyphBufferSize))); //!< creates the glyphbuffer
-
-		//Init freetype
-		if(FT_Init_FreeType(&s_data->ft)) Log::error("Error: Freetype could not be initialised"); //!< Initialises freetype
-
-		//Load font
-		if (FT_New_Face(s_data->ft, fontFilePath, 0, &s_data->fontFace)) Log::error("Could not load font face: {0}", fontFilePath); //!< Loads the font
-
-		//set char size
-		int32_t charSize = 100;
-		if (FT_Set_Pixel_Sizes(s_data->fontFace, 0, charSize)) Log::error("Freetype failed to set font size of: {0}", charSize); //!< Sets the character size
-
-		//Init font text
-		s_data->fontTexture.reset(Texture::create(s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, 4, nullptr)); //!< Sets the font texture via pointer reset
-
-		//Fill glyph buffer
-		memset(s_data->glyphBuffer.get(), 60, s_data->glyphBufferSize); //!< Fills the glyph buffer
-
-		//send glyphBuffer to the texture on the gpu
-		s_data->fontTexture->edit(0, 0, s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, s_data->glyphBuffer.get()); //!< gives the GPU the glyph buffer
-
-	}
-
-	void Renderer2D::begin(const SceneWideUniform & sceneWideUniform)
-	{
-		//Bind shader
-		glUseProgram(s_data->shader->getRenderID()); //!< Binds the shader
-
-		//Apply scenewideuniform
-		for (auto& dataPair : sceneWideUniform) //!< Goes through the scenewide uniforms and attaches them to the shader
-		{
-			const char* nameOfUniformBlock = dataPair.first;
-			dataPair.second->attachShaderBlock(s_data->shader, nameOfUniformBlock);
-		}
-
-		//bind the geometry
-		glBindVertexArray(s_data->VAO->getRenderID()); //!< binds the vertex array to the s_data vertex array
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, s_data->VAO->getIndexBuffer()->getRenderID()); //!< binds the index buffer to the GL element array buffer
-	}
-
-	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint)
-	{
-		Renderer2D::submit(quad, tint, s_data->defaultTexture); //!< Pass the parameters to a different submit, with the default texture
-	}
-
-	void Renderer2D::submit(const Quad & quad, const std::shared_ptr<Texture>& texture)
-	{
-		Renderer2D::submit(quad, s_data->defaultTint, texture); //!< Pass the parameters to a different submit, with the default tint
-	}
-
-	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, const std::shared_ptr<Texture>& texture) //!< Sort of like a "Master Submit"
-	{
-		glBindTexture(GL_TEXTURE_2D, texture->getRenderID()); //!< Bind the 2D texture
-		s_data->model = glm::scale(glm::translate(glm::mat4(1.f), quad.m_translate), quad.m_scale); //!< Translate and scale the model
-
-		s_data->shader->uploadInt("u_texData", 0);			  //!< Upload the texData to the shader
-		s_data->shader->uploadFloat4("u_tint", tint);		  //!< Upload tint to the shader
-		s_data->shader->uploadMat4("u_model", s_data->model); //!< Upload model to the shader
-
-		glDrawElements(GL_QUADS, s_data->VAO->getDrawCount(), GL_UNSIGNED_INT, nullptr); //!< Draw the quad
-	}
-
-	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, const std::shared_ptr<Texture>& texture, float angle, bool degrees)
-	{
-		if (degrees) angle = glm::radians(angle); //!< Turn the degrees to radians if necessary
-
-		glBindTexture(GL_TEXTURE_2D, texture->getRenderID()); //!< Bind the 2D texture
-		s_data->model = glm::scale(glm::rotate(glm::translate(glm::mat4(1.f), quad.m_translate), angle, { 0.f, 0.f, 1.f }), quad.m_scale);  //!< Translate, scale and rotate the model
-
-		s_data->shader->uploadInt("u_texData", 0);				//!< Upload the texData to the shader
-		s_data->shader->uploadFloat4("u_tint", tint);			//!< Upload tint to the shader
-		s_data->shader->uploadMat4("u_model", s_data->model);	//!< Upload model to the shader
-
-		glDrawElements(GL_QUADS, s_data->VAO->getDrawCount(), GL_UNSIGNED_INT, nullptr); //!< draw the model
-	}
-
-	void Renderer2D::submit(const Quad & quad, const std::shared_ptr<Texture>& texture, float angle, bool degrees)
-	{
-		submit(quad, s_data->defaultTint, texture, angle, degrees); //!< Pass the parameters to a different submit with a default tint
-	}
-
-	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, float angle, bool degrees)
-	{
-		submit(quad, tint, s_data->defaultTexture, angle, degrees); //!< Pass the parameters to a different submit with a default texture
-	}
-
-	void Renderer2D::submit(char txt, const glm::vec2 & position, float & advance, const glm::vec4& tint)
-	{
-		//Get glyph
-		if (FT_Load_Char(s_data->fontFace, txt, FT_LOAD_RENDER)) Log::error("Could not load glyph for char: {0}", txt); //!< If the glyph char load fails then log it, else:
-		else
-		{
-			//Glyph data
-			uint32_t glyphWidth = s_data->fontFace->glyph->bitmap.width; //!< Defines the glyph's width
-			uint32_t glyphHeight = s_data->fontFace->glyph->bitmap.rows; //!< Defines the glyph's height
-			glm::vec2 glyphSize(glyphWidth, glyphHeight); //!< Sets the glyph's size to a vec2
-			glm::vec2 glyphBearing(s_data->fontFace->glyph->bitmap_left, -s_data->fontFace->glyph->bitmap_top); //!< Set the glyph's bearing to a vec2 to get the glyph's position
-			
-			//Advance
-			advance = static_cast<float>(s_data->fontFace->glyph->advance.x >> 6); //!< assigns the advance
-
-			//Calc quad for the glyph
-			glm::vec2 glyphPos = position + glyphBearing; //!< Defines the glyph position
-			Quad quad = Quad::createTopLeftSize(glyphPos, glm::vec2(s_data->fontTexture->getWidthf(), s_data->fontTexture->getHeightf())); //!< creates a quad using the top left and the size 
-
-			RtoRGBA(s_data->fontFace->glyph->bitmap.buffer, glyphWidth, glyphHeight); //!< Makes the text bitmap
-			s_data->fontTexture->edit(0, 0, s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, s_data->glyphBuffer.get()); //!< Passes the font 
-
-			//Submit quad
-			Renderer2D::submit(quad, tint, s_data->fontTexture); //!< Submits the quad through the "Master Submit"
-		}
-	}
-
-	void Renderer2D::submit(const char * txt, const glm::vec2 & position, const glm::vec4& tint)
-	{
-		uint32_t length = strlen(txt); //!< Gets the length of the string
-		float advance = 0.f, pos = position.x; //!< Gets the advance and current position
-		for (int32_t i = 0; i < length; i++) //!< Seperates the string into individual chars and submits them
-		{
-			submit(txt[i], { pos, position.y }, advance, tint); //!< Submit the individual character
-			pos += advance; //!< Move the position of the next character, so the characters dont stack
-		}
-	}
-
-	void Renderer2D::end()
-	{
-
-	}
-
-	void Renderer2D::RtoRGBA(unsigned char * Rbuffer, uint32_t width, uint32_t height)
-	{
-		memset(s_data->glyphBuffer.get(), 0, s_data->glyphBufferSize); //!< Set the memory of the glyphbuffer
-
-		unsigned char * pWalker = s_data->glyphBuffer.get(); //!< Get the glyphBuffer
-		for (int32_t i = 0; i < height; i++)//!< Goes along the height of the bitmap colouring pixels
-		{
-			for (int32_t j = 0; j < width; j++) //!< Goes along the width of the bitmap colouring pixels
-			{
-				//pWalker += 3;
-				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
-				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
-				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
-				*pWalker = *Rbuffer; //!< Set the alpha channel
-				pWalker++; //!< Goes to R of next pixel
-				Rbuffer++; //!< Goes to next monochrome pixel
-			}
-			pWalker += (s_data->glyphBufferDimensions.x - width)  * 4; //!< adds the glyphbuffer's X axis dimensions minus the width to pWalker, multiplied by the number of channels (4)
-		}
-
-	}
-
-	Quad Quad::createCentreHalfExtend(const glm::vec2& centre, const glm::vec2& halfExtents)
-	{
-		Quad result; //!< Pre-define result
-		result.m_translate = glm::vec3(centre, 0.f); //!< Get the centre as a vec3
-		result.m_scale = glm::vec3(halfExtents * 2.f, 1.f); //!< uses the half extents to get the scale, via doubling them to get the size
-		return result; //!< Return the resulting quad
-	}
-
-	Quad Quad::createCentreHalfExtend(const glm::vec2& centre, float halfExtents)
-	{
-		Quad result; //!< Pre-define result
-		result.m_translate = glm::vec3(centre, 0.f); //!< Get the centre as a vec3
-		result.m_scale = glm::vec3(halfExtents * 2.f, halfExtents * 2.f, 1.f); //!< uses the half extent to get the scale, via doubling it to get the size
-		return result; //!< Return the resulting quad
-	}
-
-	Quad Quad::createTopLeftSize(const glm::vec2& topLeft, const glm::vec2& size)
-	{
-		Quad result; //!< Pre-define result
-		result.m_translate = glm::vec3(topLeft.x + (size.x / 2), topLeft.y + (size.y / 2), 0.f); //Plus on Y because higher numbers lower the block, Y axis is inverted
-		result.m_scale = glm::vec3(size, 1.f); //!< turn size into a vec3
-		return result; //!< Return the resulting quad
-	}
-
-	Quad Quad::createTopLeftSize(const glm::vec2& topLeft, float size)
-	{
-		Quad result; //!< Pre-define result
-		result.m_translate = glm::vec3(topLeft.x + (size / 2), topLeft.y + (size / 2), 0.f); //Plus on Y because higher numbers lower the block, Y axis is inverted
-		result.m_scale = glm::vec3(size, size, 1.f); //!< Turn size into a vec3
-		return result; //!< Return the resulting quad
-	}
-
-	Quad Quad::createTopLeftBottomRight(const glm::vec2& topLeft, const glm::vec2& bottomRight)
-	{
-		Quad result; //!< Pre-define result
-		glm::vec2 size(bottomRight.x - topLeft.x, bottomRight.y - topLeft.y); //!< Uses the coordinates to find the width and height, and put them into a "size" vec2
-		return Quad::createTopLeftSize(topLeft, size); //!< Pass the top left and the size to createTopLeftSize
-	}
+/*! \file renderer2D */
+
+#include "engine_pch.h"
+#include "systems/log.h"
+#include "renderer/renderer2D.h"
+#include "renderer/gpuProfiler.h"
+#include "renderer/renderStats.h"
+#include "systems/profiler.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <vector>
+
+namespace Engine
+{
+	std::shared_ptr<Renderer2D::InternalData> Renderer2D::s_data = nullptr;
+
+	void Renderer2D::init()
+	{
+		s_data.reset(new InternalData); //!< Resets the s_data pointer to have a new internaldata
+		unsigned char whitePix[4] = { 255, 255, 255, 255 }; //!< Creates a pure white pixel
+		s_data->defaultTexture.reset(Texture::create(1, 1, 4, whitePix)); //!< Makes the default texture to be pure white
+
+		s_data->defaultTint = { 1.f, 1.f, 1.f, 1.f }; //!< Default tint is white
+
+		s_data->model = glm::mat4(1.0f); //!< Assigns the translate to be a matrix of 1s
+
+		s_data->shader.reset(Shader::create("./assets/shaders/quad1.glsl"));//!< Sets the shader to be the quad1.glsl shader
+		s_data->texDataUniform = s_data->shader->getUniformHandle("u_texData"_sid); //!< Resolve the sampler once
+
+		s_data->quadCorners[0] = { -0.5f, -0.5f }; //!< Corners of a unit quad, in the order the index pattern expects
+		s_data->quadCorners[1] = { -0.5f,  0.5f };
+		s_data->quadCorners[2] = {  0.5f,  0.5f };
+		s_data->quadCorners[3] = {  0.5f, -0.5f };
+		s_data->quadTexCoords[0] = { 0.f, 0.f };
+		s_data->quadTexCoords[1] = { 0.f, 1.f };
+		s_data->quadTexCoords[2] = { 1.f, 1.f };
+		s_data->quadTexCoords[3] = { 1.f, 0.f };
+
+		std::vector<uint32_t> indices(batchQuads * 6); //!< Two triangles per quad, the same pattern for every batch
+		for (uint32_t i = 0; i < batchQuads; i++)
+		{
+			uint32_t first = i * 4;
+			uint32_t* quadIndices = &indices[i * 6];
+			quadIndices[0] = first; quadIndices[1] = first + 1; quadIndices[2] = first + 2;
+			quadIndices[3] = first + 2; quadIndices[4] = first + 3; quadIndices[5] = first;
+		}
+		s_data->IBO.reset(IndexBuffer::create(indices.data(), static_cast<uint32_t>(indices.size()))); //!< Creates the index buffer for a full batch
+
+		s_data->quadStream.reset(StreamingBuffer::create(batchQuads * 4 * sizeof(QuadVertex) * 4)); //!< Room for a few full batches a frame
+
+		s_data->batchVAO.reset(VertexArray::create()); //!< Vertex format for the batched quads, the vertices come straight from the streaming buffer
+		s_data->batchVAO->setStreamingVertexBuffer(s_data->quadStream, VertexBufferLayout({ ShaderDataType::Float2, ShaderDataType::Float2, ShaderDataType::Float4 }, sizeof(QuadVertex))); //!< Position, texture coordinates and tint
+		s_data->batchVAO->setIndexBuffer(s_data->IBO);
+
+
+		//Font Filepath
+		const char * fontFilePath = "./assets/fonts/cour.ttf"; //!< Defines the font's filepath
+
+		//Glyph Buffer data
+		s_data->glyphBufferDimensions = { 256, 256 }; //!< Sets the glyph's dimensions
+		s_data->glyphBufferSize = s_data->glyphBufferDimensions.x * s_data->glyphBufferDimensions.y * 4 * sizeof(unsigned char); //!< Sets the glyph's size
+		s_data->glyphBuffer.reset(static_cast<unsigned char *>(malloc(s_data->glyphBufferSize))); //!< creates the glyphbuffer
+
+		//Init freetype
+		if(FT_Init_FreeType(&s_data->ft)) Log::error("Error: Freetype could not be initialised"); //!< Initialises freetype
+
+		//Load font
+		if (FT_New_Face(s_data->ft, fontFilePath, 0, &s_data->fontFace)) Log::error("Could not load font face: {0}", fontFilePath); //!< Loads the font
+
+		//set char size
+		int32_t charSize = 100;
+		if (FT_Set_Pixel_Sizes(s_data->fontFace, 0, charSize)) Log::error("Freetype failed to set font size of: {0}", charSize); //!< Sets the character size
+
+		//Init font text
+		s_data->fontTexture.reset(Texture::create(s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, 4, nullptr)); //!< Sets the font texture via pointer reset
+
+		//Fill glyph buffer
+		memset(s_data->glyphBuffer.get(), 60, s_data->glyphBufferSize); //!< Fills the glyph buffer
+
+		//send glyphBuffer to the texture on the gpu
+		s_data->fontTexture->edit(0, 0, s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, s_data->glyphBuffer.get()); //!< gives the GPU the glyph buffer
+
+	}
+
+	void Renderer2D::begin(const SceneWideUniform & sceneWideUniform)
+	{
+		NG_PROFILE_FUNCTION();
+		GPUProfiler::beginScope("Renderer2D"); //!< Time the scene on the GPU, up to end
+
+		s_data->quadStream->beginFrame(); //!< Write this frame's quads into a region the GPU isn't reading
+
+		//Bind shader
+		RendererCommon::actionCommand(RenderCommand::useShaderCommand(s_data->shader->getRenderID())); //!< Binds the shader
+		s_data->shader->uploadInt(s_data->texDataUniform, 0); //!< Every batch samples unit 0
+
+		//Apply scenewideuniform
+		for (auto& dataPair : sceneWideUniform) //!< Goes through the scenewide uniforms and attaches them to the shader
+		{
+			StringID nameOfUniformBlock = dataPair.first;
+			dataPair.second->flush(); //!< Send the staged changes, one upload per buffer
+			dataPair.second->attachShaderBlock(s_data->shader, nameOfUniformBlock);
+		}
+
+		//bind the geometry
+		RendererCommon::actionCommand(RenderCommand::bindVertexArrayCommand(s_data->batchVAO->getRenderID())); //!< Binds the batch vertex array, which holds the index buffer too
+	}
+
+	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint)
+	{
+		Renderer2D::submit(quad, tint, s_data->defaultTexture); //!< Pass the parameters to a different submit, with the default texture
+	}
+
+	void Renderer2D::submit(const Quad & quad, const std::shared_ptr<Texture>& texture)
+	{
+		Renderer2D::submit(quad, s_data->defaultTint, texture); //!< Pass the parameters to a different submit, with the default tint
+	}
+
+	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, const std::shared_ptr<Texture>& texture) //!< Sort of like a "Master Submit"
+	{
+		s_data->model = glm::scale(glm::translate(glm::mat4(1.f), quad.m_translate), quad.m_scale); //!< Translate and scale the model
+		batchQuad(s_data->model, tint, texture); //!< Add it to the batch
+	}
+
+	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, const std::shared_ptr<Texture>& texture, float angle, bool degrees)
+	{
+		if (degrees) angle = glm::radians(angle); //!< Turn the degrees to radians if necessary
+
+		s_data->model = glm::scale(glm::rotate(glm::translate(glm::mat4(1.f), quad.m_translate), angle, { 0.f, 0.f, 1.f }), quad.m_scale);  //!< Translate, scale and rotate the model
+		batchQuad(s_data->model, tint, texture); //!< Add it to the batch
+	}
+
+	void Renderer2D::submit(const Quad & quad, const std::shared_ptr<Texture>& texture, float angle, bool degrees)
+	{
+		submit(quad, s_data->defaultTint, texture, angle, degrees); //!< Pass the parameters to a different submit with a default tint
+	}
+
+	void Renderer2D::submit(const Quad & quad, const glm::vec4 & tint, float angle, bool degrees)
+	{
+		submit(quad, tint, s_data->defaultTexture, angle, degrees); //!< Pass the parameters to a different submit with a default texture
+	}
+
+	void Renderer2D::submit(char txt, const glm::vec2 & position, float & advance, const glm::vec4& tint, float scale)
+	{
+		//Get glyph
+		if (FT_Load_Char(s_data->fontFace, txt, FT_LOAD_RENDER)) Log::error("Could not load glyph for char: {0}", txt); //!< If the glyph char load fails then log it, else:
+		else
+		{
+			//Glyph data
+			uint32_t glyphWidth = s_data->fontFace->glyph->bitmap.width; //!< Defines the glyph's width
+			uint32_t glyphHeight = s_data->fontFace->glyph->bitmap.rows; //!< Defines the glyph's height
+			glm::vec2 glyphSize(glyphWidth, glyphHeight); //!< Sets the glyph's size to a vec2
+			glm::vec2 glyphBearing(s_data->fontFace->glyph->bitmap_left, -s_data->fontFace->glyph->bitmap_top); //!< Set the glyph's bearing to a vec2 to get the glyph's position
+			
+			//Advance
+			advance = static_cast<float>(s_data->fontFace->glyph->advance.x >> 6) * scale; //!< assigns the advance
+
+			//Calc quad for the glyph
+			glm::vec2 glyphPos = position + glyphBearing * scale; //!< Defines the glyph position
+			Quad quad = Quad::createTopLeftSize(glyphPos, glm::vec2(s_data->fontTexture->getWidthf(), s_data->fontTexture->getHeightf()) * scale); //!< creates a quad using the top left and the size 
+
+			flushBatch(); //!< Quads already batched may use the font texture's current glyph, draw them before it changes
+			RtoRGBA(s_data->fontFace->glyph->bitmap.buffer, glyphWidth, glyphHeight); //!< Makes the text bitmap
+			s_data->fontTexture->edit(0, 0, s_data->glyphBufferDimensions.x, s_data->glyphBufferDimensions.y, s_data->glyphBuffer.get()); //!< Passes the font 
+
+			//Submit quad
+			Renderer2D::submit(quad, tint, s_data->fontTexture); //!< Submits the quad through the "Master Submit"
+		}
+	}
+
+	void Renderer2D::submit(const char * txt, const glm::vec2 & position, const glm::vec4& tint, float scale)
+	{
+		uint32_t length = strlen(txt); //!< Gets the length of the string
+		float advance = 0.f, pos = position.x; //!< Gets the advance and current position
+		for (int32_t i = 0; i < length; i++) //!< Seperates the string into individual chars and submits them
+		{
+			submit(txt[i], { pos, position.y }, advance, tint, scale); //!< Submit the individual character
+			pos += advance; //!< Move the position of the next character, so the characters dont stack
+		}
+	}
+
+	void Renderer2D::end()
+	{
+		NG_PROFILE_FUNCTION();
+		flushBatch(); //!< Draw whatever is left in the batch
+
+		GPUProfiler::endScope();
+	}
+
+	void Renderer2D::batchQuad(const glm::mat4 & model, const glm::vec4 & tint, const std::shared_ptr<Texture>& texture)
+	{
+		if (s_data->batchCount == batchQuads || (s_data->batchTexture && s_data->batchTexture != texture)) flushBatch(); //!< Full, or needs a different texture
+
+		if (!s_data->batchVertices)
+		{
+			void* data = s_data->quadStream->reserve(batchQuads * 4 * sizeof(QuadVertex), sizeof(QuadVertex), s_data->batchOffset); //!< Room for a full batch, only what is used is kept
+			if (!data) return;
+			s_data->batchVertices = static_cast<QuadVertex*>(data);
+		}
+		s_data->batchTexture = texture;
+
+		QuadVertex* vertex = s_data->batchVertices + s_data->batchCount * 4; //!< Written straight into GPU visible memory
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			vertex[i].position = glm::vec2(model * glm::vec4(s_data->quadCorners[i], 1.f, 1.f)); //!< Transform on the CPU so the whole batch shares one draw
+			vertex[i].texCoord = s_data->quadTexCoords[i];
+			vertex[i].tint = tint;
+		}
+		s_data->batchCount++;
+	}
+
+	void Renderer2D::flushBatch()
+	{
+		if (s_data->batchCount == 0) return; //!< Nothing batched
+		NG_PROFILE_FUNCTION();
+		RenderStats::countBatch();
+
+		s_data->quadStream->commit(s_data->batchCount * 4 * sizeof(QuadVertex)); //!< Keep the vertices written, hand the rest of the reservation back
+		RendererCommon::actionCommand(RenderCommand::bindTextureCommand(0, s_data->batchTexture->getRenderID())); //!< Bind the batch's texture
+		RendererCommon::actionCommand(RenderCommand::drawIndexedCommand(s_data->batchCount * 6, s_data->batchOffset / sizeof(QuadVertex))); //!< Draw every quad in the batch, the base vertex picks out this batch's vertices
+
+		s_data->batchCount = 0; //!< Start a new batch
+		s_data->batchVertices = nullptr;
+		s_data->batchTexture.reset();
+	}
+
+	void Renderer2D::RtoRGBA(unsigned char * Rbuffer, uint32_t width, uint32_t height)
+	{
+		memset(s_data->glyphBuffer.get(), 0, s_data->glyphBufferSize); //!< Set the memory of the glyphbuffer
+
+		unsigned char * pWalker = s_data->glyphBuffer.get(); //!< Get the glyphBuffer
+		for (int32_t i = 0; i < height; i++)//!< Goes along the height of the bitmap colouring pixels
+		{
+			for (int32_t j = 0; j < width; j++) //!< Goes along the width of the bitmap colouring pixels
+			{
+				//pWalker += 3;
+				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
+				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
+				*pWalker = 255; pWalker++; //!< Sets the data  at pWalker to be 255, making it full. Then moves to the next address
+				*pWalker = *Rbuffer; //!< Set the alpha channel
+				pWalker++; //!< Goes to R of next pixel
+				Rbuffer++; //!< Goes to next monochrome pixel
+			}
+			pWalker += (s_data->glyphBufferDimensions.x - width)  * 4; //!< adds the glyphbuffer's X axis dimensions minus the width to pWalker, multiplied by the number of channels (4)
+		}
+
+	}
+
+	Quad Quad::createCentreHalfExtend(const glm::vec2& centre, const glm::vec2& halfExtents)
+	{
+		Quad result; //!< Pre-define result
+		result.m_translate = glm::vec3(centre, 0.f); //!< Get the centre as a vec3
+		result.m_scale = glm::vec3(halfExtents * 2.f, 1.f); //!< uses the half extents to get the scale, via doubling them to get the size
+		return result; //!< Return the resulting quad
+	}
+
+	Quad Quad::createCentreHalfExtend(const glm::vec2& centre, float halfExtents)
+	{
+		Quad result; //!< Pre-define result
+		result.m_translate = glm::vec3(centre, 0.f); //!< Get the centre as a vec3
+		result.m_scale = glm::vec3(halfExtents * 2.f, halfExtents * 2.f, 1.f); //!< uses the half extent to get the scale, via doubling it to get the size
+		return result; //!< Return the resulting quad
+	}
+
+	Quad Quad::createTopLeftSize(const glm::vec2& topLeft, const glm::vec2& size)
+	{
+		Quad result; //!< Pre-define result
+		result.m_translate = glm::vec3(topLeft.x + (size.x / 2), topLeft.y + (size.y / 2), 0.f); //Plus on Y because higher numbers lower the block, Y axis is inverted
+		result.m_scale = glm::vec3(size, 1.f); //!< turn size into a vec3
+		return result; //!< Return the resulting quad
+	}
+
+	Quad Quad::createTopLeftSize(const glm::vec2& topLeft, float size)
+	{
+		Quad result; //!< Pre-define result
+		result.m_translate = glm::vec3(topLeft.x + (size / 2), topLeft.y + (size / 2), 0.f); //Plus on Y because higher numbers lower the block, Y axis is inverted
+		result.m_scale = glm::vec3(size, size, 1.f); //!< Turn size into a vec3
+		return result; //!< Return the resulting quad
+	}
+
+	Quad Quad::createTopLeftBottomRight(const glm::vec2& topLeft, const glm::vec2& bottomRight)
+	{
+		Quad result; //!< Pre-define result
+		glm::vec2 size(bottomRight.x - topLeft.x, bottomRight.y - topLeft.y); //!< Uses the coordinates to find the width and height, and put them into a "size" vec2
+		return Quad::createTopLeftSize(topLeft, size); //!< Pass the top left and the size to createTopLeftSize
+	}
 }
\ No newline at end of file
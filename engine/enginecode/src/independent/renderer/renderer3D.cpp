@@ -1,78 +1,244 @@
-/*! \file renderer3D.cpp */
-#include "engine_pch.h"
-#include <glad/glad.h>
-#include "renderer/renderer3D.h"
-#include "rendering/uniformBuffer.h"
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-
-
-namespace Engine
-{
-	std::shared_ptr<Renderer3D::InternalData> Renderer3D::s_data = nullptr;
-
-	void Renderer3D::init()
-	{
-		s_data.reset(new InternalData); //!< Reset s_data's internal data
-		unsigned char whitePix[4] = { 255, 255, 255, 255 }; //!< Define a white pixel
-		s_data->defaultTexture.reset(Texture::create(1, 1, 4, whitePix)); //!< Create a white texture for the default
-
-		s_data->defaultTint = { 1.f, 1.f, 1.f, 1.f }; //!< Set the default tint as blank
-	}
-
-	void Renderer3D::begin(const SceneWideUniform & sceneWideUniform)
-	{
-		s_data->sceneWideUniform = sceneWideUniform; //!< Set s_data's scene wide uniforms
-	}
-
-	void Renderer3D::submit(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4 & model)
-	{
-		//Bind shader
-		glUseProgram(material->getShader()->getRenderID()); //!< Bind the shader
-		//Could be made API agnostic via abstraction
-
-		//Apply scenewideuniform
-		for (auto& dataPair : s_data->sceneWideUniform) //!< Goes through the scenewide uniforms and attaches them to the shader
-		{
-			const char* nameOfUniform = dataPair.first;
-			dataPair.second->attachShaderBlock(material->getShader(), nameOfUniform);
-		}
-
-		//apply material uniforms (per draw uniforms)
-		material->getShader()->uploadMat4("u_model", model); //!< uploads the model
-
-		//texture
-		if (material->isFlagSet(Material::flag_texture)) //!< If the flag is set, there is a material
-		{
-			glBindTexture(GL_TEXTURE_2D, material->getTexture()->getRenderID()); //!< Bind the texture if there is one
-		}
-		else
-		{
-			glBindTexture(GL_TEXTURE_2D, s_data->defaultTexture->getRenderID()); //!< Bind the default texture if there isnt one
-		}
-		material->getShader()->uploadInt("u_texData", 0); //!< Uploads the texdata
-
-
-		//tint
-		if (material->isFlagSet(Material::flag_tint)) //!< If the flag is set, there is a tint
-		{
-			material->getShader()->uploadFloat4("u_tint", material->getTint()); //!< Upload the tint if there is one
-		}
-		else
-		{
-			material->getShader()->uploadFloat4("u_tint", s_data->defaultTint); //!< Upload the default tint if there isnt one
-		}
-
-		//bind geometry (vao and ibo)
-		glBindVertexArray(geometry->getRenderID()); //!< Bind the vertex array
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, geometry->getIndexBuffer()->getRenderID()); //!< bind the index buffer
-
-		//submit the draw call
-		glDrawElements(GL_TRIANGLES, geometry->getDrawCount(), GL_UNSIGNED_INT, nullptr); //!< Draw the submitted object
-	}
-
-	void Renderer3D::end()
-	{
-		s_data->sceneWideUniform.clear(); //!< Clear the scene wide uniforms
-	}
-}
\ No newline at end of file
+/*! \file renderer3D.cpp */
+#include "engine_pch.h"
+#include "renderer/renderer3D.h"
+#include "rendering/uniformBuffer.h"
+#include "systems/log.h"
+#include "renderer/gpuProfiler.h"
+#include "systems/profiler.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstring>
+
+
+namespace Engine
+{
+	std::shared_ptr<Renderer3D::InternalData> Renderer3D::s_data = nullptr;
+
+	void Renderer3D::init(uint32_t width, uint32_t height)
+	{
+		s_data.reset(new InternalData); //!< Reset s_data's internal data
+		unsigned char whitePix[4] = { 255, 255, 255, 255 }; //!< Define a white pixel
+		s_data->defaultTexture.reset(Texture::create(1, 1, 4, whitePix)); //!< Create a white texture for the default
+
+		s_data->defaultTint = { 1.f, 1.f, 1.f, 1.f }; //!< Set the default tint as blank
+
+		s_data->fallbackShader.reset(Shader::create("./assets/shaders/fallback.glsl")); //!< Compiled up front, so there is always something to draw with
+		s_data->drawStream.reset(StreamingBuffer::create(drawStreamSize)); //!< Per draw constants, instead of two glUniform calls a draw
+
+		//Deferred
+		s_data->gBuffer.reset(FrameBuffer::create(width, height, { AttachmentFormat::RGBA8, AttachmentFormat::RG16F })); //!< Albedo, octahedral packed normal, and depth
+		s_data->geometryShader.reset(Shader::create("./assets/shaders/deferredGeometry.glsl")); //!< Writes the G-buffer
+		s_data->ambientShader.reset(Shader::create("./assets/shaders/deferredAmbient.glsl")); //!< Ambient light over the whole screen
+		s_data->lightShader.reset(Shader::create("./assets/shaders/deferredLight.glsl")); //!< One light per instance
+
+		s_data->ambientAlbedo = s_data->ambientShader->getUniformHandle("u_albedo"_sid); //!< Resolve the lighting pass uniforms once
+		s_data->ambientDepth = s_data->ambientShader->getUniformHandle("u_depth"_sid);
+		s_data->lightAlbedo = s_data->lightShader->getUniformHandle("u_albedo"_sid);
+		s_data->lightNormal = s_data->lightShader->getUniformHandle("u_normal"_sid);
+		s_data->lightDepth = s_data->lightShader->getUniformHandle("u_depth"_sid);
+		s_data->lightScreenSize = s_data->lightShader->getUniformHandle("u_screenSize"_sid);
+
+		float cubeVertices[8 * 3] = //!< Corners of a unit cube, corner i has x, y and z set by bits 0, 1 and 2
+		{
+			-1.f, -1.f, -1.f,
+			 1.f, -1.f, -1.f,
+			-1.f,  1.f, -1.f,
+			 1.f,  1.f, -1.f,
+			-1.f, -1.f,  1.f,
+			 1.f, -1.f,  1.f,
+			-1.f,  1.f,  1.f,
+			 1.f,  1.f,  1.f
+		};
+
+		uint32_t cubeIndices[36] = //!< Counter clockwise from outside
+		{
+			1, 3, 7, 1, 7, 5, //+x
+			0, 4, 6, 0, 6, 2, //-x
+			2, 6, 7, 2, 7, 3, //+y
+			0, 1, 5, 0, 5, 4, //-y
+			4, 5, 7, 4, 7, 6, //+z
+			0, 2, 3, 0, 3, 1  //-z
+		};
+
+		std::shared_ptr<VertexBuffer> cubeVBO; //!< Pointer to the cube's vertex buffer
+		std::shared_ptr<IndexBuffer> cubeIBO; //!< Pointer to the cube's index buffer
+
+		s_data->lightVolume.reset(VertexArray::create()); //!< Create the light volume
+		cubeVBO.reset(VertexBuffer::create(cubeVertices, sizeof(cubeVertices), VertexBufferLayout({ ShaderDataType::Float3 }))); //!< Positions only
+		cubeIBO.reset(IndexBuffer::create(cubeIndices, 36));
+		s_data->lightVolume->addVertexBuffer(cubeVBO);
+		s_data->lightVolume->setIndexBuffer(cubeIBO);
+
+		s_data->fullscreen.reset(VertexArray::create()); //!< No buffers, the vertex shader makes the triangle from gl_VertexID
+	}
+
+	void Renderer3D::onResize(uint32_t width, uint32_t height)
+	{
+		if (s_data) s_data->gBuffer->resize(width, height); //!< Keep the G-buffer the size of the window
+	}
+
+	void Renderer3D::begin(const SceneWideUniform & sceneWideUniform, RenderPath renderPath, ClusteredLighting* lighting)
+	{
+		NG_PROFILE_FUNCTION();
+		GPUProfiler::beginScope("Renderer3D"); //!< Time the scene on the GPU, up to end
+
+		s_data->sceneWideUniform = sceneWideUniform; //!< Set s_data's scene wide uniforms
+		s_data->renderPath = renderPath; //!< Set the path for this scene
+		s_data->lighting = lighting; //!< Set the lights for this scene
+		s_data->boundShader = nullptr; //!< The scene wide uniforms may have changed, so attach them again on the first draw
+
+		for (auto& dataPair : sceneWideUniform) dataPair.second->flush(); //!< Send this frame's staged uniform block changes, one upload per buffer
+		s_data->drawStream->beginFrame(); //!< Write this scene's draw constants into a region the GPU has finished with
+
+		Shader::updatePending(); //!< Once a frame, so async compiles are spread out
+		Texture::updatePending(); //!< Likewise for async texture uploads
+
+		if (renderPath == RenderPath::Deferred)
+		{
+			if (!lighting)
+			{
+				Log::error("Deferred rendering needs the scene's lights, using forward rendering"); //!< Nothing to light the G-buffer with
+				s_data->renderPath = RenderPath::Forward;
+				return;
+			}
+			s_data->gBuffer->bind(); //!< Draw into the G-buffer
+			RendererCommon::actionCommand(RenderCommand::clearDepthColourCommand()); //!< Clear last frame's G-buffer
+		}
+	}
+
+	void Renderer3D::submit(const std::shared_ptr<VertexArray>& geometry, const std::shared_ptr<Material>& material, const glm::mat4 & model)
+	{
+		draw(*geometry, *material, model);
+	}
+
+	void Renderer3D::submit(const DrawList & drawList)
+	{
+		NG_PROFILE_FUNCTION();
+		for (const auto& command : drawList) draw(*command.geometry, *command.material, command.model); //!< Sorted by state, so most draws skip the shader change
+	}
+
+	std::shared_ptr<Shader> Renderer3D::getDrawShader(Material & material)
+	{
+		std::shared_ptr<Shader> shader = s_data->renderPath == RenderPath::Deferred ? s_data->geometryShader->getVariant(material.getFlags()) : material.getShaderVariant(); //!< Deferred draws only write surface data
+		if (!shader || !shader->isReady()) shader = s_data->fallbackShader; //!< Still compiling, draw something cheap in its place
+		return shader;
+	}
+
+	void Renderer3D::draw(VertexArray & geometry, Material & material, const glm::mat4 & model)
+	{
+		//Bind shader
+		std::shared_ptr<Shader> shader = getDrawShader(material);
+
+		if (shader != s_data->boundShader) //!< Draws in a row with the same shader skip all of this
+		{
+			RendererCommon::actionCommand(RenderCommand::useShaderCommand(shader->getRenderID())); //!< Bind the shader
+
+			//Apply scenewideuniform
+			for (auto& dataPair : s_data->sceneWideUniform) //!< Goes through the scenewide uniforms and attaches them to the shader
+			{
+				StringID nameOfUniform = dataPair.first;
+				dataPair.second->attachShaderBlock(shader, nameOfUniform); //!< The binding is cached on the program, so only a shader's first scene reaches the driver
+			}
+
+			s_data->boundShader = shader;
+			s_data->boundTexData = shader->getUniformHandle("u_texData"_sid); //!< Once per shader change, the draws after it use the handle
+		}
+
+		//apply material uniforms (per draw uniforms)
+		DrawConstants constants = { model, material.isFlagSet(Material::flag_tint) ? material.getTint() : s_data->defaultTint }; //!< The default tint if there isn't one
+		uint32_t offset = 0;
+		void* destination = s_data->drawStream->allocate(sizeof(DrawConstants), 16, offset);
+		if (!destination) return; //!< The stream has logged it. Skipped, as b_draw would still hold the last draw's model and tint
+		std::memcpy(destination, &constants, sizeof(DrawConstants)); //!< Straight into GPU visible memory
+		s_data->drawStream->bindRange(StreamingBufferTarget::Uniform, drawBlockBinding, offset, sizeof(DrawConstants)); //!< One bind for the model and tint
+
+		uint32_t features = shader->getFeatures(); //!< Permutations only have the features the material uses, shaders without permutations need the defaults
+
+		//texture
+		if (features & Material::flag_texture)
+		{
+			if (material.isFlagSet(Material::flag_texture)) //!< If the flag is set, there is a material
+			{
+				RendererCommon::actionCommand(RenderCommand::bindTextureCommand(0, material.getTexture()->getRenderID())); //!< Bind the texture if there is one
+			}
+			else
+			{
+				RendererCommon::actionCommand(RenderCommand::bindTextureCommand(0, s_data->defaultTexture->getRenderID())); //!< Bind the default texture if there isnt one
+			}
+			shader->uploadInt(s_data->boundTexData, 0); //!< Uploads the texdata
+		}
+
+		//bind geometry (vao and ibo)
+		RendererCommon::actionCommand(RenderCommand::bindVertexArrayCommand(geometry.getRenderID(), geometry.getIndexBuffer()->getRenderID())); //!< Bind the vertex array and the index buffer
+
+		//submit the draw call
+		RendererCommon::actionCommand(RenderCommand::drawIndexedCommand(geometry.getDrawCount())); //!< Draw the submitted object
+	}
+
+	void Renderer3D::end()
+	{
+		NG_PROFILE_FUNCTION();
+		if (s_data->renderPath == RenderPath::Deferred) lightingPass(); //!< Shade the G-buffer
+
+		s_data->sceneWideUniform.clear(); //!< Clear the scene wide uniforms
+		s_data->lighting = nullptr; //!< Lights are only borrowed for the scene
+		s_data->boundShader = nullptr; //!< Anything could be bound before the next scene
+
+		GPUProfiler::endScope();
+	}
+
+	void Renderer3D::lightingPass()
+	{
+		auto& gBuffer = s_data->gBuffer;
+		gBuffer->copyDepthToDefault(); //!< Light volumes and anything drawn after this scene depth test against the G-buffer's geometry
+		RendererCommon::actionCommand(RenderCommand::setViewportCommand(0, 0, gBuffer->getWidth(), gBuffer->getHeight())); //!< Cover the window
+
+		gBuffer->bindColourAttachment(0, 0); //!< Albedo
+		gBuffer->bindColourAttachment(1, 1); //!< Normal
+		gBuffer->bindDepthAttachment(2); //!< Depth
+
+		glm::vec2 screenSize(gBuffer->getWidth(), gBuffer->getHeight());
+
+		//Ambient, touches every covered pixel once
+		RendererCommon::actionCommand(RenderCommand::setDepthTestCommand(false)); //!< Fullscreen, depth is read from the G-buffer instead
+		RendererCommon::actionCommand(RenderCommand::useShaderCommand(s_data->ambientShader->getRenderID()));
+		for (auto& dataPair : s_data->sceneWideUniform) dataPair.second->attachShaderBlock(s_data->ambientShader, dataPair.first);
+		s_data->ambientShader->uploadInt(s_data->ambientAlbedo, 0);
+		s_data->ambientShader->uploadInt(s_data->ambientDepth, 2);
+		RendererCommon::actionCommand(RenderCommand::bindVertexArrayCommand(s_data->fullscreen->getRenderID()));
+		RendererCommon::actionCommand(RenderCommand::drawArraysCommand(0, 3)); //!< One triangle covering the screen
+
+		//Lights, each one only touches the pixels inside its volume
+		uint32_t lightCount = static_cast<uint32_t>(s_data->lighting->getLights().size());
+		if (lightCount > 0)
+		{
+			RendererCommon::actionCommand(RenderCommand::setDepthTestCommand(true));
+			RendererCommon::actionCommand(RenderCommand::setDepthWriteCommand(false)); //!< Keep the scene's depth
+			RendererCommon::actionCommand(RenderCommand::setDepthFuncCommand(DepthFunc::GreaterEqual)); //!< Back faces behind the surface, so the surface is inside the volume. Still works with the camera inside
+			RendererCommon::actionCommand(RenderCommand::setBackfaceCullingCommand(true));
+			RendererCommon::actionCommand(RenderCommand::setCullFaceCommand(CullFace::Front)); //!< Draw the volume's back faces
+			RendererCommon::actionCommand(RenderCommand::setDepthClampCommand(true)); //!< Back faces past the far plane sit on it instead of being clipped, so lights near it still reach the surfaces in front
+			RendererCommon::actionCommand(RenderCommand::setBlendCommand(true));
+			RendererCommon::actionCommand(RenderCommand::setBlendModeCommand(BlendMode::Additive)); //!< Add each light on top
+
+			RendererCommon::actionCommand(RenderCommand::useShaderCommand(s_data->lightShader->getRenderID()));
+			for (auto& dataPair : s_data->sceneWideUniform) dataPair.second->attachShaderBlock(s_data->lightShader, dataPair.first);
+			s_data->lightShader->uploadInt(s_data->lightAlbedo, 0);
+			s_data->lightShader->uploadInt(s_data->lightNormal, 1);
+			s_data->lightShader->uploadInt(s_data->lightDepth, 2);
+			s_data->lightShader->uploadFloat2(s_data->lightScreenSize, screenSize);
+			s_data->lighting->bind(); //!< Same light data as the clustered forward path
+
+			RendererCommon::actionCommand(RenderCommand::bindVertexArrayCommand(s_data->lightVolume->getRenderID(), s_data->lightVolume->getIndexBuffer()->getRenderID()));
+			RendererCommon::actionCommand(RenderCommand::drawIndexedCommand(s_data->lightVolume->getDrawCount(), 0, lightCount)); //!< One instance per light
+
+			RendererCommon::actionCommand(RenderCommand::setBlendCommand(false)); //!< Put the state back how the forward path expects it
+			RendererCommon::actionCommand(RenderCommand::setBlendModeCommand(BlendMode::Alpha));
+			RendererCommon::actionCommand(RenderCommand::setCullFaceCommand(CullFace::Back));
+			RendererCommon::actionCommand(RenderCommand::setDepthClampCommand(false));
+			RendererCommon::actionCommand(RenderCommand::setDepthFuncCommand(DepthFunc::Less));
+			RendererCommon::actionCommand(RenderCommand::setDepthWriteCommand(true));
+		}
+		RendererCommon::actionCommand(RenderCommand::setDepthTestCommand(true));
+	}
+}
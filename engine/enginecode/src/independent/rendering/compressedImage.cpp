@@ -0,0 +1,370 @@
+/*! \file compressedImage.cpp */
+#include "engine_pch.h"
+#include "rendering/compressedImage.h"
+#include "systems/log.h"
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <cctype>
+
+namespace Engine
+{
+	namespace
+	{
+		constexpr uint32_t fourCC(const char(&code)[5]) { return code[0] | (code[1] << 8) | (code[2] << 16) | (static_cast<uint32_t>(code[3]) << 24); } //!< Four characters packed as DDS stores them
+
+		const uint32_t ddsMagic = fourCC("DDS "); //!< First four bytes of a DDS file
+		const uint32_t ddsFlagMipCount = 0x20000; //!< DDSD_MIPMAPCOUNT, the mip count is set
+		const uint32_t ddsPixelFourCC = 0x4; //!< DDPF_FOURCC, the pixel format is given by its FourCC
+		const uint32_t ddsCaps2Cube = 0x200; //!< DDSCAPS2_CUBEMAP
+		const uint32_t ddsCaps2Volume = 0x200000; //!< DDSCAPS2_VOLUME
+		const uint32_t dx10Texture2D = 3; //!< D3D10_RESOURCE_DIMENSION_TEXTURE2D
+		const uint32_t dx10MiscCube = 0x4; //!< D3D11_RESOURCE_MISC_TEXTURECUBE
+
+		const uint8_t ktx2Identifier[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A }; //!< First twelve bytes of a KTX2 file
+
+		/*! \struct DDSPixelFormat
+		* \brief DDS_PIXELFORMAT
+		*/
+		struct DDSPixelFormat
+		{
+			uint32_t size, flags, fourCC, rgbBitCount, redMask, greenMask, blueMask, alphaMask; //!< Fields as stored
+		};
+
+		/*! \struct DDSHeader
+		* \brief DDS_HEADER, follows the magic number
+		*/
+		struct DDSHeader
+		{
+			uint32_t size, flags, height, width, pitchOrLinearSize, depth, mipMapCount; //!< Fields as stored
+			uint32_t reserved1[11]; //!< Unused
+			DDSPixelFormat pixelFormat; //!< Pixel format
+			uint32_t caps, caps2, caps3, caps4, reserved2; //!< Fields as stored
+		};
+
+		/*! \struct DDSHeaderDX10
+		* \brief DDS_HEADER_DXT10, follows the header when the FourCC is DX10
+		*/
+		struct DDSHeaderDX10
+		{
+			uint32_t dxgiFormat, resourceDimension, miscFlag, arraySize, miscFlags2; //!< Fields as stored
+		};
+
+		/*! \struct KTX2Header
+		* \brief KTX2 header and index, follows the identifier
+		*/
+		struct KTX2Header
+		{
+			uint32_t vkFormat, typeSize, pixelWidth, pixelHeight, pixelDepth, layerCount, faceCount, levelCount, supercompressionScheme; //!< Header fields
+			uint32_t dfdByteOffset, dfdByteLength, kvdByteOffset, kvdByteLength; //!< Index fields
+			uint32_t sgdByteOffset[2], sgdByteLength[2]; //!< Supercompression global data, unused without supercompression. 64 bit values, split so the struct isn't padded
+		};
+
+		/*! \struct KTX2Level
+		* \brief An entry in the KTX2 level index
+		*/
+		struct KTX2Level
+		{
+			uint64_t byteOffset, byteLength, uncompressedByteLength; //!< Fields as stored
+		};
+
+		/*! \struct FormatCode
+		* \brief A format's code in one of the containers
+		*/
+		struct FormatCode
+		{
+			uint32_t code; //!< DXGI_FORMAT or VkFormat
+			CompressedFormat format; //!< Format it holds
+			bool srgb; //!< sRGB encoded?
+		};
+
+		const FormatCode dxgiFormats[] = {
+			{ 71, CompressedFormat::BC1, false }, { 72, CompressedFormat::BC1, true },
+			{ 77, CompressedFormat::BC3, false }, { 78, CompressedFormat::BC3, true },
+			{ 80, CompressedFormat::BC4, false }, { 83, CompressedFormat::BC5, false },
+			{ 98, CompressedFormat::BC7, false }, { 99, CompressedFormat::BC7, true }
+		}; //!< DXGI formats read and written, the first of each format and encoding is the one written
+
+		const FormatCode vkFormats[] = {
+			{ 131, CompressedFormat::BC1, false }, { 132, CompressedFormat::BC1, true }, //!< BC1 RGB
+			{ 133, CompressedFormat::BC1, false }, { 134, CompressedFormat::BC1, true }, //!< BC1 RGBA
+			{ 137, CompressedFormat::BC3, false }, { 138, CompressedFormat::BC3, true },
+			{ 139, CompressedFormat::BC4, false }, { 141, CompressedFormat::BC5, false },
+			{ 145, CompressedFormat::BC7, false }, { 146, CompressedFormat::BC7, true }
+		}; //!< VkFormats read
+
+		template<size_t N>
+		const FormatCode* findCode(const FormatCode(&codes)[N], uint32_t code) //!< Look up a container's format code, nullptr if it isn't supported
+		{
+			for (const auto& entry : codes) if (entry.code == code) return &entry;
+			return nullptr;
+		}
+
+		uint32_t fullMipCount(uint32_t width, uint32_t height) //!< Levels from the full size down to 1x1
+		{
+			uint32_t levels = 1;
+			for (uint32_t size = std::max(width, height); size > 1; size >>= 1) levels++;
+			return levels;
+		}
+	}
+
+	CompressedImage::CompressedImage(CompressedFormat format, bool srgb, uint32_t width, uint32_t height) :
+		m_format(format), m_srgb(srgb), m_width(width), m_height(height)
+	{
+	}
+
+	bool CompressedImage::load(const char * filepath)
+	{
+		std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+		if (!file)
+		{
+			Log::error("Could not open compressed texture: {0}", filepath);
+			return false;
+		}
+		m_data.resize(static_cast<size_t>(file.tellg()));
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(m_data.data()), m_data.size()); //!< Kept whole, the levels point into it
+		m_levels.clear();
+
+		bool loaded = false;
+		if (m_data.size() >= 4 && std::memcmp(m_data.data(), &ddsMagic, 4) == 0) loaded = parseDDS();
+		else if (m_data.size() >= sizeof(ktx2Identifier) && std::memcmp(m_data.data(), ktx2Identifier, sizeof(ktx2Identifier)) == 0) loaded = parseKTX2();
+		else Log::error("Not a DDS or KTX2 file");
+
+		if (!loaded)
+		{
+			Log::error("Could not load compressed texture: {0}", filepath);
+			m_data.clear();
+			m_levels.clear();
+		}
+		return loaded;
+	}
+
+	bool CompressedImage::save(const char * filepath) const
+	{
+		const FormatCode* dxgi = nullptr;
+		for (const auto& entry : dxgiFormats) if (entry.format == m_format && entry.srgb == m_srgb) { dxgi = &entry; break; }
+		if (!dxgi || m_levels.empty())
+		{
+			Log::error("Nothing to save to {0}", filepath);
+			return false;
+		}
+
+		uint32_t legacy = 0; //!< Older readers only know the FourCCs, so they are used where there is one
+		if (!m_srgb && m_format == CompressedFormat::BC1) legacy = fourCC("DXT1");
+		else if (!m_srgb && m_format == CompressedFormat::BC3) legacy = fourCC("DXT5");
+		else if (m_format == CompressedFormat::BC4) legacy = fourCC("ATI1");
+		else if (m_format == CompressedFormat::BC5) legacy = fourCC("ATI2");
+
+		DDSHeader header = {};
+		header.size = sizeof(DDSHeader);
+		header.flags = 0x1 | 0x2 | 0x4 | 0x1000 | 0x80000 | ddsFlagMipCount; //!< Caps, height, width, pixel format, linear size and mip count are set
+		header.height = m_height;
+		header.width = m_width;
+		header.pitchOrLinearSize = m_levels[0].size;
+		header.mipMapCount = static_cast<uint32_t>(m_levels.size());
+		header.pixelFormat.size = sizeof(DDSPixelFormat);
+		header.pixelFormat.flags = ddsPixelFourCC;
+		header.pixelFormat.fourCC = legacy ? legacy : fourCC("DX10");
+		header.caps = 0x1000 | (m_levels.size() > 1 ? 0x400008 : 0); //!< Texture, plus complex and mipmap if there are levels
+
+		std::ofstream file(filepath, std::ios::binary);
+		if (!file)
+		{
+			Log::error("Could not write compressed texture: {0}", filepath);
+			return false;
+		}
+		file.write(reinterpret_cast<const char*>(&ddsMagic), sizeof(ddsMagic));
+		file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+		if (!legacy)
+		{
+			DDSHeaderDX10 dx10 = { dxgi->code, dx10Texture2D, 0, 1, 0 };
+			file.write(reinterpret_cast<const char*>(&dx10), sizeof(dx10));
+		}
+		file.write(reinterpret_cast<const char*>(m_data.data()), m_data.size()); //!< Levels are packed largest first, as DDS wants
+		return file.good();
+	}
+
+	void CompressedImage::addLevel(const uint8_t * blocks, uint32_t size)
+	{
+		m_levels.push_back({ std::max(m_width >> m_levels.size(), 1u), std::max(m_height >> m_levels.size(), 1u), static_cast<uint32_t>(m_data.size()), size });
+		m_data.insert(m_data.end(), blocks, blocks + size);
+	}
+
+	bool CompressedImage::isCompressedFile(const char * filepath)
+	{
+		std::string path(filepath);
+		std::string extension = path.substr(path.find_last_of('.') + 1);
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+		return extension == "dds" || extension == "ktx2";
+	}
+
+	uint32_t CompressedImage::getBlockSize(CompressedFormat format)
+	{
+		switch (format)
+		{
+		case CompressedFormat::BC1:
+		case CompressedFormat::BC4:
+			return 8;
+		case CompressedFormat::BC3:
+		case CompressedFormat::BC5:
+		case CompressedFormat::BC7:
+			return 16;
+		default:
+			return 0;
+		}
+	}
+
+	uint32_t CompressedImage::getLevelSize(CompressedFormat format, uint32_t width, uint32_t height)
+	{
+		return ((width + 3) / 4) * ((height + 3) / 4) * getBlockSize(format); //!< Partial blocks at the edges are still whole blocks
+	}
+
+	uint32_t CompressedImage::getChannels(CompressedFormat format)
+	{
+		switch (format)
+		{
+		case CompressedFormat::BC4:
+			return 1;
+		case CompressedFormat::BC5:
+			return 2;
+		case CompressedFormat::None:
+			return 0;
+		default:
+			return 4;
+		}
+	}
+
+	bool CompressedImage::parseDDS()
+	{
+		uint32_t offset = 4;
+		if (m_data.size() < offset + sizeof(DDSHeader)) return false;
+		DDSHeader header;
+		std::memcpy(&header, m_data.data() + offset, sizeof(header));
+		offset += sizeof(header);
+
+		if (header.size != sizeof(DDSHeader) || !(header.pixelFormat.flags & ddsPixelFourCC))
+		{
+			Log::error("DDS file isn't block compressed");
+			return false;
+		}
+		if (header.caps2 & (ddsCaps2Cube | ddsCaps2Volume))
+		{
+			Log::error("DDS cube maps and volumes aren't supported");
+			return false;
+		}
+
+		uint32_t code = header.pixelFormat.fourCC;
+		if (code == fourCC("DXT1")) m_format = CompressedFormat::BC1;
+		else if (code == fourCC("DXT5")) m_format = CompressedFormat::BC3;
+		else if (code == fourCC("ATI1") || code == fourCC("BC4U")) m_format = CompressedFormat::BC4;
+		else if (code == fourCC("ATI2") || code == fourCC("BC5U")) m_format = CompressedFormat::BC5;
+		else if (code == fourCC("DX10"))
+		{
+			if (m_data.size() < offset + sizeof(DDSHeaderDX10)) return false;
+			DDSHeaderDX10 dx10;
+			std::memcpy(&dx10, m_data.data() + offset, sizeof(dx10));
+			offset += sizeof(dx10);
+
+			if (dx10.resourceDimension != dx10Texture2D || dx10.arraySize > 1 || (dx10.miscFlag & dx10MiscCube))
+			{
+				Log::error("Only single 2D DDS textures are supported");
+				return false;
+			}
+			const FormatCode* format = findCode(dxgiFormats, dx10.dxgiFormat);
+			if (!format)
+			{
+				Log::error("DXGI format {0} isn't supported", dx10.dxgiFormat);
+				return false;
+			}
+			m_format = format->format;
+			m_srgb = format->srgb;
+		}
+		else
+		{
+			Log::error("DDS FourCC {0:x} isn't supported", code);
+			return false;
+		}
+
+		m_width = header.width;
+		m_height = header.height;
+		if (!m_width || !m_height) return false;
+
+		uint32_t levelCount = (header.flags & ddsFlagMipCount) && header.mipMapCount ? header.mipMapCount : 1; //!< Some writers leave the count 0 for a single level
+		return addLevels(std::min(levelCount, fullMipCount(m_width, m_height)), offset);
+	}
+
+	bool CompressedImage::parseKTX2()
+	{
+		uint32_t offset = sizeof(ktx2Identifier);
+		if (m_data.size() < offset + sizeof(KTX2Header)) return false;
+		KTX2Header header;
+		std::memcpy(&header, m_data.data() + offset, sizeof(header));
+		offset += sizeof(header);
+
+		if (header.supercompressionScheme != 0)
+		{
+			Log::error("Supercompressed KTX2 files aren't supported, convert with no supercompression");
+			return false;
+		}
+		if (header.pixelDepth > 1 || header.layerCount > 1 || header.faceCount != 1)
+		{
+			Log::error("Only single 2D KTX2 textures are supported");
+			return false;
+		}
+		const FormatCode* format = findCode(vkFormats, header.vkFormat);
+		if (!format)
+		{
+			Log::error("VkFormat {0} isn't supported", header.vkFormat);
+			return false;
+		}
+		m_format = format->format;
+		m_srgb = format->srgb;
+		m_width = header.pixelWidth;
+		m_height = header.pixelHeight;
+		if (!m_width || !m_height) return false;
+
+		uint32_t levelCount = std::min(std::max(header.levelCount, 1u), fullMipCount(m_width, m_height)); //!< 0 asks for mips to be made at load, only the base is stored
+		if (m_data.size() < offset + levelCount * sizeof(KTX2Level)) return false;
+
+		for (uint32_t i = 0; i < levelCount; i++)
+		{
+			KTX2Level level;
+			std::memcpy(&level, m_data.data() + offset + i * sizeof(KTX2Level), sizeof(level));
+
+			uint32_t width = std::max(m_width >> i, 1u);
+			uint32_t height = std::max(m_height >> i, 1u);
+			uint32_t size = getLevelSize(m_format, width, height);
+			if (level.byteLength < size || level.byteOffset + size > m_data.size()) //!< Level 0 is the largest in the index, whatever order the data is in
+			{
+				Log::error("KTX2 level {0} runs off the end of the file", i);
+				return false;
+			}
+			m_levels.push_back({ width, height, static_cast<uint32_t>(level.byteOffset), size });
+		}
+		return true;
+	}
+
+	bool CompressedImage::addLevels(uint32_t levelCount, uint32_t offset)
+	{
+		for (uint32_t i = 0; i < levelCount; i++)
+		{
+			uint32_t width = std::max(m_width >> i, 1u);
+			uint32_t height = std::max(m_height >> i, 1u);
+			uint32_t size = getLevelSize(m_format, width, height);
+			if (static_cast<uint64_t>(offset) + size > m_data.size())
+			{
+				if (i == 0)
+				{
+					Log::error("Compressed texture is truncated");
+					return false;
+				}
+				Log::warn("Compressed texture only has {0} of {1} mip levels", i, levelCount);
+				break; //!< Keep the levels that are there
+			}
+			m_levels.push_back({ width, height, offset, size });
+			offset += size;
+		}
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,295 @@
+/*! \file mipChain.cpp */
+#include "engine_pch.h"
+#include "rendering/mipChain.h"
+#include "systems/threadPool.h"
+#include "systems/profiler.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define NG_MIP_SSE
+#endif
+
+namespace Engine
+{
+	namespace
+	{
+		const uint32_t maxTaps = 12; //!< Taps of the widest filter
+
+		/*! \struct Kernel
+		* \brief Weights of a 2:1 filter, the same for every output texel and applied across then down
+		*/
+		struct Kernel
+		{
+			uint32_t taps; //!< Source texels per output texel
+			int32_t first; //!< Offset of the first tap from twice the output position
+			float weights[maxTaps]; //!< Weight of each tap, summing to 1
+		};
+
+		float besselI0(float x) //!< Modified Bessel function of the first kind, order 0, by its series
+		{
+			float sum = 1.f, term = 1.f;
+			for (int32_t k = 1; k < 16; k++)
+			{
+				term *= (x * 0.5f / k) * (x * 0.5f / k);
+				sum += term;
+			}
+			return sum;
+		}
+
+		Kernel makeKaiser() //!< Sinc windowed over 3 output texels either side, alpha 4
+		{
+			const float pi = 3.14159265f, width = 3.f, alpha = 4.f;
+			Kernel kernel = { maxTaps, 1 - static_cast<int32_t>(maxTaps) / 2, {} };
+			float total = 0.f;
+			for (uint32_t tap = 0; tap < maxTaps; tap++)
+			{
+				float distance = (static_cast<int32_t>(tap) + kernel.first - 0.5f) * 0.5f; //!< From the tap's centre to the output texel's, in output texels. Signed, first is negative
+				float sinc = std::sin(pi * distance) / (pi * distance); //!< Never 0, the taps are a quarter texel off the centre
+				float window = besselI0(alpha * std::sqrt(std::max(1.f - (distance / width) * (distance / width), 0.f))) / besselI0(alpha);
+				kernel.weights[tap] = sinc * window;
+				total += kernel.weights[tap];
+			}
+			for (uint32_t tap = 0; tap < maxTaps; tap++) kernel.weights[tap] /= total; //!< Flat areas stay flat
+			return kernel;
+		}
+
+		const Kernel& getKernel(MipFilter filter) //!< Kernel for a filter, made the first time it is asked for
+		{
+			static const Kernel box = { 2, 0, { 0.5f, 0.5f } };
+			static const Kernel kaiser = makeKaiser();
+			return filter == MipFilter::Kaiser ? kaiser : box;
+		}
+
+		/*! \struct ColourTables
+		* \brief Conversions between bytes and floats, sRGB or not
+		*/
+		struct ColourTables
+		{
+			ColourTables() //!< Constructor, fills the tables
+			{
+				for (uint32_t i = 0; i < 256; i++)
+				{
+					float value = i / 255.f;
+					toFloat[i] = value;
+					toLinear[i] = value <= 0.04045f ? value / 12.92f : std::pow((value + 0.055f) / 1.055f, 2.4f);
+				}
+				for (uint32_t i = 0; i < 4096; i++)
+				{
+					float value = i / 4095.f;
+					float encoded = value <= 0.0031308f ? value * 12.92f : 1.055f * std::pow(value, 1.f / 2.4f) - 0.055f;
+					fromLinear[i] = static_cast<uint8_t>(std::min(encoded * 255.f + 0.5f, 255.f));
+				}
+			}
+
+			float toFloat[256]; //!< Byte to 0 to 1
+			float toLinear[256]; //!< sRGB encoded byte to linear 0 to 1
+			uint8_t fromLinear[4096]; //!< Linear 0 to 1, scaled to 0 to 4095, to sRGB encoded byte
+		};
+
+		const ColourTables& getTables() //!< Tables, filled the first time they are asked for
+		{
+			static const ColourTables tables;
+			return tables;
+		}
+	}
+
+	MipChain::MipChain(const uint8_t * pixels, uint32_t width, uint32_t height, uint32_t channels, MipFilter filter, bool srgb, bool parallel) :
+		m_channels(channels),
+		m_filter(filter),
+		m_srgb(srgb)
+	{
+		if (!pixels || channels == 0 || channels > 4) return;
+		NG_PROFILE_SCOPE("Mip chain");
+
+		uint32_t offset = 0;
+		for (uint32_t levelWidth = width, levelHeight = height; levelWidth > 1 || levelHeight > 1;)
+		{
+			levelWidth = std::max(levelWidth / 2, 1u);
+			levelHeight = std::max(levelHeight / 2, 1u);
+			uint32_t size = levelWidth * levelHeight * channels;
+			m_levels.push_back({ levelWidth, levelHeight, offset, size });
+			offset += size;
+		}
+		m_data.resize(offset); //!< All at once, so the levels being read don't move
+
+		const uint8_t* source = pixels;
+		uint32_t sourceWidth = width, sourceHeight = height;
+		for (const auto& level : m_levels)
+		{
+			if (parallel && level.height >= s_parallelRows)
+			{
+				ThreadPool::parallelFor(level.height, [&](uint32_t begin, uint32_t end) { downsample(source, sourceWidth, sourceHeight, level, begin, end); });
+			}
+			else downsample(source, sourceWidth, sourceHeight, level, 0, level.height);
+
+			source = getData(level); //!< The next level is made from this one
+			sourceWidth = level.width;
+			sourceHeight = level.height;
+		}
+	}
+
+	uint32_t MipChain::getLevelCount(uint32_t width, uint32_t height)
+	{
+		uint32_t levels = 1;
+		for (uint32_t size = std::max(width, height); size > 1; size >>= 1) levels++;
+		return levels;
+	}
+
+	uint64_t MipChain::getChainSize(uint32_t width, uint32_t height, uint32_t channels)
+	{
+		uint64_t size = 0;
+		while (width > 1 || height > 1)
+		{
+			width = std::max(width / 2, 1u);
+			height = std::max(height / 2, 1u);
+			size += static_cast<uint64_t>(width) * height * channels;
+		}
+		return size;
+	}
+
+	void MipChain::downsample(const uint8_t * source, uint32_t sourceWidth, uint32_t sourceHeight, const MipLevel & level, uint32_t begin, uint32_t end)
+	{
+		if (m_filter == MipFilter::Box && !m_srgb)
+		{
+			downsampleBox(source, sourceWidth, sourceHeight, level, begin, end); //!< The load time case, nothing to convert so no need for floats
+			return;
+		}
+
+		const Kernel& kernel = getKernel(m_filter);
+		const ColourTables& tables = getTables();
+		const uint32_t pad = kernel.taps / 2; //!< Texels the kernel reaches past either edge
+		const int32_t alpha = m_channels == 4 ? 3 : (m_channels == 2 ? 1 : -1); //!< Alpha is blended as it is stored, never as sRGB
+
+		const float* decode[4]; //!< Table each channel is read through
+		float scale[4]; //!< What each channel is scaled by on the way back to bytes, 4095 for the sRGB table or 255 for the byte itself
+		for (int32_t channel = 0; channel < 4; channel++)
+		{
+			bool linearise = m_srgb && channel != alpha;
+			decode[channel] = linearise ? tables.toLinear : tables.toFloat;
+			scale[channel] = linearise ? 4095.f : 255.f;
+		}
+
+		std::vector<float> line((sourceWidth + pad * 2) * 4); //!< A source row as four floats a texel, with its edges repeated so no tap needs clamping
+		std::vector<float> ring(static_cast<size_t>(kernel.taps) * level.width * 4); //!< Source rows filtered across, one per tap
+		int32_t ringRows[maxTaps]; //!< Source row in each slot of the ring
+		std::fill_n(ringRows, maxTaps, INT_MIN);
+
+#ifdef NG_MIP_SSE
+		__m128 weights[maxTaps];
+		for (uint32_t tap = 0; tap < kernel.taps; tap++) weights[tap] = _mm_set1_ps(kernel.weights[tap]);
+		const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.f), half = _mm_set1_ps(0.5f);
+		const __m128 scales = _mm_loadu_ps(scale);
+#endif
+
+		for (uint32_t y = begin; y < end; y++)
+		{
+			for (uint32_t tap = 0; tap < kernel.taps; tap++)
+			{
+				int32_t row = static_cast<int32_t>(y * 2) + kernel.first + static_cast<int32_t>(tap);
+				uint32_t slot = static_cast<uint32_t>(((row % static_cast<int32_t>(kernel.taps)) + kernel.taps) % kernel.taps); //!< Rows a window apart share a slot, so moving down a row keeps the ones still needed
+				if (ringRows[slot] == row) continue; //!< Already filtered for the row above
+				ringRows[slot] = row;
+
+				const uint8_t* sourceRow = source + static_cast<size_t>(std::min(static_cast<uint32_t>(std::max(row, 0)), sourceHeight - 1)) * sourceWidth * m_channels; //!< Past the top or bottom, repeat the edge row
+				for (uint32_t x = 0; x < sourceWidth + pad * 2; x++)
+				{
+					const uint8_t* texel = sourceRow + std::min(static_cast<uint32_t>(std::max(static_cast<int32_t>(x) - static_cast<int32_t>(pad), 0)), sourceWidth - 1) * m_channels;
+					float* destination = line.data() + x * 4;
+					for (uint32_t channel = 0; channel < 4; channel++) destination[channel] = channel < m_channels ? decode[channel][texel[channel]] : 0.f;
+				}
+
+				float* filtered = ring.data() + static_cast<size_t>(slot) * level.width * 4;
+				for (uint32_t x = 0; x < level.width; x++)
+				{
+					const float* taps = line.data() + (x * 2 + pad + kernel.first) * 4; //!< First tap, already offset past the padding
+#ifdef NG_MIP_SSE
+					__m128 sum = _mm_setzero_ps();
+					for (uint32_t tap = 0; tap < kernel.taps; tap++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(taps + tap * 4), weights[tap])); //!< Every channel at once
+					_mm_storeu_ps(filtered + x * 4, sum);
+#else
+					for (uint32_t channel = 0; channel < 4; channel++)
+					{
+						float sum = 0.f;
+						for (uint32_t tap = 0; tap < kernel.taps; tap++) sum += taps[tap * 4 + channel] * kernel.weights[tap];
+						filtered[x * 4 + channel] = sum;
+					}
+#endif
+				}
+			}
+
+			uint8_t* destination = m_data.data() + level.offset + static_cast<size_t>(y) * level.width * m_channels;
+			const float* rows[maxTaps]; //!< Ring slot of each tap's row
+			for (uint32_t tap = 0; tap < kernel.taps; tap++)
+			{
+				int32_t row = static_cast<int32_t>(y * 2) + kernel.first + static_cast<int32_t>(tap);
+				rows[tap] = ring.data() + static_cast<size_t>(((row % static_cast<int32_t>(kernel.taps)) + kernel.taps) % kernel.taps) * level.width * 4;
+			}
+
+			for (uint32_t x = 0; x < level.width; x++)
+			{
+				int32_t values[4];
+#ifdef NG_MIP_SSE
+				__m128 sum = _mm_setzero_ps();
+				for (uint32_t tap = 0; tap < kernel.taps; tap++) sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[tap] + x * 4), weights[tap]));
+				sum = _mm_min_ps(_mm_max_ps(sum, zero), one); //!< Sinc rings past the range at hard edges
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(values), _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(sum, scales), half))); //!< Rounded
+#else
+				for (uint32_t channel = 0; channel < 4; channel++)
+				{
+					float sum = 0.f;
+					for (uint32_t tap = 0; tap < kernel.taps; tap++) sum += rows[tap][x * 4 + channel] * kernel.weights[tap];
+					values[channel] = static_cast<int32_t>(std::min(std::max(sum, 0.f), 1.f) * scale[channel] + 0.5f);
+				}
+#endif
+				for (uint32_t channel = 0; channel < m_channels; channel++)
+				{
+					destination[x * m_channels + channel] = scale[channel] == 255.f ? static_cast<uint8_t>(values[channel]) : tables.fromLinear[values[channel]];
+				}
+			}
+		}
+	}
+	void MipChain::downsampleBox(const uint8_t * source, uint32_t sourceWidth, uint32_t sourceHeight, const MipLevel & level, uint32_t begin, uint32_t end)
+	{
+		const uint32_t rightStep = sourceWidth > 1 ? m_channels : 0; //!< From a texel to the one right of it, itself if the source is one texel wide
+		for (uint32_t y = begin; y < end; y++)
+		{
+			const uint8_t* top = source + static_cast<size_t>(std::min(y * 2, sourceHeight - 1)) * sourceWidth * m_channels;
+			const uint8_t* bottom = source + static_cast<size_t>(std::min(y * 2 + 1, sourceHeight - 1)) * sourceWidth * m_channels; //!< The top row again if the source is one row high
+			uint8_t* destination = m_data.data() + level.offset + static_cast<size_t>(y) * level.width * m_channels;
+
+			uint32_t x = 0;
+#ifdef NG_MIP_SSE
+			if (m_channels == 4 && rightStep)
+			{
+				const __m128i zero = _mm_setzero_si128(), two = _mm_set1_epi16(2);
+				for (; x + 4 <= level.width; x += 4) //!< Four RGBA texels from two rows of eight
+				{
+					__m128i halves[2];
+					for (uint32_t half = 0; half < 2; half++)
+					{
+						__m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + (x + half * 2) * 8));
+						__m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + (x + half * 2) * 8));
+						__m128i left = _mm_add_epi16(_mm_unpacklo_epi8(upper, zero), _mm_unpacklo_epi8(lower, zero)); //!< Columns summed down, texels 0 and 1 as 16 bits a channel
+						__m128i right = _mm_add_epi16(_mm_unpackhi_epi8(upper, zero), _mm_unpackhi_epi8(lower, zero)); //!< Texels 2 and 3
+						__m128i sum = _mm_add_epi16(_mm_unpacklo_epi64(left, right), _mm_unpackhi_epi64(left, right)); //!< Texel 0 plus 1 and texel 2 plus 3
+						halves[half] = _mm_srli_epi16(_mm_add_epi16(sum, two), 2); //!< Rounded
+					}
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + x * 4), _mm_packus_epi16(halves[0], halves[1]));
+				}
+			}
+#endif
+			for (; x < level.width; x++)
+			{
+				const uint32_t left = x * 2 * m_channels;
+				for (uint32_t channel = 0; channel < m_channels; channel++)
+				{
+					uint32_t sum = top[left + channel] + top[left + rightStep + channel] + bottom[left + channel] + bottom[left + rightStep + channel];
+					destination[x * m_channels + channel] = static_cast<uint8_t>((sum + 2) / 4);
+				}
+			}
+		}
+	}
+}
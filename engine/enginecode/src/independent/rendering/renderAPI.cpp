@@ -1,174 +1,315 @@
-/*! \file renderAPI.cpp */
-#include "engine_pch.h"
-#include "rendering/renderAPI.h"
-#include "rendering/indexBuffer.h"
-#include "platform/OpenGL/OpenGLIndexBuffer.h"
-#include "systems/log.h"
-#include "rendering/vertexArray.h"
-#include "platform/OpenGL/OpenGLVertexArray.h"
-#include "rendering/vertexBuffer.h"
-#include "platform/OpenGL/OpenGLVertexBuffer.h"
-#include "rendering/shader.h"
-#include "platform/OpenGL/OpenGLShader.h"
-#include "rendering/texture.h"
-#include "platform/OpenGL/OpenGLTexture.h"
-#include "rendering/uniformBuffer.h"
-#include "platform/OpenGL/OpenGLUniformBuffer.h"
-
-namespace Engine 
-{ 
-	RenderAPI::API RenderAPI::s_API = RenderAPI::API::OpenGL; 
-
-	IndexBuffer* IndexBuffer::create(uint32_t * indices, uint32_t count)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLIndexBuffer(indices, count); //!< Create a new index buffer
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	VertexArray* VertexArray::create()
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLVertexArray; //!< Return a new vertex array
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	VertexBuffer* VertexBuffer::create(void* vertices, uint32_t size, const VertexBufferLayout& layout)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLVertexBuffer(vertices, size, layout); //!< Return a new vertex buffer
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	Shader* Shader::create(const char* vertexFile, const char* fragmentFile)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLShader(vertexFile, fragmentFile); //!< Return a new shader
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break; 
-		}
-		return nullptr;
-	}
-
-	Shader* Shader::create(const char* filepath)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLShader(filepath); //!, Return a new shader
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	Texture* Texture::create(const char* filepath)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLTexture(filepath); //!, Return a new texture
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	Texture* Texture::create(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLTexture(width, height, channels, data); //!< Return a new texture
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
-	UniformBuffer* UniformBuffer::create(const UniformBufferLayout& layout)
-	{
-		switch (RenderAPI::getAPI())
-		{
-		case RenderAPI::API::None:
-			Log::error("No render API chosen"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::OpenGL:
-			return new OpenGLUniformBuffer(layout); //!< Return a new uniform buffer
-		case RenderAPI::API::Direct3D:
-			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		case RenderAPI::API::Vulkan:
-			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
-			break;
-		}
-		return nullptr;
-	}
-
+/*! \file renderAPI.cpp */
+#include "engine_pch.h"
+#include "rendering/renderAPI.h"
+#include "rendering/indexBuffer.h"
+#include "platform/OpenGL/OpenGLIndexBuffer.h"
+#include "systems/log.h"
+#include "systems/renderThread.h"
+#include "rendering/vertexArray.h"
+#include "platform/OpenGL/OpenGLVertexArray.h"
+#include "rendering/vertexBuffer.h"
+#include "platform/OpenGL/OpenGLVertexBuffer.h"
+#include "rendering/shader.h"
+#include "platform/OpenGL/OpenGLShader.h"
+#include "rendering/texture.h"
+#include "platform/OpenGL/OpenGLTexture.h"
+#include "rendering/uniformBuffer.h"
+#include "platform/OpenGL/OpenGLUniformBuffer.h"
+#include "rendering/shaderStorageBuffer.h"
+#include "platform/OpenGL/OpenGLShaderStorageBuffer.h"
+#include "rendering/streamingBuffer.h"
+#include "platform/OpenGL/OpenGLStreamingBuffer.h"
+#include "rendering/frameBuffer.h"
+#include "platform/OpenGL/OpenGLFrameBuffer.h"
+#include "rendering/timerQuery.h"
+#include "platform/OpenGL/OpenGLTimerQuery.h"
+#include "platform/Null/NullIndexBuffer.h"
+#include "platform/Null/NullVertexArray.h"
+#include "platform/Null/NullVertexBuffer.h"
+#include "platform/Null/NullShader.h"
+#include "platform/Null/NullTexture.h"
+#include "platform/Null/NullUniformBuffer.h"
+#include "platform/Null/NullShaderStorageBuffer.h"
+#include "platform/Null/NullStreamingBuffer.h"
+#include "platform/Null/NullFrameBuffer.h"
+#include "platform/Null/NullTimerQuery.h"
+#include "renderer/frameCapture.h"
+
+namespace Engine 
+{ 
+	RenderAPI::API RenderAPI::s_API = RenderAPI::API::OpenGL; 
+
+	IndexBuffer* IndexBuffer::create(uint32_t * indices, uint32_t count)
+	{
+		IndexBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullIndexBuffer(indices, count); //!< Make a new null index buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLIndexBuffer>(indices, count); //!< Create a new index buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, indices, count); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	VertexArray* VertexArray::create()
+	{
+		VertexArray* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullVertexArray; //!< Make a new null vertex array
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLVertexArray>(); //!< Make a new vertex array
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	VertexBuffer* VertexBuffer::create(void* vertices, uint32_t size, const VertexBufferLayout& layout)
+	{
+		VertexBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullVertexBuffer(vertices, size, layout); //!< Make a new null vertex buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLVertexBuffer>(vertices, size, layout); //!< Make a new vertex buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, vertices, size, layout); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	Shader* Shader::create(const char* vertexFile, const char* fragmentFile)
+	{
+		Shader* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullShader; //!< Make a new null shader
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLShader>(vertexFile, fragmentFile); //!< Make a new shader
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break; 
+		}
+		return FrameCapture::track(result, vertexFile, fragmentFile); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	Shader* Shader::create(const char* filepath, ShaderCompileMode mode)
+	{
+		Shader* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullShader; //!< Make a new null shader
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLShader>(filepath, mode); //!, Make a new shader
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, filepath, mode); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	void Shader::updatePending()
+	{
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::OpenGL:
+			OpenGLShader::updatePending(); //!< Poll the OpenGL compiles
+			break;
+		default:
+			break; //!< Nothing else compiles asynchronously
+		}
+	}
+
+	Texture* Texture::create(const char* filepath, TextureLoadMode mode)
+	{
+		Texture* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullTexture(filepath); //!< Make a new null texture
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLTexture>(filepath, mode); //!, Make a new texture
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, filepath); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	void Texture::updatePending()
+	{
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::OpenGL:
+			OpenGLTexture::updatePending(); //!< Upload the OpenGL textures which have been decoded
+			break;
+		default:
+			break; //!< Nothing else loads asynchronously
+		}
+	}
+
+	Texture* Texture::create(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
+	{
+		Texture* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullTexture(width, height, channels, data); //!< Make a new null texture
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLTexture>(width, height, channels, data); //!< Make a new texture
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, width, height, channels, data); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	UniformBuffer* UniformBuffer::create(const UniformBufferLayout& layout)
+	{
+		UniformBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullUniformBuffer(layout); //!< Make a new null uniform buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLUniformBuffer>(layout); //!< Make a new uniform buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, layout); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	ShaderStorageBuffer* ShaderStorageBuffer::create(uint32_t size)
+	{
+		ShaderStorageBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullShaderStorageBuffer(size); //!< Make a new null shader storage buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLShaderStorageBuffer>(size); //!< Make a new shader storage buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, size); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	StreamingBuffer* StreamingBuffer::create(uint32_t regionSize, uint32_t regionCount)
+	{
+		StreamingBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullStreamingBuffer(regionSize, regionCount); //!< Make a new null streaming buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLStreamingBuffer>(regionSize, regionCount); //!< Make a new streaming buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, regionSize, regionCount); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	FrameBuffer* FrameBuffer::create(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment)
+	{
+		FrameBuffer* result = nullptr;
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			result = new NullFrameBuffer(width, height, colourAttachments, depthAttachment); //!< Make a new null frame buffer
+			break;
+		case RenderAPI::API::OpenGL:
+			result = RenderThread::construct<OpenGLFrameBuffer>(width, height, colourAttachments, depthAttachment); //!< Make a new frame buffer
+			break;
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return FrameCapture::track(result, width, height, colourAttachments, depthAttachment); //!< Wrapped if a frame capture is tracking resources
+	}
+
+	TimerQuery* TimerQuery::create()
+	{
+		switch (RenderAPI::getAPI())
+		{
+		case RenderAPI::API::None:
+			return new NullTimerQuery; //!< Return a new null timer query
+		case RenderAPI::API::OpenGL:
+			return RenderThread::construct<OpenGLTimerQuery>(); //!< Return a new timer query
+		case RenderAPI::API::Direct3D:
+			Log::error("Direct3D not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		case RenderAPI::API::Vulkan:
+			Log::error("Vulkan not currently supported"); //!< This RenderAPI is not implemented
+			break;
+		}
+		return nullptr;
+	}
+
 }
\ No newline at end of file
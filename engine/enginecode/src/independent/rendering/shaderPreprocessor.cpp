@@ -0,0 +1,170 @@
+/*! \file shaderPreprocessor.cpp */
+#include "engine_pch.h"
+#include "rendering/shaderPreprocessor.h"
+#include "core/hash.h"
+#include "systems/log.h"
+#include <fstream>
+#include <sstream>
+#include <filesystem>
+#include <algorithm>
+#include <string_view>
+
+namespace Engine
+{
+	std::unordered_map<StringID, std::string> ShaderPreprocessor::s_expanded; //!< Initialise the cache
+	std::recursive_mutex ShaderPreprocessor::s_mutex; //!< Initialise the cache mutex
+
+	bool ShaderPreprocessor::process(const std::string & filepath, ShaderSource & source)
+	{
+		std::string expanded;
+		if (!expand(filepath, expanded)) return false;
+
+		source = ShaderSource(); //!< Start from nothing
+		ShaderStage stage = ShaderStage::None; //!< Lines before the first #region belong to no stage
+
+		size_t lineStart = 0;
+		while (lineStart < expanded.size()) //!< Seperate the shader into regions based on the regions in the shader file
+		{
+			size_t lineEnd = expanded.find('\n', lineStart);
+			if (lineEnd == std::string::npos) lineEnd = expanded.size();
+			const char* line = expanded.c_str() + lineStart;
+			size_t length = lineEnd - lineStart;
+			std::string_view view(line, length);
+			lineStart = lineEnd + 1;
+
+			if (view.find("#region Vertex") != std::string_view::npos) { stage = ShaderStage::Vertex; continue; }
+			if (view.find("#region Fragment") != std::string_view::npos) { stage = ShaderStage::Fragment; continue; }
+			if (view.find("#region Geometry") != std::string_view::npos) { stage = ShaderStage::Geometry; continue; }
+			if (view.find("#region TessellationControl") != std::string_view::npos) { stage = ShaderStage::TessellationControl; continue; }
+			if (view.find("#region TessellationEvaluation") != std::string_view::npos) { stage = ShaderStage::TessellationEvaluation; continue; }
+			if (view.find("#region Compute") != std::string_view::npos) { stage = ShaderStage::Compute; continue; }
+			if (view.compare(0, 8, "#feature") == 0) //!< Feature switch, not part of any stage
+			{
+				std::istringstream feature(std::string(view.substr(8)));
+				ShaderFeature declared;
+				uint32_t bit = 0;
+				if (feature >> declared.name >> bit)
+				{
+					declared.flag = 1 << bit;
+					source.features.push_back(declared);
+				}
+				else Log::error("Bad feature declaration in {0}: {1}", filepath, std::string(view));
+				continue;
+			}
+			if (stage != ShaderStage::None) source.getStage(stage).append(line, length).push_back('\n');
+		}
+
+		uint64_t hash = Hash::fnvOffset;
+		for (auto& stageSource : source.stages)
+		{
+			hash = Hash::fnv1a(stageSource, hash);
+			hash = Hash::fnv1a("\0", 1, hash); //!< Keep the stages apart, so moving text between them changes the hash
+		}
+		for (auto& feature : source.features)
+		{
+			hash = Hash::fnv1a(feature.name, hash);
+			hash = Hash::fnv1a(reinterpret_cast<const char*>(&feature.flag), sizeof(feature.flag), hash);
+		}
+		source.hash = hash;
+		return true;
+	}
+
+	bool ShaderPreprocessor::expand(const std::string & filepath, std::string & source)
+	{
+		std::vector<std::string> includeStack; //!< Files being expanded, to catch include loops
+		std::lock_guard<std::recursive_mutex> lock(s_mutex);
+		return expandFile(filepath, source, includeStack);
+	}
+
+	void ShaderPreprocessor::clearCache()
+	{
+		std::lock_guard<std::recursive_mutex> lock(s_mutex);
+		s_expanded.clear();
+	}
+
+	bool ShaderPreprocessor::expandFile(const std::string & filepath, std::string & expanded, std::vector<std::string>& includeStack)
+	{
+		std::string path = std::filesystem::path(filepath).lexically_normal().generic_string(); //!< "a/../b.glsl" and "b.glsl" are the same file
+		StringID pathID = StringID::intern(path);
+
+		auto cached = s_expanded.find(pathID);
+		if (cached != s_expanded.end())
+		{
+			expanded = cached->second; //!< Already read and expanded
+			return true;
+		}
+
+		if (std::find(includeStack.begin(), includeStack.end(), path) != includeStack.end())
+		{
+			Log::error("Shader include loop at {0}", path);
+			return false;
+		}
+
+		std::string contents;
+		if (!readFile(path, contents))
+		{
+			Log::error("Could not load shader file {0}", path); //!< if file couldnt be opened, log it
+			return false;
+		}
+
+		includeStack.push_back(path);
+		std::string directory = std::filesystem::path(path).parent_path().generic_string(); //!< Includes are relative to the including file
+		std::string result;
+		result.reserve(contents.size());
+
+		size_t lineStart = 0;
+		while (lineStart < contents.size())
+		{
+			size_t lineEnd = contents.find('\n', lineStart);
+			if (lineEnd == std::string::npos) lineEnd = contents.size();
+			std::string_view line(contents.c_str() + lineStart, lineEnd - lineStart);
+			lineStart = lineEnd + 1;
+
+			size_t directive = line.find_first_not_of(" \t");
+			if (directive != std::string_view::npos && line.compare(directive, 8, "#include") == 0)
+			{
+				size_t open = line.find('"', directive);
+				size_t close = open == std::string_view::npos ? open : line.find('"', open + 1);
+				if (close == std::string_view::npos)
+				{
+					Log::error("Bad include in {0}: {1}", path, std::string(line));
+					includeStack.pop_back();
+					return false;
+				}
+
+				std::string includePath = directory.empty() ? std::string(line.substr(open + 1, close - open - 1)) : directory + "/" + std::string(line.substr(open + 1, close - open - 1));
+				std::string included;
+				if (!expandFile(includePath, included, includeStack))
+				{
+					includeStack.pop_back();
+					return false;
+				}
+				result += included; //!< Paste the header in place of the #include
+				if (!included.empty() && included.back() != '\n') result.push_back('\n');
+				continue;
+			}
+
+			result.append(line.data(), line.size()).push_back('\n');
+		}
+		includeStack.pop_back();
+
+		s_expanded[pathID] = result; //!< Cache it for every other shader that includes it
+		expanded = std::move(result);
+		return true;
+	}
+
+	bool ShaderPreprocessor::readFile(const std::string & filepath, std::string & contents)
+	{
+		std::ifstream handle(filepath, std::ios::in | std::ios::binary); //!< Open the file
+		if (!handle.is_open()) return false;
+
+		handle.seekg(0, std::ios::end); //!< Find the size
+		contents.resize(static_cast<size_t>(handle.tellg()));
+		handle.seekg(0, std::ios::beg);
+		handle.read(&contents[0], contents.size()); //!< Read it all at once
+		handle.close(); //!< Close the file
+
+		contents.erase(std::remove(contents.begin(), contents.end(), '\r'), contents.end()); //!< Same text, and hash, whatever the line endings
+		return true;
+	}
+}
@@ -0,0 +1,54 @@
+/*! \file vertexPacking.cpp */
+#include "engine_pch.h"
+#include "rendering/vertexPacking.h"
+
+namespace Engine
+{
+	std::array<int16_t, 3> normalise(const glm::vec3& norm)
+	{
+		std::array<int16_t, 3> result; //!< creates the result array
+		if (norm.x == 1.0f) result.at(0) = INT16_MAX;										//!< If the norm is max then set it to the max of int16
+		else if (norm.x == -1.0f) result.at(0) = INT16_MIN;									//!< If the norm is min set it to the min of int16
+		else result.at(0) = static_cast<int16_t>(norm.x * static_cast<float>(INT16_MAX));   //!< Else convert the number to int16 via casting and multiplying it.
+
+		if (norm.y == 1.0f) result.at(1) = INT16_MAX;										//!< If the norm is max then set it to the max of int16
+		else if (norm.y == -1.0f) result.at(1) = INT16_MIN;									//!< If the norm is min set it to the min of int16
+		else result.at(1) = static_cast<int16_t>(norm.y * static_cast<float>(INT16_MAX));	//!< Else convert the number to int16 via casting and multiplying it.
+
+		if (norm.z == 1.0f) result.at(2) = INT16_MAX;										//!< If the norm is max then set it to the max of int16
+		else if (norm.z == -1.0f) result.at(2) = INT16_MIN;									//!< If the norm is min set it to the min of int16
+		else result.at(2) = static_cast<int16_t>(norm.z * static_cast<float>(INT16_MAX));	//!< Else convert the number to int16 via casting and multiplying it.
+
+		return result;
+	}
+
+	std::array<int16_t, 2> normalise(const glm::vec2& uv)
+	{
+		std::array<int16_t, 2> result;//!< Creates the result array
+		if (uv.x == 1.0f) result.at(0) = INT16_MAX;											//!< If the norm is max then set it to the max of int16
+		else if (uv.x == -1.0f) result.at(0) = INT16_MIN;									//!< If the norm is min set it to the min of int16
+		else result.at(0) = static_cast<int16_t>(uv.x * static_cast<float>(INT16_MAX));		//!< Else convert the number to int16 via casting and multiplying it.
+
+		if (uv.y == 1.0f) result.at(1) = INT16_MAX;											//!< If the norm is max then set it to the max of int16
+		else if (uv.y == -1.0f) result.at(1) = INT16_MIN;									//!< If the norm is min set it to the min of int16
+		else result.at(1) = static_cast<int16_t>(uv.y * static_cast<float>(INT16_MAX));		//!< Else convert the number to int16 via casting and multiplying it.
+
+		return result;
+	}
+
+	uint32_t pack(const glm::vec4& colour)
+	{
+		uint32_t result = 0; //!< define the result
+		uint32_t R = (static_cast<uint32_t>(colour.r * 255.0f)) << 0;  //!< Turn the R value into an RGB value (0-255)
+		uint32_t G = (static_cast<uint32_t>(colour.g * 255.0f)) << 8;  //!< Turn the G value into an RGB value (0-255)
+		uint32_t B = (static_cast<uint32_t>(colour.b * 255.0f)) << 16; //!< Turn the B value into an RGB value (0-255)
+		uint32_t A = (static_cast<uint32_t>(colour.a * 255.0f)) << 24; //!< Turn the A value into an RGB value (0-255)
+		result = (R | G | B | A); //!< Put all values into result, using bitwise or
+		return result; //!< return result
+	}
+
+	uint32_t pack(const glm::vec3& colour)
+	{
+		return pack({ colour.r, colour.g, colour.b, 1.0 }); //!< Run pack, but give the vec3 an alpha of 1
+	}
+}
@@ -0,0 +1,144 @@
+/*! \file profiler.cpp */
+#include "engine_pch.h"
+#include "systems/profiler.h"
+#include "systems/log.h"
+#include <fstream>
+#include <iomanip>
+
+namespace Engine
+{
+	std::vector<std::unique_ptr<Profiler::ThreadBuffer>> Profiler::s_buffers; //!< Initialise the buffer list
+	std::mutex Profiler::s_mutex; //!< Initialise the mutex
+	std::atomic<bool> Profiler::s_recording = false; //!< Initialise the recording flag
+	std::chrono::steady_clock::time_point Profiler::s_epoch = std::chrono::steady_clock::now(); //!< Initialise the epoch, so now() works before start
+	std::string Profiler::s_filepath; //!< Initialise the trace path
+	thread_local Profiler::ThreadBuffer* Profiler::s_threadBuffer = nullptr; //!< Initialise the calling thread's buffer
+	thread_local const char* Profiler::s_threadName = nullptr; //!< Initialise the calling thread's name
+
+	void Profiler::start(SystemSignal init, ...)
+	{
+		va_list args;
+		va_start(args, init);
+		const char* filepath = va_arg(args, const char*); //!< Where to write the trace
+		va_end(args);
+
+		s_filepath = filepath ? filepath : "trace.json";
+		s_epoch = std::chrono::steady_clock::now(); //!< The trace starts at 0
+		s_recording = true;
+
+#ifdef NG_PROFILE
+		Log::info("Profiler recording, the trace will be written to {0}", s_filepath);
+#else
+		Log::warn("Profiler started, but the engine was built without NG_PROFILE so there are no zones to record");
+#endif
+	}
+
+	void Profiler::stop(SystemSignal close, ...)
+	{
+		if (!s_recording) return;
+		s_recording = false;
+
+		if (exportChromeTrace(s_filepath)) Log::info("Profiler trace written to {0}", s_filepath);
+	}
+
+	void Profiler::record(const char * name, uint64_t start, uint64_t end)
+	{
+		push({ name, start, end, false });
+	}
+
+	void Profiler::markFrame(const char * name)
+	{
+		if (!isRecording()) return;
+		uint64_t time = now();
+		push({ name, time, time, true });
+	}
+
+	void Profiler::setThreadName(const char * name)
+	{
+		s_threadName = name; //!< Only kept, so naming a thread never allocates its ring
+		if (s_threadBuffer) s_threadBuffer->name = name; //!< Already recorded, only read on export
+	}
+
+	bool Profiler::exportChromeTrace(const std::string & filepath)
+	{
+		std::ofstream file(filepath);
+		if (!file.is_open())
+		{
+			Log::error("Could not write the profiler trace to {0}", filepath);
+			return false;
+		}
+
+		std::vector<ProfileEvent> events; //!< One thread's events, copied out of its ring
+		bool first = true;
+		auto separator = [&]() -> std::ofstream& { if (!first) file << ",\n"; first = false; return file; };
+		auto escape = [](const char* name)
+		{
+			std::string result;
+			for (const char* c = name; *c; c++)
+			{
+				if (*c == '"' || *c == '\\') result += '\\';
+				result += *c;
+			}
+			return result;
+		};
+
+		file << std::fixed << std::setprecision(3); //!< Microseconds to the nanosecond, never in exponent form
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+
+		std::lock_guard<std::mutex> lock(s_mutex);
+		for (auto& buffer : s_buffers)
+		{
+			uint64_t written = buffer->written.load(std::memory_order_acquire);
+			uint64_t oldest = written > ringSize ? written - ringSize : 0; //!< Older events have been overwritten
+			events.clear();
+			for (uint64_t i = oldest; i < written; i++) events.push_back(buffer->events[i % ringSize]);
+
+			uint64_t writtenAfter = buffer->written.load(std::memory_order_acquire); //!< The thread may still be recording
+			uint64_t overwritten = writtenAfter > ringSize + oldest ? writtenAfter - ringSize - oldest : 0; //!< Events replaced while copying
+			if (overwritten > events.size()) overwritten = events.size();
+
+			separator() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadID
+				<< ",\"args\":{\"name\":\"" << escape(buffer->name.empty() ? "Thread" : buffer->name.c_str()) << "\"}}";
+
+			for (uint64_t i = overwritten; i < events.size(); i++)
+			{
+				const ProfileEvent& event = events[i];
+				if (event.isFrame)
+				{
+					separator() << "{\"name\":\"" << escape(event.name) << "\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << buffer->threadID
+						<< ",\"ts\":" << event.start / 1000.0 << "}"; //!< Global instant events draw a line across every thread
+				}
+				else
+				{
+					separator() << "{\"name\":\"" << escape(event.name) << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadID
+						<< ",\"ts\":" << event.start / 1000.0 << ",\"dur\":" << (event.end - event.start) / 1000.0 << "}"; //!< Chrome traces are in microseconds
+				}
+			}
+		}
+
+		file << "\n]}\n";
+		return true;
+	}
+
+	Profiler::ThreadBuffer & Profiler::getThreadBuffer()
+	{
+		if (!s_threadBuffer) //!< Only reached from push, so only threads recording a trace pay for a ring
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_buffers.emplace_back(new ThreadBuffer);
+			s_threadBuffer = s_buffers.back().get();
+			s_threadBuffer->threadID = static_cast<uint32_t>(s_buffers.size());
+			if (s_threadName) s_threadBuffer->name = s_threadName;
+			s_threadBuffer->events.reset(new ProfileEvent[ringSize]);
+		}
+		return *s_threadBuffer;
+	}
+
+	void Profiler::push(const ProfileEvent & event)
+	{
+		ThreadBuffer& buffer = getThreadBuffer();
+		uint64_t index = buffer.written.load(std::memory_order_relaxed); //!< Only this thread writes it
+		buffer.events[index % ringSize] = event;
+		buffer.written.store(index + 1, std::memory_order_release); //!< Publish the event to the exporter
+	}
+}
@@ -0,0 +1,167 @@
+/*! \file renderThread.cpp */
+#include "engine_pch.h"
+#include "systems/renderThread.h"
+#include "core/graphicsContext.h"
+#include "systems/log.h"
+#include "systems/profiler.h"
+#include "systems/threadPool.h"
+
+namespace Engine
+{
+	GraphicsContext* RenderThread::s_context = nullptr; //!< Initialise the context
+	std::thread RenderThread::s_thread; //!< Initialise the render thread
+	RenderThread::FramePacket RenderThread::s_packets[2]; //!< Initialise the packets
+	uint32_t RenderThread::s_recording = 0; //!< Initialise the recording packet index
+	bool RenderThread::s_frameSubmitted = false; //!< Initialise the submitted flag
+	std::deque<std::packaged_task<void()>> RenderThread::s_immediate; //!< Initialise the immediate queue
+	std::mutex RenderThread::s_mutex; //!< Initialise the mutex
+	std::condition_variable RenderThread::s_wake; //!< Initialise the render thread's condition variable
+	std::condition_variable RenderThread::s_frameDone; //!< Initialise the main thread's condition variable
+	std::atomic<bool> RenderThread::s_running = false; //!< Initialise the running flag
+	std::atomic<std::thread::id> RenderThread::s_threadID; //!< Initialise the render thread's ID, no thread
+
+	void RenderThread::start(SystemSignal init, ...)
+	{
+		va_list args;
+		va_start(args, init);
+		s_context = va_arg(args, GraphicsContext*); //!< Context to hand over
+		va_end(args);
+
+		if (!s_context)
+		{
+			Log::error("Render thread needs a graphics context, rendering stays on the calling thread");
+			return;
+		}
+
+		s_context->releaseCurrent(); //!< A context can only be current on one thread
+
+		std::lock_guard<std::mutex> lock(s_mutex); //!< Held while s_thread is assigned, the render thread sets its own ID before it runs a job
+		s_running = true;
+		s_thread = std::thread(&RenderThread::renderLoop);
+
+		Log::info("Render thread started");
+	}
+
+	void RenderThread::stop(SystemSignal close, ...)
+	{
+		if (!s_running) return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_running = false; //!< Jobs from here on run inline
+		}
+		s_wake.notify_one(); //!< Wake the render thread so it can leave its loop
+
+		s_thread.join(); //!< Waits for the frame in flight and any immediate jobs
+		s_threadID = std::thread::id(); //!< No render thread
+
+		s_context->makeCurrent(); //!< Give the context back, so resources can be cleaned up on this thread
+
+		std::vector<std::function<void()>> jobs; //!< Jobs recorded after the last frame was submitted, like resources released since
+		jobs.swap(s_packets[s_recording].jobs);
+		for (auto& job : jobs) job(); //!< Run here rather than dropped, so nothing is leaked. Anything they release now runs inline
+	}
+
+	void RenderThread::enqueue(const std::function<void()>& job)
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_mutex); //!< Checked under the lock, so a job can't be added after stop has taken the packet
+			if (s_running)
+			{
+				s_packets[s_recording].jobs.push_back(job); //!< The render thread never touches the packet being recorded
+				return;
+			}
+		}
+		job(); //!< No render thread, run it here
+	}
+
+	void RenderThread::execute(const std::function<void()>& job)
+	{
+		if (isRenderThread())
+		{
+			job(); //!< Already able to use the context
+			return;
+		}
+
+		if (ThreadPool::isWorkerThread())
+		{
+			Log::error("A render thread job can't be waited on from a pool worker, the render thread may be waiting on the worker. The job was dropped");
+			return;
+		}
+
+		std::packaged_task<void()> task(job); //!< Wrap the job so this thread can wait on it
+		std::future<void> result = task.get_future();
+
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_immediate.push_back(std::move(task));
+		}
+		s_wake.notify_one();
+
+		result.wait(); //!< Immediate jobs are picked up between frames, so this can take up to a frame
+	}
+
+	void RenderThread::endFrame()
+	{
+		if (!s_running) return; //!< Jobs have already run inline
+
+		NG_PROFILE_SCOPE("Wait for render thread");
+		{
+			std::unique_lock<std::mutex> lock(s_mutex);
+			s_frameDone.wait(lock, []() { return !s_frameSubmitted; }); //!< Only one frame in flight, so the render thread is never more than a frame behind
+			s_recording ^= 1; //!< Record into the packet the render thread has finished with
+			s_frameSubmitted = true;
+		}
+		s_wake.notify_one();
+	}
+
+	void RenderThread::renderLoop()
+	{
+		NG_PROFILE_THREAD("Render");
+		s_threadID = std::this_thread::get_id(); //!< Before any job, so jobs which check it run inline
+		s_context->makeCurrent(); //!< The context belongs to this thread until the system stops
+
+		std::deque<std::packaged_task<void()>> immediate; //!< Immediate jobs taken off the queue, kept between passes
+		while (true)
+		{
+			FramePacket* packet = nullptr;
+			{
+				std::unique_lock<std::mutex> lock(s_mutex);
+				s_wake.wait(lock, []() { return !s_running || s_frameSubmitted || !s_immediate.empty(); }); //!< Sleep until there is work
+
+				immediate.swap(s_immediate); //!< Take every waiting job in one go
+				if (s_frameSubmitted) packet = &s_packets[s_recording ^ 1]; //!< The packet which isn't being recorded
+				else if (!s_running && immediate.empty()) break; //!< Stopped and nothing left to do
+			}
+
+			for (auto& task : immediate)
+			{
+				NG_PROFILE_SCOPE("Immediate job");
+				task(); //!< Resources go first, the frame may use them
+			}
+			immediate.clear();
+
+			if (packet)
+			{
+				NG_PROFILE_FRAME("Render frame");
+				{
+					NG_PROFILE_SCOPE("Draw frame");
+					for (auto& job : packet->jobs) job(); //!< Draw the frame
+				}
+				{
+					NG_PROFILE_SCOPE("Present");
+					s_context->swapBuffers(); //!< Present it
+				}
+				packet->jobs.clear(); //!< Keep the memory for the frame after next
+
+				{
+					std::lock_guard<std::mutex> lock(s_mutex);
+					s_frameSubmitted = false;
+				}
+				s_frameDone.notify_one(); //!< Let the main thread submit the next frame
+			}
+		}
+
+		s_context->releaseCurrent(); //!< Free for stop to take back
+	}
+}
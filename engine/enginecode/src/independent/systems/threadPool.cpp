@@ -0,0 +1,105 @@
+/*! \file threadPool.cpp */
+#include "engine_pch.h"
+#include "systems/threadPool.h"
+#include "systems/log.h"
+#include "systems/profiler.h"
+#include <algorithm>
+
+namespace Engine
+{
+	std::vector<std::thread> ThreadPool::s_workers; //!< Initialise the workers
+	std::deque<std::packaged_task<void()>> ThreadPool::s_jobs; //!< Initialise the job queue
+	std::mutex ThreadPool::s_mutex; //!< Initialise the queue mutex
+	std::condition_variable ThreadPool::s_condition; //!< Initialise the condition variable
+	bool ThreadPool::s_running = false; //!< Initialise the running flag
+	thread_local bool ThreadPool::s_isWorker = false; //!< Initialise the worker flag, only workers set it
+
+	void ThreadPool::start(SystemSignal init, ...)
+	{
+		uint32_t hardwareThreads = std::thread::hardware_concurrency(); //!< Number of hardware threads, may be 0 if unknown
+		uint32_t workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1; //!< Leave a core for the main thread
+
+		s_running = true; //!< Start accepting jobs
+		for (uint32_t i = 0; i < workerCount; i++) s_workers.emplace_back(&ThreadPool::workerLoop); //!< Spawn the workers
+
+		Log::info("Thread pool started with {0} workers", workerCount);
+	}
+
+	void ThreadPool::stop(SystemSignal close, ...)
+	{
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			s_running = false; //!< Stop accepting jobs
+		}
+		s_condition.notify_all(); //!< Wake every worker so they can leave their loop
+
+		for (auto& worker : s_workers) worker.join(); //!< Wait for the workers to drain the queue
+		s_workers.clear();
+	}
+
+	std::future<void> ThreadPool::submit(const std::function<void()>& job)
+	{
+		std::packaged_task<void()> task(job); //!< Wrap the job so the caller can wait on it
+		std::future<void> result = task.get_future();
+
+		{
+			std::lock_guard<std::mutex> lock(s_mutex);
+			if (s_running)
+			{
+				s_jobs.push_back(std::move(task)); //!< Queue the job
+				s_condition.notify_one(); //!< Wake a worker
+				return result;
+			}
+		}
+
+		task(); //!< No workers, run it here
+		return result;
+	}
+
+	void ThreadPool::parallelFor(uint32_t count, const std::function<void(uint32_t, uint32_t)>& job)
+	{
+		if (count == 0) return;
+
+		uint32_t ranges = std::min(count, getWorkerCount() + 1); //!< One range per worker plus one for this thread
+		if (ranges <= 1 || s_isWorker)
+		{
+			job(0, count); //!< Nothing to split, or on a worker which must not wait on the pool
+			return;
+		}
+
+		uint32_t rangeSize = (count + ranges - 1) / ranges; //!< Round up so every item is covered
+		std::vector<std::future<void>> pending; //!< Ranges given to the workers
+		pending.reserve(ranges - 1);
+
+		for (uint32_t begin = rangeSize; begin < count; begin += rangeSize)
+		{
+			uint32_t end = std::min(begin + rangeSize, count);
+			pending.push_back(submit([&job, begin, end]() { job(begin, end); })); //!< Hand the range to a worker
+		}
+
+		job(0, std::min(rangeSize, count)); //!< The calling thread takes the first range
+
+		for (auto& range : pending) range.wait(); //!< Wait for the workers to finish
+	}
+
+	void ThreadPool::workerLoop()
+	{
+		NG_PROFILE_THREAD("Worker");
+		s_isWorker = true;
+		while (true)
+		{
+			std::packaged_task<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(s_mutex);
+				s_condition.wait(lock, []() { return !s_running || !s_jobs.empty(); }); //!< Sleep until there is work
+
+				if (s_jobs.empty()) return; //!< Stopped and nothing left to do
+
+				task = std::move(s_jobs.front()); //!< Take the oldest job
+				s_jobs.pop_front();
+			}
+			NG_PROFILE_SCOPE("Job");
+			task(); //!< Run it outside of the lock
+		}
+	}
+}
@@ -0,0 +1,23 @@
+/*! \file NullFrameBuffer.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullFrameBuffer.h"
+
+namespace Engine
+{
+	NullFrameBuffer::NullFrameBuffer(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment) :
+		m_renderID(NullRenderAPI::createResource()),
+		m_width(width),
+		m_height(height)
+	{
+		for (auto format : colourAttachments) m_colourIDs.push_back(NullRenderAPI::createResource()); //!< One texture per attachment
+		if (depthAttachment != AttachmentFormat::None) m_depthID = NullRenderAPI::createResource();
+	}
+
+	void NullFrameBuffer::resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || (width == m_width && height == m_height)) return; //!< Minimised or nothing to do
+		m_width = width;
+		m_height = height;
+		NullRenderAPI::countCall(); //!< Recreating the attachments
+	}
+}
@@ -0,0 +1,40 @@
+/*! \file NullRenderAPI.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullRenderAPI.h"
+#include "systems/log.h"
+
+namespace Engine
+{
+	std::atomic<uint64_t> NullRenderAPI::s_calls = 0; //!< Initialise the call count
+	std::atomic<uint64_t> NullRenderAPI::s_draws = 0; //!< Initialise the draw count
+	std::atomic<uint64_t> NullRenderAPI::s_triangles = 0; //!< Initialise the triangle count
+	std::atomic<uint64_t> NullRenderAPI::s_bytes = 0; //!< Initialise the byte count
+	std::atomic<uint64_t> NullRenderAPI::s_resources = 0; //!< Initialise the resource count
+	std::atomic<uint32_t> NullRenderAPI::s_nextID = 1; //!< Initialise the render IDs
+
+	NullRenderCounters NullRenderAPI::getCounters()
+	{
+		NullRenderCounters counters;
+		counters.calls = s_calls;
+		counters.draws = s_draws;
+		counters.triangles = s_triangles;
+		counters.bytes = s_bytes;
+		counters.resources = s_resources;
+		return counters;
+	}
+
+	void NullRenderAPI::resetCounters()
+	{
+		s_calls = 0;
+		s_draws = 0;
+		s_triangles = 0;
+		s_bytes = 0;
+		s_resources = 0;
+	}
+
+	void NullRenderAPI::logCounters()
+	{
+		NullRenderCounters counters = getCounters();
+		Log::info("Null renderer: {0} calls, {1} draws, {2} triangles, {3} bytes uploaded, {4} resources created", counters.calls, counters.draws, counters.triangles, counters.bytes, counters.resources);
+	}
+}
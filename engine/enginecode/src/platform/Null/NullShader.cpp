@@ -0,0 +1,53 @@
+/*! \file NullShader.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullShader.h"
+#include "renderer/renderStats.h"
+#include "platform/Null/NullRenderAPI.h"
+
+namespace Engine
+{
+	NullShader::NullShader() : m_renderID(NullRenderAPI::createResource())
+	{
+	}
+
+	UniformHandle NullShader::getUniformHandle(StringID name) const
+	{
+		auto it = m_uniformSlots.find(name);
+		if (it == m_uniformSlots.end()) it = m_uniformSlots.emplace(name, static_cast<int32_t>(m_uniformSlots.size())).first; //!< First time this name has been asked for
+
+		UniformHandle handle;
+		handle.slot = it->second;
+		return handle; //!< Type is unknown without the sources, uploads don't check it
+	}
+
+	int32_t NullShader::getUniformBlockIndex(StringID blockName) const
+	{
+		auto it = m_blockIndices.find(blockName);
+		if (it == m_blockIndices.end()) it = m_blockIndices.emplace(blockName, static_cast<int32_t>(m_blockIndices.size())).first; //!< First time this block has been asked for
+		return it->second;
+	}
+
+	void NullShader::bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint)
+	{
+		if (blockIndex < 0) return;
+		if (static_cast<uint32_t>(blockIndex) >= m_blockBindings.size()) m_blockBindings.resize(blockIndex + 1, -1);
+		if (m_blockBindings[blockIndex] == static_cast<int32_t>(bindingPoint)) return; //!< Already bound there, the real backend skips it too
+
+		m_blockBindings[blockIndex] = static_cast<int32_t>(bindingPoint);
+		NullRenderAPI::countCall();
+	}
+
+	void NullShader::uploadInt(UniformHandle handle, int value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+	void NullShader::uploadFloat(UniformHandle handle, float value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+	void NullShader::uploadFloat2(UniformHandle handle, const glm::vec2 & value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+	void NullShader::uploadFloat3(UniformHandle handle, const glm::vec3 & value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+	void NullShader::uploadFloat4(UniformHandle handle, const glm::vec4 & value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+	void NullShader::uploadMat4(UniformHandle handle, const glm::mat4 & value) { NullRenderAPI::countCall(sizeof(value)); RenderStats::countUniformUpload(); }
+
+	void NullShader::uploadInt(const char * name, int value) { uploadInt(getUniformHandle(name), value); } //!< Look the uniform up by name, like the real backend
+	void NullShader::uploadFloat(const char * name, float value) { uploadFloat(getUniformHandle(name), value); }
+	void NullShader::uploadFloat2(const char * name, const glm::vec2 & value) { uploadFloat2(getUniformHandle(name), value); }
+	void NullShader::uploadFloat3(const char * name, const glm::vec3 & value) { uploadFloat3(getUniformHandle(name), value); }
+	void NullShader::uploadFloat4(const char * name, const glm::vec4 & value) { uploadFloat4(getUniformHandle(name), value); }
+	void NullShader::uploadMat4(const char * name, const glm::mat4 & value) { uploadMat4(getUniformHandle(name), value); }
+}
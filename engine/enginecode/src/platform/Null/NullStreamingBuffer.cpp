@@ -0,0 +1,64 @@
+/*! \file NullStreamingBuffer.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullStreamingBuffer.h"
+#include "renderer/renderStats.h"
+#include "platform/Null/NullRenderAPI.h"
+#include "systems/log.h"
+#include <algorithm>
+
+namespace Engine
+{
+	namespace
+	{
+		constexpr uint32_t minAlignment = 256; //!< The strictest offset alignment drivers commonly ask for, so ranges line up the same as on a real backend
+		inline uint32_t alignUp(uint32_t value, uint32_t alignment) { return (value + alignment - 1) / alignment * alignment; } //!< Round up to a multiple of alignment
+	}
+
+	NullStreamingBuffer::NullStreamingBuffer(uint32_t regionSize, uint32_t regionCount) :
+		m_renderID(NullRenderAPI::createResource()),
+		m_regionCount(regionCount > 1 ? regionCount : 2) //!< Same region count as the real buffer would use
+	{
+		m_regionSize = alignUp(regionSize, minAlignment);
+		m_memory.resize(static_cast<size_t>(m_regionSize) * m_regionCount); //!< Written by the renderers like mapped memory, never read
+	}
+
+	void NullStreamingBuffer::beginFrame()
+	{
+		m_region = (m_region + 1) % m_regionCount; //!< No fence to wait on
+		m_head = m_reserved = m_region * m_regionSize;
+		m_overflowed = false;
+	}
+
+	void* NullStreamingBuffer::reserve(uint32_t size, uint32_t alignment, uint32_t& offset)
+	{
+		if (size > m_regionSize)
+		{
+			Log::error("Streaming buffer reservation of {0} bytes is bigger than a region of {1} bytes", size, m_regionSize);
+			return nullptr;
+		}
+
+		uint32_t start = alignUp(m_head, std::max(alignment, minAlignment));
+		if (start + size > (m_region + 1) * m_regionSize)
+		{
+			if (!m_overflowed) Log::error("Streaming buffer region of {0} bytes is full this frame, reservations fail until the next", m_regionSize); //!< Moving on to the next region here would leave ranges bound earlier in the frame unfenced
+			m_overflowed = true; //!< Logged once a frame
+			return nullptr;
+		}
+
+		m_reserved = start;
+		offset = start;
+		return m_memory.data() + start;
+	}
+
+	void NullStreamingBuffer::commit(uint32_t size)
+	{
+		m_head = m_reserved + size; //!< Anything after this is free to reserve again
+		NullRenderAPI::countCall(size); //!< Bytes the GPU would have read
+		RenderStats::countBufferUpload(size);
+	}
+
+	void NullStreamingBuffer::bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size)
+	{
+		NullRenderAPI::countCall(); //!< Count the bind
+	}
+}
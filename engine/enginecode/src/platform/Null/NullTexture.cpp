@@ -0,0 +1,60 @@
+/*! \file NullTexture.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullTexture.h"
+#include "renderer/renderStats.h"
+#include "platform/Null/NullRenderAPI.h"
+#include "systems/log.h"
+#include "rendering/compressedImage.h"
+#include "rendering/mipChain.h"
+#include "stb_image.h"
+
+namespace Engine
+{
+	NullTexture::NullTexture(const char * filepath) : m_renderID(NullRenderAPI::createResource())
+	{
+		if (CompressedImage::isCompressedFile(filepath))
+		{
+			CompressedImage image;
+			if (!image.load(filepath)) return;
+
+			uint64_t size = 0;
+			for (const auto& level : image.getLevels()) size += level.size; //!< Every level is uploaded as it is stored
+			m_width = image.getWidth();
+			m_height = image.getHeight();
+			m_channels = CompressedImage::getChannels(image.getFormat());
+			NullRenderAPI::countCall(size);
+			RenderStats::countTextureUpload(size);
+			return;
+		}
+
+		int32_t width, height, channels;
+		if (stbi_info(filepath, &width, &height, &channels)) //!< Only the header is read, the pixels are never needed
+		{
+			m_width = width;
+			m_height = height;
+			m_channels = channels;
+			uint64_t size = static_cast<uint64_t>(m_width) * m_height * m_channels + MipChain::getChainSize(m_width, m_height, m_channels); //!< The uploads the real texture would make, its mip levels included
+			NullRenderAPI::countCall(size);
+			RenderStats::countTextureUpload(size);
+		}
+		else
+		{
+			Log::error("Could not read texture: {0}", filepath);
+		}
+	}
+
+	NullTexture::NullTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data) :
+		m_renderID(NullRenderAPI::createResource(data ? static_cast<uint64_t>(width) * height * channels + MipChain::getChainSize(width, height, channels) : 0)), //!< Storage without data is never uploaded, and has no mip levels
+		m_width(width),
+		m_height(height),
+		m_channels(channels)
+	{
+		if (data) RenderStats::countTextureUpload(static_cast<uint64_t>(width) * height * channels + MipChain::getChainSize(width, height, channels));
+	}
+
+	void NullTexture::edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data)
+	{
+		NullRenderAPI::countCall(static_cast<uint64_t>(width) * height * m_channels); //!< The sub image upload
+		RenderStats::countTextureUpload(static_cast<uint64_t>(width) * height * m_channels);
+	}
+}
@@ -0,0 +1,86 @@
+/*! \file NullUniformBuffer.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullUniformBuffer.h"
+#include "renderer/renderStats.h"
+#include "platform/Null/NullRenderAPI.h"
+#include "systems/log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Engine
+{
+	uint32_t NullUniformBuffer::s_nextBlockNo = UniformBuffer::reservedBindings; //!< Initialise the next binding point, after the reserved ones
+
+	NullUniformBuffer::NullUniformBuffer(const UniformBufferLayout & layout) : m_renderID(NullRenderAPI::createResource())
+	{
+		m_blockNo = s_nextBlockNo++; //!< Initialise the block number
+		m_layout = layout; //!< Define the layout
+
+		for (auto& element : m_layout)
+		{
+			m_fieldLookup[StringID::intern(element.m_name)] = static_cast<uint32_t>(m_fields.size()); //!< Same table as the real buffer, so lookups cost the same
+			m_fields.push_back({ element.m_offset, SDT::size(element.m_dataType) });
+		}
+
+		m_shadow.assign(m_layout.getStride(), 0); //!< Start zeroed
+		m_dirtyBegin = 0; //!< The first flush sends everything
+		m_dirtyEnd = m_layout.getStride();
+	}
+
+	void NullUniformBuffer::attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName)
+	{
+		int32_t blockIndex = shader->getUniformBlockIndex(blockName);
+		if (blockIndex < 0) return; //!< The shader doesn't use this block
+		shader->bindUniformBlock(blockIndex, m_blockNo);
+	}
+
+	UniformFieldHandle NullUniformBuffer::getFieldHandle(StringID uniformName) const
+	{
+		UniformFieldHandle handle;
+		auto it = m_fieldLookup.find(uniformName);
+		if (it != m_fieldLookup.end()) handle.field = static_cast<int32_t>(it->second);
+		return handle;
+	}
+
+	void NullUniformBuffer::uploadShaderData(UniformFieldHandle field, const void * data)
+	{
+		if (!field.isValid()) return; //!< Not in the layout
+
+		const Field& target = m_fields[field.field];
+		uint8_t* destination = m_shadow.data() + target.offset;
+		if (std::memcmp(destination, data, target.size) == 0) return; //!< Same as what's staged
+
+		std::memcpy(destination, data, target.size); //!< Stage the value
+
+		if (isDirty())
+		{
+			m_dirtyBegin = std::min(m_dirtyBegin, target.offset);
+			m_dirtyEnd = std::max(m_dirtyEnd, target.offset + target.size);
+		}
+		else
+		{
+			m_dirtyBegin = target.offset;
+			m_dirtyEnd = target.offset + target.size;
+		}
+	}
+
+	void NullUniformBuffer::uploadShaderData(StringID uniformName, const void * data)
+	{
+		UniformFieldHandle field = getFieldHandle(uniformName);
+		if (!field.isValid())
+		{
+			Log::error("Uniform buffer has no field called {0}", uniformName.getString());
+			return;
+		}
+		uploadShaderData(field, data);
+	}
+
+	void NullUniformBuffer::flush()
+	{
+		if (!isDirty()) return; //!< Nothing changed since the last flush
+
+		NullRenderAPI::countCall(m_dirtyEnd - m_dirtyBegin); //!< The one upload the real buffer would make
+		RenderStats::countBufferUpload(m_dirtyEnd - m_dirtyBegin);
+		m_dirtyBegin = m_dirtyEnd = 0;
+	}
+}
@@ -0,0 +1,19 @@
+/*! \file NullWindow.cpp */
+#include "engine_pch.h"
+#include "platform/Null/NullWindow.h"
+#include "platform/Null/NullGraphicsContext.h"
+
+namespace Engine
+{
+	NullWindow::NullWindow(const WindowProperties & properties)
+	{
+		init(properties); //!< Initialise the window with the properties in the constructor
+	}
+
+	void NullWindow::init(const WindowProperties & properties)
+	{
+		m_properties = properties; //!< Keep a copy of the properties, the renderers size their targets from them
+		m_graphicsContext.reset(new NullGraphicsContext); //!< Something for the render thread to take over
+		m_graphicsContext->init();
+	}
+}
@@ -0,0 +1,147 @@
+/*! \file OpenGLFrameBuffer.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+
+#include "platform/OpenGL/OpenGLFrameBuffer.h"
+#include "systems/renderThread.h"
+#include "systems/log.h"
+
+namespace Engine
+{
+	namespace
+	{
+		/*! Internal format, format and type of a colour attachment */
+		void getColourFormat(AttachmentFormat format, GLenum& internalFormat, GLenum& dataFormat, GLenum& type)
+		{
+			switch (format)
+			{
+			case AttachmentFormat::RG16F:
+				internalFormat = GL_RG16F; dataFormat = GL_RG; type = GL_FLOAT;
+				break;
+			case AttachmentFormat::RGBA16F:
+				internalFormat = GL_RGBA16F; dataFormat = GL_RGBA; type = GL_FLOAT;
+				break;
+			default:
+				internalFormat = GL_RGBA8; dataFormat = GL_RGBA; type = GL_UNSIGNED_BYTE;
+				break;
+			}
+		}
+	}
+
+	OpenGLFrameBuffer::OpenGLFrameBuffer(uint32_t width, uint32_t height, const std::vector<AttachmentFormat>& colourAttachments, AttachmentFormat depthAttachment) :
+		m_width(width), m_height(height), m_colourFormats(colourAttachments), m_depthFormat(depthAttachment)
+	{
+		create(); //!< Make the attachments
+	}
+
+	OpenGLFrameBuffer::~OpenGLFrameBuffer()
+	{
+		RenderThread::enqueue([id = m_OpenGL_ID, colour = m_colourAttachmentIDs, depth = m_depthAttachmentID]()
+		{
+			if (!colour.empty()) glDeleteTextures(static_cast<GLsizei>(colour.size()), colour.data()); //!< Delete the colour attachments
+			if (depth) glDeleteTextures(1, &depth); //!< Delete the depth attachment
+			glDeleteFramebuffers(1, &id); //!< Delete the frame buffer
+		}); //!< On the render thread after the frames using it, whichever thread let go of it
+	}
+
+	uint32_t OpenGLFrameBuffer::getColourAttachmentID(uint32_t index) const
+	{
+		if (index < m_colourAttachmentIDs.size()) return m_colourAttachmentIDs[index];
+		return 0;
+	}
+
+	void OpenGLFrameBuffer::bind()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, m_OpenGL_ID); //!< Render into the attachments
+		glViewport(0, 0, m_width, m_height); //!< Cover the whole frame buffer
+	}
+
+	void OpenGLFrameBuffer::unbind()
+	{
+		glBindFramebuffer(GL_FRAMEBUFFER, 0); //!< Render into the window again
+	}
+
+	void OpenGLFrameBuffer::resize(uint32_t width, uint32_t height)
+	{
+		if (width == 0 || height == 0 || (width == m_width && height == m_height)) return; //!< Minimised or nothing to do
+
+		m_width = width; //!< Set the new size
+		m_height = height;
+		destroy(); //!< Attachment sizes are fixed, so start again
+		create();
+	}
+
+	void OpenGLFrameBuffer::bindColourAttachment(uint32_t index, uint32_t slot)
+	{
+		glBindTextureUnit(slot, getColourAttachmentID(index)); //!< Bind the attachment for sampling
+	}
+
+	void OpenGLFrameBuffer::bindDepthAttachment(uint32_t slot)
+	{
+		glBindTextureUnit(slot, m_depthAttachmentID); //!< Bind the depth for sampling
+	}
+
+	void OpenGLFrameBuffer::copyDepthToDefault()
+	{
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, m_OpenGL_ID); //!< Read from this frame buffer
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0); //!< Write to the window
+		glBlitFramebuffer(0, 0, m_width, m_height, 0, 0, m_width, m_height, GL_DEPTH_BUFFER_BIT, GL_NEAREST); //!< Copy the depth across, formats have to match
+		glBindFramebuffer(GL_FRAMEBUFFER, 0); //!< Leave the window bound
+	}
+
+	void OpenGLFrameBuffer::create()
+	{
+		glGenFramebuffers(1, &m_OpenGL_ID); //!< Generate the frame buffer
+		glBindFramebuffer(GL_FRAMEBUFFER, m_OpenGL_ID); //!< Bind it so the attachments can be added
+
+		m_colourAttachmentIDs.resize(m_colourFormats.size());
+		std::vector<GLenum> drawBuffers; //!< Outputs the fragment shader writes to
+		for (uint32_t i = 0; i < m_colourFormats.size(); i++)
+		{
+			GLenum internalFormat, dataFormat, type;
+			getColourFormat(m_colourFormats[i], internalFormat, dataFormat, type);
+
+			glGenTextures(1, &m_colourAttachmentIDs[i]); //!< Generate the attachment
+			glBindTexture(GL_TEXTURE_2D, m_colourAttachmentIDs[i]);
+			glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, m_width, m_height, 0, dataFormat, type, nullptr); //!< Allocate it
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST); //!< Read back exactly one texel per pixel
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, m_colourAttachmentIDs[i], 0); //!< Attach it
+			drawBuffers.push_back(GL_COLOR_ATTACHMENT0 + i);
+		}
+
+		if (drawBuffers.empty()) glDrawBuffer(GL_NONE); //!< Depth only
+		else glDrawBuffers(static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data()); //!< Write to every colour attachment
+
+		if (m_depthFormat == AttachmentFormat::Depth24Stencil8)
+		{
+			glGenTextures(1, &m_depthAttachmentID); //!< Generate the depth attachment
+			glBindTexture(GL_TEXTURE_2D, m_depthAttachmentID);
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH24_STENCIL8, m_width, m_height, 0, GL_DEPTH_STENCIL, GL_UNSIGNED_INT_24_8, nullptr); //!< Allocate it
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+			glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, m_depthAttachmentID, 0); //!< Attach it
+		}
+
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) Log::error("Frame buffer is incomplete"); //!< Check it can be rendered to
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0); //!< Leave the window bound
+	}
+
+	void OpenGLFrameBuffer::destroy()
+	{
+		if (!m_colourAttachmentIDs.empty()) glDeleteTextures(static_cast<GLsizei>(m_colourAttachmentIDs.size()), m_colourAttachmentIDs.data()); //!< Delete the colour attachments
+		if (m_depthAttachmentID) glDeleteTextures(1, &m_depthAttachmentID); //!< Delete the depth attachment
+		glDeleteFramebuffers(1, &m_OpenGL_ID); //!< Delete the frame buffer
+
+		m_colourAttachmentIDs.clear();
+		m_depthAttachmentID = 0;
+		m_OpenGL_ID = 0;
+	}
+}
@@ -0,0 +1,101 @@
+/*! \file OpenGLProgramCache.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+
+#include "platform/OpenGL/OpenGLProgramCache.h"
+#include "core/hash.h"
+#include "systems/log.h"
+#include <fstream>
+#include <filesystem>
+#include <vector>
+#include <cstdio>
+
+namespace Engine
+{
+	const char* OpenGLProgramCache::s_directory = "./shaderCache"; //!< Next to the assets folder
+
+	uint64_t OpenGLProgramCache::getKey(uint64_t sourceHash, const std::string & defines)
+	{
+		uint64_t key = Hash::fnv1a(getDriverIdentity()); //!< Binaries only work on the driver that made them
+		key = Hash::fnv1a(reinterpret_cast<const char*>(&sourceHash), sizeof(sourceHash), key); //!< Preprocessed sources
+		return Hash::fnv1a(defines, key); //!< Permutation
+	}
+
+	uint32_t OpenGLProgramCache::load(uint64_t key)
+	{
+		if (!isSupported()) return 0;
+
+		std::ifstream handle(getPath(key), std::ios::in | std::ios::binary); //!< Open the cached binary
+		if (!handle.is_open()) return 0; //!< Not cached yet
+
+		GLenum format = 0;
+		handle.read(reinterpret_cast<char*>(&format), sizeof(format)); //!< Binary format comes first
+		std::vector<char> binary((std::istreambuf_iterator<char>(handle)), std::istreambuf_iterator<char>()); //!< Then the binary itself
+		handle.close();
+		if (binary.empty()) return 0;
+
+		GLuint program = glCreateProgram(); //!< Create the program from the binary
+		glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			glDeleteProgram(program); //!< Rejected by the driver, compile from source instead
+			std::remove(getPath(key).c_str()); //!< It will be replaced once the source is compiled
+			return 0;
+		}
+		return program;
+	}
+
+	void OpenGLProgramCache::save(uint64_t key, uint32_t program)
+	{
+		if (!isSupported()) return;
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length); //!< Size of the binary
+		if (length <= 0) return;
+
+		std::vector<char> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, nullptr, &format, binary.data()); //!< Read the binary back
+
+		std::error_code error;
+		std::filesystem::create_directories(s_directory, error); //!< Make the cache folder if this is the first run
+		std::ofstream handle(getPath(key), std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!handle.is_open())
+		{
+			Log::error("Could not write program binary to {0}", getPath(key)); //!< Not fatal, it just won't be cached
+			return;
+		}
+		handle.write(reinterpret_cast<const char*>(&format), sizeof(format));
+		handle.write(binary.data(), binary.size());
+	}
+
+	bool OpenGLProgramCache::isSupported()
+	{
+		static GLint formatCount = -1;
+		if (formatCount < 0) glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount); //!< Ask once
+		return formatCount > 0;
+	}
+
+	std::string OpenGLProgramCache::getPath(uint64_t key)
+	{
+		char name[17];
+		snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(key)); //!< Key as hex
+		return std::string(s_directory) + "/" + name + ".bin";
+	}
+
+	const std::string & OpenGLProgramCache::getDriverIdentity()
+	{
+		static std::string identity;
+		if (identity.empty())
+		{
+			const char* vendor = reinterpret_cast<const char*>(glGetString(GL_VENDOR));
+			const char* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+			const char* version = reinterpret_cast<const char*>(glGetString(GL_VERSION));
+			identity = std::string(vendor ? vendor : "") + "|" + (renderer ? renderer : "") + "|" + (version ? version : "");
+		}
+		return identity;
+	}
+}
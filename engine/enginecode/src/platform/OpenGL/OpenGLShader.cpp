@@ -1,194 +1,449 @@
-/*! \file OpenGLShader.cpp */
-
-#include "engine_pch.h"
-#include <glad/glad.h>
-#include "platform/OpenGL/OpenGLShader.h"
-#include <fstream>
-#include "systems/log.h"
-#include <string>
-#include <array>
-#include <glm/gtc/type_ptr.hpp>
-namespace Engine 
-{
-	OpenGLShader::OpenGLShader(const char * vertexFile, const char * fragmentFile)
-	{
-		std::string  vertSrc, fragSrc, line; //!< pre-define the filepaths
-		std::fstream handle(vertexFile, std::ios::in); //!< Use fStream to read from file
-		if (handle.is_open())
-		{
-			while (getline(handle, line))
-			{
-				vertSrc += (line + "\n"); //!< Seperate the vertex block into lines
-			}
-		}
-		else
-		{
-			Log::error("Could not load vertex shader file {0}", vertexFile); //!< If vertex shader didnt load, log it
-			return;
-		}
-		handle.close(); //!< Close the file
-
-		handle.open(fragmentFile, std::ios::in); //!< Open the fragment file
-		if (handle.is_open())
-		{
-
-			while (getline(handle, line))
-			{
-				fragSrc += (line + "\n"); //!< Seperate the fragment file into lines
-			}
-		}
-		else
-		{
-			Log::error("Could not load fragment shader file {0}", fragmentFile); //!< If fragment shader didnt load, log it
-			return;
-		}
-		handle.close(); //!< Close the file
-
-		compileAndLink(vertSrc.c_str(), fragSrc.c_str()); //!< Compile the shaders and link them
-		//Converted to string here as compileAndLink needs a (const char *)
-	}
-
-	OpenGLShader::OpenGLShader(const char * filepath)
-	{
-		std::string line; //!< String line
-		std::array<std::string, shaderType::Compute + 1> src; //!< Src array with a string and a data type
-		uint32_t type = shaderType::none; //!< Empty shader data type
-
-		std::fstream handle(filepath, std::ios::in); //!< Open the file
-
-		if (handle.is_open())
-		{
-			while (getline(handle, line))  //!< Seperate the shader into regions based on the regions in the shader file
-			{
-			if (line.find("#region Vertex") != std::string::npos) { type = shaderType::Vertex; continue; }
-			if (line.find("#region Fragment") != std::string::npos) { type = shaderType::Fragment; continue; }
-			if (line.find("#region Geometry") != std::string::npos) { type = shaderType::Geometry; continue; }
-			if (line.find("#region TessellationControl") != std::string::npos) { type = shaderType::TessellationControl; continue; }
-			if (line.find("#region TessellationEvaluation") != std::string::npos) { type = shaderType::TesselationEvaluation; continue; }
-			if (line.find("#region Compute") != std::string::npos) { type = shaderType::Compute; continue; }
-			if (type != shaderType::none) src[type] += (line + "\n");
-			}
-		}
-		else
-		{
-			Log::error("Could not load shader: Type: {0}, Path: {1}", type, filepath); //!< if file couldnt be opened, log it
-		}
-		handle.close(); //!< Close the file
-
-		compileAndLink(src[shaderType::Vertex].c_str(), src[shaderType::Fragment].c_str()); //!< Compile and link the shader
-		//Converted to string here as compileAndLink needs a (const char *)
-	}
-
-	OpenGLShader::~OpenGLShader()
-	{
-		glDeleteProgram(m_OpenGL_ID); //!< Delete the shader
-	}
-
-	void OpenGLShader::uploadInt(const char * name, int value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniform1i(uniformLocation, value); //!< Upload the new data
-	}
-
-	void OpenGLShader::uploadFloat(const char * name, float value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniform1f(uniformLocation, value); //!< Upload the new data
-	}
-
-	void OpenGLShader::uploadFloat2(const char * name, const glm::vec2 & value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniform2f(uniformLocation, value.x, value.y); //!< Upload the new data
-	}
-
-	void OpenGLShader::uploadFloat3(const char * name, const glm::vec3 & value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniform3f(uniformLocation, value.x, value.y, value.z); //!< Upload the new data
-	}
-
-	void OpenGLShader::uploadFloat4(const char * name, const glm::vec4 & value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniform4f(uniformLocation, value.x, value.y, value.z, value.w); //!< Upload the new data
-	}
-
-	void OpenGLShader::uploadMat4(const char * name, const glm::mat4 & value)
-	{
-		uint32_t uniformLocation = glGetUniformLocation(m_OpenGL_ID, name); //!< Get the uniform block's location
-		glUniformMatrix4fv(uniformLocation, 1, GL_FALSE, glm::value_ptr(value)); //!< Upload the new data
-	}
-
-	void OpenGLShader::compileAndLink(const char * vertexShaderSrc, const char * fragmentShaderSrc)
-	{
-		GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER); //!< Create the shader
-
-		const GLchar* source = vertexShaderSrc; //!< Get the vertex shader source
-		glShaderSource(vertexShader, 1, &source, 0); //!< Set the source
-		glCompileShader(vertexShader); //!< Compile the shader
-
-		GLint isCompiled = 0; //!< GLint for if shader compiled
-		glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &isCompiled); //!< Get the shader
-		if (isCompiled == GL_FALSE) //!< If shader has not compiled
-		{
-			GLint maxLength = 0; //!< Max length for the info log and shader
-			glGetShaderiv(vertexShader, GL_INFO_LOG_LENGTH, &maxLength); //!< Get the shader iv
-
-			std::vector<GLchar> infoLog(maxLength); //!< Set the info log to a vector of chars
-			glGetShaderInfoLog(vertexShader, maxLength, &maxLength, &infoLog[0]); //!< Get the shader info log
-			Log::error("Shader compile error: {0}", std::string(infoLog.begin(), infoLog.end())); //!< Log the shader's compile errors
-
-			glDeleteShader(vertexShader); //!< Delete the shader Gluint
-			return;
-		}
-
-		GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER); //!< create the fragment shader
-
-		source = fragmentShaderSrc;  //!< Get the fragment shader source
-		glShaderSource(fragmentShader, 1, &source, 0); //!< set the source
-		glCompileShader(fragmentShader); //!< Compile the fragment shader
-
-		glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &isCompiled); //!< get the shader
-		if (isCompiled == GL_FALSE) //!< If the shader is not compiled
-		{
-			GLint maxLength = 0; //!< Get the info log max length
-			glGetShaderiv(fragmentShader, GL_INFO_LOG_LENGTH, &maxLength); //!< Get the shader iv
-
-			std::vector<GLchar> infoLog(maxLength); //!< Create a vector of chars for the info log
-			glGetShaderInfoLog(fragmentShader, maxLength, &maxLength, &infoLog[0]); //!< Give the info log the shader's info log
-			Log::error("Shader compile error: {0}", std::string(infoLog.begin(), infoLog.end())); //!< Log the info log
-
-			glDeleteShader(fragmentShader); //!< Delete the frag shader
-			glDeleteShader(vertexShader); //!< Delete the vert shader
-
-			return;
-		}
-
-		m_OpenGL_ID = glCreateProgram(); //!< Create the program with the openglID
-		glAttachShader(m_OpenGL_ID, vertexShader); //!< Attach the vertex shader
-		glAttachShader(m_OpenGL_ID, fragmentShader); //!< Attach the fragment shader
-		glLinkProgram(m_OpenGL_ID); //!< Link the program
-
-		GLint isLinked = 0; //!< if the program is linked
-		glGetProgramiv(m_OpenGL_ID, GL_LINK_STATUS, (int*)&isLinked); //!< Get the program iv
-		if (isLinked == GL_FALSE) //!< if the program fails to link
-		{
-			GLint maxLength = 0; //!< Get the info log max length
-			glGetProgramiv(m_OpenGL_ID, GL_INFO_LOG_LENGTH, &maxLength); //!< get the program IV
-
-			std::vector<GLchar> infoLog(maxLength); //!< Set the info log max length as a vector of chars
-			glGetProgramInfoLog(m_OpenGL_ID, maxLength, &maxLength, &infoLog[0]); //!< get the program info log
-			Log::error("Shader linking error: {0}", std::string(infoLog.begin(), infoLog.end())); //!< Log the fragment error
-
-			glDeleteProgram(m_OpenGL_ID); //!< Delete the program
-			glDeleteShader(vertexShader); //!< Delete the vertex shader
-			glDeleteShader(fragmentShader); //!< Delete the fragment shader
-
-			return;
-		}
-
-		glDetachShader(m_OpenGL_ID, vertexShader); //!< Detach the vertex shader
-		glDetachShader(m_OpenGL_ID, fragmentShader); //!< Detach the fragment shader
-	}
-}
\ No newline at end of file
+/*! \file OpenGLShader.cpp */
+
+#include "engine_pch.h"
+#include <glad/glad.h>
+#include "platform/OpenGL/OpenGLShader.h"
+#include "platform/OpenGL/OpenGLProgramCache.h"
+#include "core/hash.h"
+#include "systems/log.h"
+#include "systems/profiler.h"
+#include "systems/renderThread.h"
+#include "renderer/renderStats.h"
+#include <string>
+#include <array>
+#include <cstring>
+#include <algorithm>
+#include <glm/gtc/type_ptr.hpp>
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+namespace Engine 
+{
+	std::vector<OpenGLShader*> OpenGLShader::s_pending; //!< Initialise the pending compiles
+	std::mutex OpenGLShader::s_pendingMutex; //!< Initialise the pending compiles' mutex
+
+	OpenGLShader::OpenGLShader(const char * vertexFile, const char * fragmentFile)
+	{
+		m_failed = true; //!< Until the sources have been read
+		if (!ShaderPreprocessor::expand(vertexFile, m_source.getStage(ShaderStage::Vertex))) return; //!< Read the vertex shader with its includes, the preprocessor logs failures
+		if (!ShaderPreprocessor::expand(fragmentFile, m_source.getStage(ShaderStage::Fragment))) return; //!< Read the fragment shader with its includes
+		m_failed = false;
+
+		m_source.hash = Hash::fnv1a(m_source.getStage(ShaderStage::Vertex)); //!< Content hash for the program cache
+		m_source.hash = Hash::fnv1a("\0", 1, m_source.hash);
+		m_source.hash = Hash::fnv1a(m_source.getStage(ShaderStage::Fragment), m_source.hash);
+		compileFeatures(m_features); //!< Compile the shaders and link them
+	}
+
+	OpenGLShader::OpenGLShader(const char * filepath, ShaderCompileMode mode) : m_mode(mode)
+	{
+		if (!ShaderPreprocessor::process(filepath, m_source)) //!< Read the file, resolve includes and split the stages, the preprocessor logs failures
+		{
+			m_failed = true;
+			return;
+		}
+
+		for (auto& feature : m_source.features) m_declaredMask |= feature.flag; //!< Every flag that picks a permutation
+		compileFeatures(m_features); //!< Compile and link the shader with every feature on
+	}
+
+	OpenGLShader::OpenGLShader(const std::shared_ptr<OpenGLShader>& base, uint32_t features) : m_mode(base->m_mode), m_base(base), m_isPermutation(true)
+	{
+		m_declaredMask = base->m_declaredMask; //!< So the permutation can tell which features matter if the base goes
+		m_features = features; //!< Set the features before compiling, as the defines depend on them
+		compileFeatures(features); //!< Compile the base shader's sources with only these features
+	}
+
+	OpenGLShader::~OpenGLShader()
+	{
+		uint32_t vertexShader = 0, fragmentShader = 0;
+		{
+			std::lock_guard<std::mutex> lock(s_pendingMutex); //!< updatePending may be advancing this compile on the render thread
+			if (m_pending)
+			{
+				s_pending.erase(std::remove(s_pending.begin(), s_pending.end(), this), s_pending.end()); //!< Stop polling it
+				vertexShader = m_pending->vertexShader;
+				fragmentShader = m_pending->fragmentShader;
+			}
+		}
+
+		RenderThread::enqueue([id = m_OpenGL_ID, vertexShader, fragmentShader]()
+		{
+			glDeleteShader(vertexShader); //!< Zero is silently ignored
+			glDeleteShader(fragmentShader);
+			glDeleteProgram(id); //!< Delete the shader
+		}); //!< On the render thread after the frames using it, whichever thread let go of it
+	}
+
+	void OpenGLShader::updatePending()
+	{
+		NG_PROFILE_FUNCTION();
+		std::lock_guard<std::mutex> lock(s_pendingMutex); //!< A shader released on another thread takes itself off the list
+		for (size_t i = 0; i < s_pending.size();)
+		{
+			OpenGLShader* shader = s_pending[i];
+			if (shader->advance(*shader->m_pending))
+			{
+				shader->m_pending.reset(); //!< Done with the compile data
+				s_pending[i] = s_pending.back(); //!< Swap and pop, order doesn't matter
+				s_pending.pop_back();
+			}
+			else i++;
+		}
+	}
+
+	std::shared_ptr<Shader> OpenGLShader::getVariant(uint32_t features)
+	{
+		if (m_isPermutation)
+		{
+			if (auto base = m_base.lock()) return base->getVariant(features); //!< Permutations are all owned by the base shader
+			if ((features & m_declaredMask) != m_features) Log::error("Shader permutation outlived its base shader, so it can't make other permutations"); //!< The sources went with the base
+			return shared_from_this(); //!< The closest there is
+		}
+
+		uint32_t key = features & m_declaredMask; //!< Flags the shader doesn't declare make no difference
+		if (key == m_declaredMask) return shared_from_this(); //!< Everything on, which is the base shader
+
+		auto it = m_variants.find(key);
+		if (it != m_variants.end()) return it->second; //!< Already compiled
+
+		std::shared_ptr<Shader> variant(new OpenGLShader(std::static_pointer_cast<OpenGLShader>(shared_from_this()), key)); //!< Compile it now
+		m_variants[key] = variant; //!< Cache it
+		return variant;
+	}
+
+	UniformHandle OpenGLShader::getUniformHandle(StringID name) const
+	{
+		UniformHandle handle;
+		auto it = m_uniformSlots.find(name);
+		if (it != m_uniformSlots.end())
+		{
+			handle.slot = it->second; //!< Found in the reflection table
+			handle.type = m_uniforms[it->second].type;
+		}
+		return handle;
+	}
+
+	int32_t OpenGLShader::getUniformBlockIndex(StringID blockName) const
+	{
+		auto it = m_blockIndices.find(blockName);
+		if (it != m_blockIndices.end()) return it->second;
+		return -1; //!< The shader doesn't have this block
+	}
+
+	void OpenGLShader::bindUniformBlock(int32_t blockIndex, uint32_t bindingPoint)
+	{
+		if (blockIndex < 0 || blockIndex >= static_cast<int32_t>(m_blockBindings.size())) return; //!< Not one of this program's blocks
+		if (m_blockBindings[blockIndex] == static_cast<int32_t>(bindingPoint)) return; //!< Already there, the binding is part of the program's state
+		glUniformBlockBinding(m_OpenGL_ID, blockIndex, bindingPoint); //!< Bind the block
+		m_blockBindings[blockIndex] = static_cast<int32_t>(bindingPoint);
+	}
+
+	void OpenGLShader::uploadInt(UniformHandle handle, int value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniform1i(m_uniforms[handle.slot].location, value); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadFloat(UniformHandle handle, float value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniform1f(m_uniforms[handle.slot].location, value); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadFloat2(UniformHandle handle, const glm::vec2 & value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniform2f(m_uniforms[handle.slot].location, value.x, value.y); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadFloat3(UniformHandle handle, const glm::vec3 & value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniform3f(m_uniforms[handle.slot].location, value.x, value.y, value.z); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadFloat4(UniformHandle handle, const glm::vec4 & value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniform4f(m_uniforms[handle.slot].location, value.x, value.y, value.z, value.w); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadMat4(UniformHandle handle, const glm::mat4 & value)
+	{
+		if (changed(handle, &value, sizeof(value))) glUniformMatrix4fv(m_uniforms[handle.slot].location, 1, GL_FALSE, glm::value_ptr(value)); //!< Upload the new data
+	}
+
+	void OpenGLShader::uploadInt(const char * name, int value)
+	{
+		uploadInt(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	void OpenGLShader::uploadFloat(const char * name, float value)
+	{
+		uploadFloat(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	void OpenGLShader::uploadFloat2(const char * name, const glm::vec2 & value)
+	{
+		uploadFloat2(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	void OpenGLShader::uploadFloat3(const char * name, const glm::vec3 & value)
+	{
+		uploadFloat3(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	void OpenGLShader::uploadFloat4(const char * name, const glm::vec4 & value)
+	{
+		uploadFloat4(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	void OpenGLShader::uploadMat4(const char * name, const glm::mat4 & value)
+	{
+		uploadMat4(getUniformHandle(name), value); //!< Look the uniform up in the reflection table
+	}
+
+	bool OpenGLShader::changed(UniformHandle handle, const void * value, uint32_t size)
+	{
+		if (!handle.isValid()) return false; //!< Nothing to upload to
+
+		UniformState& uniform = m_uniforms[handle.slot];
+		if (uniform.uploaded && memcmp(uniform.value.data(), value, size) == 0) return false; //!< The program already has this value
+
+		memcpy(uniform.value.data(), value, size); //!< Remember it for next time
+		uniform.uploaded = true;
+		RenderStats::countUniformUpload();
+		return true;
+	}
+
+	void OpenGLShader::reflect()
+	{
+		m_uniforms.clear();
+		m_uniformSlots.clear();
+		m_blockIndices.clear();
+
+		GLint count = 0, maxLength = 0;
+		glGetProgramiv(m_OpenGL_ID, GL_ACTIVE_UNIFORMS, &count); //!< Number of active uniforms, including those inside blocks
+		glGetProgramiv(m_OpenGL_ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+		std::vector<GLchar> name(maxLength + 1);
+
+		for (GLint i = 0; i < count; i++)
+		{
+			GLint size = 0;
+			GLenum glType = 0;
+			glGetActiveUniform(m_OpenGL_ID, i, static_cast<GLsizei>(name.size()), nullptr, &size, &glType, name.data()); //!< Name and type of the uniform
+			GLint location = glGetUniformLocation(m_OpenGL_ID, name.data());
+			if (location < 0) continue; //!< Inside a uniform block, set through a uniform buffer instead
+
+			UniformState uniform;
+			uniform.location = location;
+			switch (glType)
+			{
+			case GL_FLOAT: uniform.type = ShaderDataType::Float; break;
+			case GL_FLOAT_VEC2: uniform.type = ShaderDataType::Float2; break;
+			case GL_FLOAT_VEC3: uniform.type = ShaderDataType::Float3; break;
+			case GL_FLOAT_VEC4: uniform.type = ShaderDataType::Float4; break;
+			case GL_FLOAT_MAT3: uniform.type = ShaderDataType::Mat3; break;
+			case GL_FLOAT_MAT4: uniform.type = ShaderDataType::Mat4; break;
+			default: uniform.type = ShaderDataType::Int; break; //!< Ints, bools and samplers are all set with glUniform1i
+			}
+
+			std::string uniformName(name.data());
+			size_t arrayStart = uniformName.find("[0]");
+			if (arrayStart != std::string::npos) uniformName.erase(arrayStart); //!< Arrays are reported as name[0], also find them by name
+
+			m_uniformSlots[StringID::intern(uniformName)] = static_cast<int32_t>(m_uniforms.size()); //!< Interned, so the name can be looked up again from the ID
+			m_uniforms.push_back(uniform);
+		}
+
+		glGetProgramiv(m_OpenGL_ID, GL_ACTIVE_UNIFORM_BLOCKS, &count); //!< Number of uniform blocks
+		glGetProgramiv(m_OpenGL_ID, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxLength);
+		name.resize(maxLength + 1);
+		m_blockBindings.assign(count, -1);
+		for (GLint i = 0; i < count; i++)
+		{
+			glGetActiveUniformBlockName(m_OpenGL_ID, i, static_cast<GLsizei>(name.size()), nullptr, name.data());
+			m_blockIndices[StringID::intern(name.data())] = i;
+			glGetActiveUniformBlockiv(m_OpenGL_ID, i, GL_UNIFORM_BLOCK_BINDING, &m_blockBindings[i]); //!< Start from the binding the program linked with
+		}
+	}
+
+	void OpenGLShader::compileFeatures(uint32_t features)
+	{
+		NG_PROFILE_SCOPE("Shader compile");
+		std::shared_ptr<OpenGLShader> baseShader = m_base.lock(); //!< Only called while the base is making this permutation, so it is alive
+		const OpenGLShader& base = baseShader ? *baseShader : *this; //!< Sources and declarations live on the base shader
+
+		std::string defines; //!< One #define per feature that is on
+		for (auto& feature : base.m_source.features)
+		{
+			if (features & feature.flag) defines += "#define " + feature.name + "\n";
+		}
+
+		std::string vertSrc = addDefines(base.m_source.getStage(ShaderStage::Vertex), defines);
+		std::string fragSrc = addDefines(base.m_source.getStage(ShaderStage::Fragment), defines);
+
+		uint64_t cacheKey = OpenGLProgramCache::getKey(base.m_source.hash, defines); //!< Key of the preprocessed sources and defines on this driver, no need to hash the sources again
+		m_OpenGL_ID = OpenGLProgramCache::load(cacheKey); //!< Try the binary from a previous run
+		if (m_OpenGL_ID)
+		{
+			reflect(); //!< Already linked, just needs looking at
+			m_ready = true;
+			return;
+		}
+
+		if (m_mode == ShaderCompileMode::Async)
+		{
+			m_pending.reset(new PendingCompile); //!< Keep the sources until the compiles are issued
+			m_pending->vertexSrc = vertSrc;
+			m_pending->fragmentSrc = fragSrc;
+			m_pending->cacheKey = cacheKey;
+			if (isParallelCompileSupported())
+			{
+				while (m_pending->stage != CompileStage::Finish) advance(*m_pending); //!< The driver compiles in the background, so issue everything now
+			}
+			std::lock_guard<std::mutex> lock(s_pendingMutex);
+			s_pending.push_back(this); //!< Finished off by updatePending
+			return;
+		}
+
+		m_ready = compileAndLink(vertSrc.c_str(), fragSrc.c_str()); //!< Compile and link the shader
+		m_failed = !m_ready;
+		if (m_ready) OpenGLProgramCache::save(cacheKey, m_OpenGL_ID); //!< Cache it for next time
+		//Converted to string here as compileAndLink needs a (const char *)
+	}
+
+	std::string OpenGLShader::addDefines(const std::string & source, const std::string & defines)
+	{
+		if (defines.empty()) return source; //!< Nothing to add
+
+		size_t version = source.find("#version"); //!< #version has to stay the first directive
+		size_t insertAt = version == std::string::npos ? 0 : source.find('\n', version);
+		if (insertAt == std::string::npos) return source + "\n" + defines; //!< #version was the last line
+		if (version != std::string::npos) insertAt++; //!< After the #version line's newline
+
+		return source.substr(0, insertAt) + defines + source.substr(insertAt);
+	}
+
+	bool OpenGLShader::compileAndLink(const char * vertexShaderSrc, const char * fragmentShaderSrc)
+	{
+		PendingCompile compile; //!< Run every step straight away
+		compile.vertexSrc = vertexShaderSrc;
+		compile.fragmentSrc = fragmentShaderSrc;
+		while (compile.stage != CompileStage::Finish) advance(compile);
+		return finish(compile);
+	}
+
+	bool OpenGLShader::advance(PendingCompile & compile)
+	{
+		switch (compile.stage)
+		{
+		case CompileStage::CompileVertex:
+			compile.vertexShader = compileStage(GL_VERTEX_SHADER, compile.vertexSrc); //!< Issue the vertex compile
+			compile.stage = CompileStage::CompileFragment;
+			return false;
+		case CompileStage::CompileFragment:
+			compile.fragmentShader = compileStage(GL_FRAGMENT_SHADER, compile.fragmentSrc); //!< Issue the fragment compile
+			compile.stage = CompileStage::Link;
+			return false;
+		case CompileStage::Link:
+			m_OpenGL_ID = glCreateProgram(); //!< Create the program with the openglID
+			glAttachShader(m_OpenGL_ID, compile.vertexShader); //!< Attach the vertex shader
+			glAttachShader(m_OpenGL_ID, compile.fragmentShader); //!< Attach the fragment shader
+			glProgramParameteri(m_OpenGL_ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE); //!< Let the binary be read back for the program cache
+			glLinkProgram(m_OpenGL_ID); //!< Link the program
+			compile.stage = CompileStage::Finish;
+			return false;
+		case CompileStage::Finish:
+			if (isParallelCompileSupported())
+			{
+				GLint complete = GL_FALSE;
+				glGetProgramiv(m_OpenGL_ID, GL_COMPLETION_STATUS_KHR, &complete); //!< Doesn't block
+				if (complete == GL_FALSE) return false; //!< Still compiling, try again next frame
+			}
+			m_ready = finish(compile); //!< Without the extension this may wait, but the compiles were issued on earlier frames
+			m_failed = !m_ready;
+			if (m_ready) OpenGLProgramCache::save(compile.cacheKey, m_OpenGL_ID); //!< Cache it for next time
+			compile.stage = CompileStage::Done;
+			return true;
+		default:
+			return true;
+		}
+	}
+
+	bool OpenGLShader::finish(PendingCompile & compile)
+	{
+		const GLuint stages[2] = { compile.vertexShader, compile.fragmentShader };
+		bool compiled = true;
+		for (GLuint stage : stages)
+		{
+			GLint isCompiled = 0; //!< GLint for if shader compiled
+			glGetShaderiv(stage, GL_COMPILE_STATUS, &isCompiled); //!< Get the shader
+			if (isCompiled == GL_FALSE) //!< If shader has not compiled
+			{
+				GLint maxLength = 0; //!< Max length for the info log and shader
+				glGetShaderiv(stage, GL_INFO_LOG_LENGTH, &maxLength); //!< Get the shader iv
+
+				std::vector<GLchar> infoLog(maxLength + 1); //!< Set the info log to a vector of chars
+				glGetShaderInfoLog(stage, maxLength, &maxLength, &infoLog[0]); //!< Get the shader info log
+				Log::error("Shader compile error: {0}", std::string(infoLog.begin(), infoLog.begin() + maxLength)); //!< Log the shader's compile errors
+				compiled = false;
+			}
+		}
+
+		GLint isLinked = 0; //!< if the program is linked
+		if (compiled) glGetProgramiv(m_OpenGL_ID, GL_LINK_STATUS, (int*)&isLinked); //!< Get the program iv
+		if (compiled && isLinked == GL_FALSE) //!< if the program fails to link
+		{
+			GLint maxLength = 0; //!< Get the info log max length
+			glGetProgramiv(m_OpenGL_ID, GL_INFO_LOG_LENGTH, &maxLength); //!< get the program IV
+
+			std::vector<GLchar> infoLog(maxLength + 1); //!< Set the info log max length as a vector of chars
+			glGetProgramInfoLog(m_OpenGL_ID, maxLength, &maxLength, &infoLog[0]); //!< get the program info log
+			Log::error("Shader linking error: {0}", std::string(infoLog.begin(), infoLog.begin() + maxLength)); //!< Log the fragment error
+		}
+
+		if (!compiled || isLinked == GL_FALSE)
+		{
+			glDeleteProgram(m_OpenGL_ID); //!< Delete the program
+			m_OpenGL_ID = 0; //!< No program
+			glDeleteShader(compile.vertexShader); //!< Delete the vertex shader
+			glDeleteShader(compile.fragmentShader); //!< Delete the fragment shader
+			compile.vertexShader = compile.fragmentShader = 0;
+			return false;
+		}
+
+		glDetachShader(m_OpenGL_ID, compile.vertexShader); //!< Detach the vertex shader
+		glDetachShader(m_OpenGL_ID, compile.fragmentShader); //!< Detach the fragment shader
+		glDeleteShader(compile.vertexShader); //!< The program keeps what it needs
+		glDeleteShader(compile.fragmentShader);
+		compile.vertexShader = compile.fragmentShader = 0;
+
+		reflect(); //!< Look up every uniform and block once, so uploads never need to ask the driver
+		return true;
+	}
+
+	uint32_t OpenGLShader::compileStage(uint32_t type, const std::string & source)
+	{
+		GLuint shader = glCreateShader(type); //!< Create the shader
+		const GLchar* src = source.c_str(); //!< Get the source
+		glShaderSource(shader, 1, &src, 0); //!< Set the source
+		glCompileShader(shader); //!< Start the compile, the result is checked in finish
+		return shader;
+	}
+
+	bool OpenGLShader::isParallelCompileSupported()
+	{
+		static int32_t supported = -1;
+		if (supported < 0)
+		{
+			supported = 0;
+			GLint count = 0;
+			glGetIntegerv(GL_NUM_EXTENSIONS, &count); //!< Check the extension list once
+			for (GLint i = 0; i < count; i++)
+			{
+				const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+				if (name && (strcmp(name, "GL_KHR_parallel_shader_compile") == 0 || strcmp(name, "GL_ARB_parallel_shader_compile") == 0)) supported = 1;
+			}
+		}
+		return supported == 1;
+	}
+}
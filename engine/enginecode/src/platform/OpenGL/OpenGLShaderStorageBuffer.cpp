@@ -0,0 +1,38 @@
+/*! \file OpenGLShaderStorageBuffer.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+#include "platform/OpenGL/OpenGLShaderStorageBuffer.h"
+#include "systems/renderThread.h"
+#include "renderer/renderStats.h"
+
+namespace Engine
+{
+	OpenGLShaderStorageBuffer::OpenGLShaderStorageBuffer(uint32_t size) : m_size(size > 16 ? size : 16)
+	{
+		glGenBuffers(1, &m_OpenGL_ID); //!< Generate a buffer
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_OpenGL_ID); //!< Bind the buffer
+		glBufferData(GL_SHADER_STORAGE_BUFFER, m_size, nullptr, GL_DYNAMIC_DRAW); //!< Allocate the storage, never 0 bytes so the buffer is always bindable
+	}
+
+	OpenGLShaderStorageBuffer::~OpenGLShaderStorageBuffer()
+	{
+		RenderThread::enqueue([id = m_OpenGL_ID]() { glDeleteBuffers(1, &id); }); //!< Delete the buffer on the render thread after the frames using it, whichever thread let go of it
+	}
+
+	void OpenGLShaderStorageBuffer::uploadData(const void * data, uint32_t size)
+	{
+		glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_OpenGL_ID); //!< Bind the buffer
+		if (size > m_size)
+		{
+			m_size = size > m_size * 2 ? size : m_size * 2; //!< Grow geometrically so a slowly growing buffer isn't reallocated every frame
+			glBufferData(GL_SHADER_STORAGE_BUFFER, m_size, nullptr, GL_DYNAMIC_DRAW); //!< Reallocate, indexed bindings follow the buffer object so they stay valid
+		}
+		if (size > 0) glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, size, data); //!< Update the buffer with the data given
+		RenderStats::countBufferUpload(size);
+	}
+
+	void OpenGLShaderStorageBuffer::bind(uint32_t bindingPoint)
+	{
+		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, bindingPoint, m_OpenGL_ID); //!< Bind the whole buffer to the binding point
+	}
+}
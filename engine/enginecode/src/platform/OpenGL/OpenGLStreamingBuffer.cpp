@@ -0,0 +1,113 @@
+/*! \file OpenGLStreamingBuffer.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+#include "platform/OpenGL/OpenGLStreamingBuffer.h"
+#include "systems/renderThread.h"
+#include "renderer/renderStats.h"
+#include "systems/log.h"
+#include <algorithm>
+
+namespace Engine
+{
+	namespace
+	{
+		inline uint32_t alignUp(uint32_t value, uint32_t alignment) { return (value + alignment - 1) / alignment * alignment; } //!< Round up to a multiple of alignment
+	}
+
+	OpenGLStreamingBuffer::OpenGLStreamingBuffer(uint32_t regionSize, uint32_t regionCount) :
+		m_regionCount(regionCount > 1 ? regionCount : 2) //!< One region would wait on the GPU every frame
+	{
+		int32_t uniformAlignment = 0, storageAlignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+		m_minAlignment = static_cast<uint32_t>(std::max({ uniformAlignment, storageAlignment, 16 })); //!< Any range handed out can be bound as either
+
+		m_regionSize = alignUp(regionSize, m_minAlignment); //!< Every region starts on an aligned offset
+		m_head = m_reserved = 0;
+		m_fences.assign(m_regionCount, nullptr);
+
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT; //!< Stays mapped while the GPU uses it, writes are seen without flushing
+		uint32_t size = m_regionSize * m_regionCount;
+		glCreateBuffers(1, &m_OpenGL_ID); //!< Create the buffer
+		glNamedBufferStorage(m_OpenGL_ID, size, nullptr, flags); //!< Immutable storage, the driver never has to rename it
+		m_mapped = static_cast<uint8_t*>(glMapNamedBufferRange(m_OpenGL_ID, 0, size, flags)); //!< Map it once for the buffer's lifetime
+		if (!m_mapped) Log::error("Could not map streaming buffer of {0} bytes", size);
+	}
+
+	OpenGLStreamingBuffer::~OpenGLStreamingBuffer()
+	{
+		RenderThread::enqueue([id = m_OpenGL_ID, fences = m_fences]()
+		{
+			for (auto& fence : fences) if (fence) glDeleteSync(fence); //!< Delete any fences still waiting
+			glUnmapNamedBuffer(id); //!< Unmap the buffer
+			glDeleteBuffers(1, &id); //!< Delete the buffer
+		}); //!< On the render thread after the frames using it, whichever thread let go of it
+	}
+
+	void OpenGLStreamingBuffer::beginFrame()
+	{
+		if (m_fences[m_region]) glDeleteSync(m_fences[m_region]);
+		m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0); //!< Signalled once the GPU has finished everything issued so far, including the draws reading this region
+
+		m_region = (m_region + 1) % m_regionCount; //!< Move on to the oldest region
+		waitForRegion(m_region); //!< Normally already signalled, the GPU is a frame or two behind at most
+		m_head = m_reserved = m_region * m_regionSize;
+		m_overflowed = false;
+	}
+
+	void* OpenGLStreamingBuffer::reserve(uint32_t size, uint32_t alignment, uint32_t& offset)
+	{
+		if (!m_mapped) return nullptr;
+		if (size > m_regionSize)
+		{
+			Log::error("Streaming buffer reservation of {0} bytes is bigger than a region of {1} bytes", size, m_regionSize);
+			return nullptr;
+		}
+
+		uint32_t start = alignUp(m_head, std::max(alignment, m_minAlignment));
+		if (start + size > (m_region + 1) * m_regionSize)
+		{
+			if (!m_overflowed) Log::error("Streaming buffer region of {0} bytes is full this frame, reservations fail until the next", m_regionSize); //!< Moving on to the next region here would leave ranges bound earlier in the frame unfenced
+			m_overflowed = true; //!< Logged once a frame
+			return nullptr;
+		}
+
+		m_reserved = start;
+		offset = start;
+		return m_mapped + start;
+	}
+
+	void OpenGLStreamingBuffer::commit(uint32_t size)
+	{
+		m_head = m_reserved + size; //!< Anything after this is free to reserve again
+		RenderStats::countBufferUpload(size); //!< Written straight into mapped memory
+	}
+
+	void OpenGLStreamingBuffer::bindRange(StreamingBufferTarget target, uint32_t bindingPoint, uint32_t offset, uint32_t size)
+	{
+		GLenum glTarget = target == StreamingBufferTarget::Uniform ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER;
+		glBindBufferRange(glTarget, bindingPoint, m_OpenGL_ID, offset, size); //!< Bind the range
+	}
+
+	void OpenGLStreamingBuffer::waitForRegion(uint32_t region)
+	{
+		GLsync& fence = m_fences[region];
+		if (!fence) return; //!< Never been used
+
+		GLbitfield waitFlags = 0;
+		while (true)
+		{
+			GLenum result = glClientWaitSync(fence, waitFlags, 1000000); //!< Wait up to a millisecond at a time
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED) break;
+			if (result == GL_WAIT_FAILED)
+			{
+				Log::error("Waiting on a streaming buffer fence failed");
+				break;
+			}
+			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT; //!< Timed out, make sure the fence has actually been sent to the GPU
+		}
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+}
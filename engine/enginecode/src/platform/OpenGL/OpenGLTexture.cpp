@@ -1,63 +1,385 @@
-/* \file OpenGLTexture.cpp */
-
-#include "engine_pch.h"
-#include <glad/glad.h>
-
-#include "platform/OpenGL/OpenGLTexture.h"
-#define STB_IMAGE_IMPLEMENTATION
-#include "stb_image.h"
-
-namespace Engine
-{
-	OpenGLTexture::OpenGLTexture(const char * filepath)
-	{
-		int32_t width, height, channels; //!< set the width, height and channels
-		unsigned char *data = stbi_load(filepath, &width, &height, &channels, 0); //!< get the filepath
-
-		if (data) { init(width, height, channels, data); } //!< If there is data, initialise it
-
-		stbi_image_free(data); //!< Load the texture
-	}
-
-	OpenGLTexture::OpenGLTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
-	{
-		init(width, height, channels, data); //!< Initialise the data passed
-	}
-
-	OpenGLTexture::~OpenGLTexture()
-	{
-		glDeleteTextures(1, &m_OpenGL_ID); //!< Delete the texture
-	}
-
-	void OpenGLTexture::edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data)
-	{
-		glBindTexture(GL_TEXTURE_2D, m_OpenGL_ID); //!< Bind the texture
-		if (data)
-		{
-			if (m_channels == 3) glTextureSubImage2D(m_OpenGL_ID, 0, xOffset, yOffset, width, height, GL_RGB, GL_UNSIGNED_BYTE, data); //!< If there are 3 channels set the texture to just use RGB
-			else if (m_channels == 4)  glTextureSubImage2D(m_OpenGL_ID, 0, xOffset, yOffset, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data); //!< If there are the 4 channels set the textuer to just use RGBA
-			else return;
-		}
-	}
-
-	void OpenGLTexture::init(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
-	{
-		glGenTextures(1, &m_OpenGL_ID); //!< Generate the texture
-		glBindTexture(GL_TEXTURE_2D, m_OpenGL_ID); //!< Bind the texture
-
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); //!< Set the texture parameters
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); //!< Set the texture parameters
-
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); //!< Set the texture parameters
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); //!< Set the texture parameters
-
-		if (channels == 3) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data); //!< If there are 3 channels set the texture image to use RGB
-		else if (channels == 4) glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, data); //!< If there are 4 channels set the texture image to use RGBA
-		else return;
-		glGenerateMipmap(GL_TEXTURE_2D); //!< Generate the mipmap of the texture
-		
-		m_width = width; //!< Define the width
-		m_height = height; //!< Define the height
-		m_channels = channels; //!< Define the channels
-	}
+/* \file OpenGLTexture.cpp */
+
+#include "engine_pch.h"
+#include <glad/glad.h>
+
+#include "platform/OpenGL/OpenGLTexture.h"
+#include "renderer/renderStats.h"
+#include "systems/threadPool.h"
+#include "systems/profiler.h"
+#include "systems/renderThread.h"
+#include "systems/log.h"
+#include "rendering/compressedImage.h"
+#include <algorithm>
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb_image.h"
+
+namespace Engine
+{
+	namespace
+	{
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT1_EXT
+		const GLenum GL_COMPRESSED_RGBA_S3TC_DXT1_EXT = 0x83F1; //!< From EXT_texture_compression_s3tc, which every desktop driver has
+		const GLenum GL_COMPRESSED_RGBA_S3TC_DXT5_EXT = 0x83F3;
+#endif
+#ifndef GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT
+		const GLenum GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT = 0x8C4D; //!< From EXT_texture_sRGB
+		const GLenum GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT = 0x8C4F;
+#endif
+
+		GLenum toGLFormat(CompressedFormat format, bool srgb) //!< Internal format for a block compression format, 0 if there isn't one
+		{
+			switch (format)
+			{
+			case CompressedFormat::BC1: return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+			case CompressedFormat::BC3: return srgb ? GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			case CompressedFormat::BC4: return GL_COMPRESSED_RED_RGTC1;
+			case CompressedFormat::BC5: return GL_COMPRESSED_RG_RGTC2;
+			case CompressedFormat::BC7: return srgb ? GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM : GL_COMPRESSED_RGBA_BPTC_UNORM;
+			default: return 0;
+			}
+		}
+	}
+
+	std::vector<OpenGLTexture*> OpenGLTexture::s_pending; //!< Initialise the pending loads
+	std::mutex OpenGLTexture::s_pendingMutex; //!< Initialise the pending loads' mutex
+	uint32_t OpenGLTexture::s_placeholderID = 0; //!< Initialise the placeholder's render ID
+	uint32_t OpenGLTexture::s_placeholderUsers = 0; //!< Initialise the placeholder's user count
+
+	PendingLoad::~PendingLoad()
+	{
+		stbi_image_free(pixels); //!< Whichever of the texture and the worker lets go last frees them
+	}
+
+	OpenGLTexture::OpenGLTexture(const char * filepath, TextureLoadMode mode)
+	{
+		if (CompressedImage::isCompressedFile(filepath))
+		{
+			loadCompressed(filepath); //!< Just a file read, there is no decode to move off this thread
+			return;
+		}
+
+		if (mode == TextureLoadMode::Async)
+		{
+			loadAsync(filepath);
+			return;
+		}
+
+		NG_PROFILE_SCOPE("Texture load");
+		int32_t width, height, channels; //!< set the width, height and channels
+		unsigned char *data = stbi_load(filepath, &width, &height, &channels, 0); //!< get the filepath
+
+		if (data) { init(width, height, channels, data); } //!< If there is data, initialise it
+		else Log::error("Could not read texture: {0}", filepath);
+		m_failed = !m_ready; //!< Unreadable, or a channel count that can't be uploaded
+
+		stbi_image_free(data); //!< Load the texture
+	}
+
+	OpenGLTexture::OpenGLTexture(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
+	{
+		init(width, height, channels, data); //!< Initialise the data passed
+	}
+
+	OpenGLTexture::~OpenGLTexture()
+	{
+		uint32_t stagingBuffer = 0;
+		bool usesPlaceholder;
+		{
+			std::lock_guard<std::mutex> lock(s_pendingMutex); //!< updatePending may be uploading this texture on the render thread
+			if (m_pending)
+			{
+				s_pending.erase(std::remove(s_pending.begin(), s_pending.end(), this), s_pending.end()); //!< Still loading, the worker keeps the pending load alive until it is done with it
+				stagingBuffer = m_pending->stagingBuffer;
+			}
+			usesPlaceholder = m_usesPlaceholder;
+		}
+
+		RenderThread::enqueue([id = m_OpenGL_ID, stagingBuffer, usesPlaceholder]()
+		{
+			if (stagingBuffer) glDeleteBuffers(1, &stagingBuffer); //!< The load never finished
+			if (usesPlaceholder) releasePlaceholder();
+			glDeleteTextures(1, &id); //!< Delete the texture
+		}); //!< On the render thread after the frames using it, whichever thread let go of it
+	}
+
+	void OpenGLTexture::edit(uint32_t xOffset, uint32_t yOffset, uint32_t width, uint32_t height, unsigned char * data)
+	{
+		if (m_compressed)
+		{
+			Log::error("Block compressed textures can't be edited");
+			return;
+		}
+		finishLoad(); //!< The edit has to land on top of the file's pixels
+		glBindTexture(GL_TEXTURE_2D, m_OpenGL_ID); //!< Bind the texture
+		if (data)
+		{
+			if (m_channels == 3) glTextureSubImage2D(m_OpenGL_ID, 0, xOffset, yOffset, width, height, GL_RGB, GL_UNSIGNED_BYTE, data); //!< If there are 3 channels set the texture to just use RGB
+			else if (m_channels == 4)  glTextureSubImage2D(m_OpenGL_ID, 0, xOffset, yOffset, width, height, GL_RGBA, GL_UNSIGNED_BYTE, data); //!< If there are the 4 channels set the textuer to just use RGBA
+			else return;
+			RenderStats::countTextureUpload(static_cast<uint64_t>(width) * height * m_channels);
+		}
+	}
+
+	void OpenGLTexture::updatePending()
+	{
+		NG_PROFILE_FUNCTION();
+		std::lock_guard<std::mutex> lock(s_pendingMutex); //!< A texture released on another thread takes itself off the list
+		uint32_t budget = s_uploadBudget;
+		for (size_t i = 0; i < s_pending.size();)
+		{
+			OpenGLTexture* texture = s_pending[i];
+			if (texture->m_decode.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+			{
+				i++; //!< Still decoding, a later one may be ready
+				continue;
+			}
+			if (budget == 0) break; //!< Spent, the rest wait for the next frame
+
+			bool done = texture->m_pending->pixels ? texture->upload(budget) : true; //!< A failed decode is done, and stays as the placeholder
+			if (done) texture->endLoad(); //!< Takes it off the list, so i now points at the next one
+			else i++;
+		}
+	}
+
+	void OpenGLTexture::init(uint32_t width, uint32_t height, uint32_t channels, unsigned char * data)
+	{
+		glGenTextures(1, &m_OpenGL_ID); //!< Generate the texture
+		glBindTexture(GL_TEXTURE_2D, m_OpenGL_ID); //!< Bind the texture
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); //!< Set the texture parameters
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE); //!< Set the texture parameters
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR); //!< Set the texture parameters
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR); //!< Set the texture parameters
+
+		GLenum format;
+		if (channels == 3) format = GL_RGB; //!< If there are 3 channels set the texture image to use RGB
+		else if (channels == 4) format = GL_RGBA; //!< If there are 4 channels set the texture image to use RGBA
+		else
+		{
+			m_failed = true;
+			return;
+		}
+
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); //!< Rows are tightly packed, RGB rows and small levels may not be a multiple of 4
+		glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+		if (data)
+		{
+			bool parallel = !RenderThread::isRunning() && !ThreadPool::isWorkerThread(); //!< On the render thread the rows would queue behind async decodes, and a worker can't wait on the pool
+			MipChain mips(data, width, height, channels, MipFilter::Box, false, parallel); //!< Made here rather than by glGenerateMipmap stalling this thread in the driver
+			for (uint32_t level = 0; level < mips.getLevels().size(); level++)
+			{
+				const MipLevel& mip = mips.getLevels()[level];
+				glTexImage2D(GL_TEXTURE_2D, level + 1, format, mip.width, mip.height, 0, format, GL_UNSIGNED_BYTE, mips.getData(mip));
+			}
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(mips.getLevels().size())); //!< Complete with the levels given
+			RenderStats::countTextureUpload(static_cast<uint64_t>(width) * height * channels + mips.getSize());
+		}
+		else glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0); //!< Nothing to make levels from, edits only ever reach the full size one
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+		m_width = width; //!< Define the width
+		m_height = height; //!< Define the height
+		m_channels = channels; //!< Define the channels
+		m_ready = true;
+	}
+
+	void OpenGLTexture::loadAsync(const char * filepath)
+	{
+		acquirePlaceholder(); //!< Drawn as the placeholder until the upload is done, or for good if it fails
+		m_usesPlaceholder = true;
+
+		int32_t width, height, channels;
+		if (!stbi_info(filepath, &width, &height, &channels)) //!< Only the header, so the size is known straight away
+		{
+			Log::error("Could not read texture: {0}", filepath);
+			m_failed = true;
+			return;
+		}
+
+		m_width = width;
+		m_height = height;
+		m_channels = channels == 3 ? 3 : 4; //!< Only RGB and RGBA are kept, anything else is expanded to RGBA when decoded
+
+		uint32_t levels = MipChain::getLevelCount(m_width, m_height); //!< Full mip chain
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &m_OpenGL_ID); //!< Create the texture without binding it, so the bound textures are left alone
+		glTextureParameteri(m_OpenGL_ID, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); //!< Same parameters as a blocking load
+		glTextureParameteri(m_OpenGL_ID, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTextureParameteri(m_OpenGL_ID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTextureParameteri(m_OpenGL_ID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTextureStorage2D(m_OpenGL_ID, levels, m_channels == 3 ? GL_RGB8 : GL_RGBA8, m_width, m_height); //!< Storage now, the rows are copied in later
+
+		m_pending = std::make_shared<PendingLoad>();
+		m_decode = ThreadPool::submit([load = m_pending, path = std::string(filepath), width = m_width, height = m_height, channels = m_channels]()
+		{
+			NG_PROFILE_SCOPE("Texture decode");
+			int32_t decodedWidth, decodedHeight, fileChannels;
+			unsigned char* pixels = stbi_load(path.c_str(), &decodedWidth, &decodedHeight, &fileChannels, channels);
+			if (pixels && (static_cast<uint32_t>(decodedWidth) != width || static_cast<uint32_t>(decodedHeight) != height))
+			{
+				stbi_image_free(pixels); //!< The file changed since its header was read, the storage is the wrong size
+				pixels = nullptr;
+			}
+			if (pixels) load->mips = MipChain(pixels, width, height, channels); //!< Made here too, not split up as this is already a worker
+			else Log::error("Could not decode texture: {0}", path);
+			load->pixels = pixels; //!< Seen by the render thread once the future is ready
+		});
+		std::lock_guard<std::mutex> lock(s_pendingMutex);
+		s_pending.push_back(this); //!< Finished off by updatePending
+	}
+
+	void OpenGLTexture::loadCompressed(const char * filepath)
+	{
+		NG_PROFILE_SCOPE("Compressed texture load");
+		CompressedImage image;
+		if (!image.load(filepath))
+		{
+			m_failed = true; //!< The image logs why
+			return;
+		}
+
+		const auto& levels = image.getLevels();
+		glGenTextures(1, &m_OpenGL_ID); //!< Generate the texture
+		glBindTexture(GL_TEXTURE_2D, m_OpenGL_ID); //!< Bind the texture
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); //!< Same parameters as an uncompressed texture
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(levels.size()) - 1); //!< Complete with however many levels the file has
+
+		GLenum internalFormat = toGLFormat(image.getFormat(), image.isSRGB());
+		uint64_t uploaded = 0;
+		for (uint32_t level = 0; level < levels.size(); level++)
+		{
+			glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, levels[level].width, levels[level].height, 0, levels[level].size, image.getData(levels[level])); //!< Blocks go to the GPU as they are stored, no decode or mip generation
+			uploaded += levels[level].size;
+		}
+		RenderStats::countTextureUpload(uploaded);
+
+		m_width = image.getWidth();
+		m_height = image.getHeight();
+		m_channels = CompressedImage::getChannels(image.getFormat());
+		m_compressed = true;
+		m_ready = true;
+	}
+
+	bool OpenGLTexture::upload(uint32_t& budget)
+	{
+		PendingLoad& load = *m_pending;
+		const auto& mips = load.mips.getLevels();
+		uint32_t levels = static_cast<uint32_t>(mips.size()) + 1; //!< The decoded pixels and the chain below them
+		uint32_t imageSize = m_width * m_height * m_channels;
+
+		if (!load.stagingBuffer)
+		{
+			glCreateBuffers(1, &load.stagingBuffer); //!< One staging buffer for every level, each frame fills a fresh band of it
+			glNamedBufferStorage(load.stagingBuffer, imageSize + load.mips.getSize(), nullptr, GL_MAP_WRITE_BIT);
+		}
+
+		bool failed = false;
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, load.stagingBuffer);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1); //!< Rows are tightly packed, RGB rows and small levels may not be a multiple of 4
+		do
+		{
+			uint32_t width = m_width, height = m_height, levelOffset = 0; //!< The full size level is first in the buffer, the chain after it
+			const unsigned char* pixels = load.pixels;
+			if (load.level > 0)
+			{
+				const MipLevel& mip = mips[load.level - 1];
+				width = mip.width;
+				height = mip.height;
+				levelOffset = imageSize + mip.offset;
+				pixels = load.mips.getData(mip);
+			}
+
+			uint32_t rowSize = width * m_channels;
+			uint32_t rows = std::min(std::max(budget / rowSize, 1u), height - load.rowsUploaded); //!< At least a row, so big textures still make progress
+			uint32_t offset = levelOffset + load.rowsUploaded * rowSize;
+			uint32_t size = rows * rowSize;
+
+			void* destination = glMapNamedBufferRange(load.stagingBuffer, offset, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT); //!< The band hasn't been used, so there is nothing to wait for
+			if (!destination)
+			{
+				Log::error("Could not map texture staging buffer of {0} bytes", size);
+				failed = true;
+				break;
+			}
+			std::memcpy(destination, pixels + (offset - levelOffset), size);
+			glUnmapNamedBuffer(load.stagingBuffer);
+
+			glTextureSubImage2D(m_OpenGL_ID, load.level, 0, load.rowsUploaded, width, rows, m_channels == 3 ? GL_RGB : GL_RGBA, GL_UNSIGNED_BYTE, reinterpret_cast<const void*>(static_cast<uintptr_t>(offset))); //!< Copied from the buffer by the driver, without blocking this thread
+			RenderStats::countTextureUpload(size);
+
+			load.rowsUploaded += rows;
+			budget -= std::min(budget, size);
+			if (load.rowsUploaded == height)
+			{
+				load.level++; //!< On to the next level, the small ones share what is left of the budget
+				load.rowsUploaded = 0;
+			}
+		} while (budget > 0 && load.level < levels);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0); //!< Unbound, or other pixel uploads would read from it
+
+		if (failed)
+		{
+			load.level = levels; //!< Give up, it stays as the placeholder
+			return true;
+		}
+		if (load.level < levels) return false;
+
+		m_ready = true; //!< Every level is in, there is nothing left to generate
+		return true;
+	}
+
+	void OpenGLTexture::finishLoad()
+	{
+		if (!m_pending) return;
+		NG_PROFILE_FUNCTION();
+		m_decode.wait(); //!< Decoded on a worker, or inline if there are none
+
+		if (m_pending->pixels)
+		{
+			uint32_t budget = ~0u;
+			while (!upload(budget)) {} //!< Every row at once
+		}
+		std::lock_guard<std::mutex> lock(s_pendingMutex); //!< Only around the list, not the wait, a worker releasing a texture may be what the decode is queued behind
+		endLoad();
+	}
+
+	void OpenGLTexture::endLoad()
+	{
+		s_pending.erase(std::remove(s_pending.begin(), s_pending.end(), this), s_pending.end()); //!< Stop polling it, the order of the rest is kept
+		if (m_pending->stagingBuffer) glDeleteBuffers(1, &m_pending->stagingBuffer); //!< The driver keeps it until the copies out of it are done
+		m_pending.reset(); //!< Frees the pixels, unless the worker still has them
+		m_decode = std::future<void>();
+		m_failed = !m_ready; //!< The decode or an upload failed
+
+		if (m_ready && m_usesPlaceholder)
+		{
+			releasePlaceholder(); //!< Never drawn as the placeholder again
+			m_usesPlaceholder = false;
+		}
+	}
+
+	void OpenGLTexture::acquirePlaceholder()
+	{
+		if (s_placeholderUsers++) return; //!< Already made
+
+		const unsigned char grey[4] = { 128, 128, 128, 255 };
+		glCreateTextures(GL_TEXTURE_2D, 1, &s_placeholderID);
+		glTextureStorage2D(s_placeholderID, 1, GL_RGBA8, 1, 1);
+		glTextureSubImage2D(s_placeholderID, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, grey); //!< One texel, so it reads the same at any UV
+	}
+
+	void OpenGLTexture::releasePlaceholder()
+	{
+		if (--s_placeholderUsers) return; //!< Still in use
+
+		glDeleteTextures(1, &s_placeholderID);
+		s_placeholderID = 0;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,42 @@
+/*! \file OpenGLTimerQuery.cpp */
+#include "engine_pch.h"
+#include <glad/glad.h>
+#include "platform/OpenGL/OpenGLTimerQuery.h"
+#include "systems/renderThread.h"
+
+namespace Engine
+{
+	OpenGLTimerQuery::OpenGLTimerQuery()
+	{
+		glCreateQueries(GL_TIME_ELAPSED, 1, &m_OpenGL_ID); //!< Create the query
+	}
+
+	OpenGLTimerQuery::~OpenGLTimerQuery()
+	{
+		RenderThread::enqueue([id = m_OpenGL_ID]() { glDeleteQueries(1, &id); }); //!< Delete the query on the render thread after the frames using it, whichever thread let go of it
+	}
+
+	void OpenGLTimerQuery::begin()
+	{
+		glBeginQuery(GL_TIME_ELAPSED, m_OpenGL_ID); //!< Start timing
+	}
+
+	void OpenGLTimerQuery::end()
+	{
+		glEndQuery(GL_TIME_ELAPSED); //!< Stop timing, the result arrives once the GPU gets here
+	}
+
+	bool OpenGLTimerQuery::isReady() const
+	{
+		GLint available = 0;
+		glGetQueryObjectiv(m_OpenGL_ID, GL_QUERY_RESULT_AVAILABLE, &available); //!< Doesn't stall the pipeline
+		return available != 0;
+	}
+
+	uint64_t OpenGLTimerQuery::getElapsed() const
+	{
+		GLuint64 elapsed = 0;
+		glGetQueryObjectui64v(m_OpenGL_ID, GL_QUERY_RESULT, &elapsed); //!< Stalls until the GPU is done if the query isn't ready
+		return elapsed;
+	}
+}
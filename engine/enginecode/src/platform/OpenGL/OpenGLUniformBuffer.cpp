@@ -1,45 +1,128 @@
-/*! \file OpenGLUniformBuffer.cpp  */
-#include "engine_pch.h"
-#include <glad/glad.h>
-
-#include "platform/OpenGL/OpenGLUniformBuffer.h"
-
-namespace Engine
-{
-	uint32_t OpenGLUniformBuffer::s_blockNo = 0; //!< Initialise the static member block number
-	OpenGLUniformBuffer::OpenGLUniformBuffer(const UniformBufferLayout & layout)
-	{
-		m_blockNo = s_blockNo; //!< Initialise the block number
-		s_blockNo++; //!< Increment the block number
-
-		m_layout = layout; //!< Define the layout
-		glGenBuffers(1, &m_OpenGL_ID); //!< Generate a buffer
-		glBindBuffer(GL_UNIFORM_BUFFER, m_OpenGL_ID); //!< Bind the buffer
-		glBufferData(GL_UNIFORM_BUFFER, m_layout.getStride(), nullptr, GL_DYNAMIC_DRAW); //!< Set the buffer data
-		glBindBufferRange(GL_UNIFORM_BUFFER, m_blockNo, m_OpenGL_ID, 0, m_layout.getStride()); //!< Bind the buffer range (max and min buffer range)
-
-		for (auto& element : m_layout)
-		{
-			m_uniformCache[element.m_name] = std::pair<uint32_t, uint32_t>(element.m_offset, element.m_size); //!< For every element in the layout add it's offset and size to the uniformCache as a pair
-		}
-	}
-
-	OpenGLUniformBuffer::~OpenGLUniformBuffer()
-	{
-		glDeleteBuffers(1, &m_OpenGL_ID); //!< Delete the uniform buffer
-	}
-
-	void OpenGLUniformBuffer::attachShaderBlock(const std::shared_ptr<Shader>& shader, const char * blockName)
-	{
-		uint32_t blockIndex = glGetUniformBlockIndex(shader->getRenderID(), blockName); //!< Get the block index
-		glUniformBlockBinding(shader->getRenderID(), blockIndex, m_blockNo); //!< Bind the block
-	}
-
-	void OpenGLUniformBuffer::uploadShaderData(const char * uniformName, void * data)
-	{
-		auto& pair = m_uniformCache[uniformName]; //!< Take the uniform cache member
-		glBindBuffer(GL_UNIFORM_BUFFER, m_OpenGL_ID); //!< Bind the buffer
-		glBufferSubData(GL_UNIFORM_BUFFER, pair.first, pair.second, data); //!< update the buffer with the data fiven and the uniform cache data
-	}
-	
-}
\ No newline at end of file
+/*! \file OpenGLUniformBuffer.cpp  */
+#include "engine_pch.h"
+#include <glad/glad.h>
+
+#include "platform/OpenGL/OpenGLUniformBuffer.h"
+#include "systems/renderThread.h"
+#include "renderer/renderStats.h"
+#include "systems/log.h"
+#include <algorithm>
+#include <cstring>
+
+namespace Engine
+{
+	uint32_t OpenGLUniformBuffer::s_nextBlockNo = UniformBuffer::reservedBindings; //!< Initialise the next binding point, after the reserved ones
+	std::vector<uint32_t> OpenGLUniformBuffer::s_freeBlockNos; //!< Initialise the free binding points
+
+	OpenGLUniformBuffer::OpenGLUniformBuffer(const UniformBufferLayout & layout)
+	{
+		m_blockNo = acquireBlockNo(); //!< Initialise the block number
+
+		m_layout = layout; //!< Define the layout
+		glGenBuffers(1, &m_OpenGL_ID); //!< Generate a buffer
+		glBindBuffer(GL_UNIFORM_BUFFER, m_OpenGL_ID); //!< Bind the buffer
+		glBufferData(GL_UNIFORM_BUFFER, m_layout.getStride(), nullptr, GL_DYNAMIC_DRAW); //!< Set the buffer data
+		if (m_blockNo != noBlockNo) glBindBufferRange(GL_UNIFORM_BUFFER, m_blockNo, m_OpenGL_ID, 0, m_layout.getStride()); //!< Bind the buffer range (max and min buffer range)
+
+		for (auto& element : m_layout)
+		{
+			m_fieldLookup[StringID::intern(element.m_name)] = static_cast<uint32_t>(m_fields.size()); //!< Key by the name's contents, not where the string lives
+			m_fields.push_back({ element.m_offset, SDT::size(element.m_dataType) }); //!< Only copy the real size, a vec3 is padded to 16 bytes in the block but the caller passes 12
+		}
+
+		m_shadow.assign(m_layout.getStride(), 0); //!< Start zeroed
+		m_dirtyBegin = 0; //!< The GPU copy is uninitialised, so the first flush sends everything
+		m_dirtyEnd = m_layout.getStride();
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		RenderThread::enqueue([id = m_OpenGL_ID, blockNo = m_blockNo]()
+		{
+			glDeleteBuffers(1, &id); //!< Delete the uniform buffer
+			releaseBlockNo(blockNo); //!< Let another buffer have the binding point
+		}); //!< On the render thread after the frames using it, whichever thread let go of it, which also keeps the binding points to one thread
+	}
+
+	void OpenGLUniformBuffer::attachShaderBlock(const std::shared_ptr<Shader>& shader, StringID blockName)
+	{
+		int32_t blockIndex = shader->getUniformBlockIndex(blockName); //!< Get the block index from the shader's reflection
+		if (blockIndex < 0 || m_blockNo == noBlockNo) return; //!< The shader doesn't use this block, or the buffer never got a binding point
+		shader->bindUniformBlock(blockIndex, m_blockNo); //!< Bind the block, the shader skips it if it is already bound here
+	}
+
+	UniformFieldHandle OpenGLUniformBuffer::getFieldHandle(StringID uniformName) const
+	{
+		UniformFieldHandle handle;
+		auto it = m_fieldLookup.find(uniformName);
+		if (it != m_fieldLookup.end()) handle.field = static_cast<int32_t>(it->second);
+		return handle;
+	}
+
+	void OpenGLUniformBuffer::uploadShaderData(UniformFieldHandle field, const void * data)
+	{
+		if (!field.isValid()) return; //!< Not in the layout
+
+		const Field& target = m_fields[field.field];
+		uint8_t* destination = m_shadow.data() + target.offset;
+		if (std::memcmp(destination, data, target.size) == 0) return; //!< Same as what's staged, nothing to send
+
+		std::memcpy(destination, data, target.size); //!< Stage the value
+
+		if (isDirty()) //!< Grow the dirty range to cover the field
+		{
+			m_dirtyBegin = std::min(m_dirtyBegin, target.offset);
+			m_dirtyEnd = std::max(m_dirtyEnd, target.offset + target.size);
+		}
+		else
+		{
+			m_dirtyBegin = target.offset;
+			m_dirtyEnd = target.offset + target.size;
+		}
+	}
+
+	void OpenGLUniformBuffer::uploadShaderData(StringID uniformName, const void * data)
+	{
+		UniformFieldHandle field = getFieldHandle(uniformName);
+		if (!field.isValid())
+		{
+			Log::error("Uniform buffer has no field called {0}", uniformName.getString());
+			return;
+		}
+		uploadShaderData(field, data);
+	}
+
+	uint32_t OpenGLUniformBuffer::acquireBlockNo()
+	{
+		if (!s_freeBlockNos.empty())
+		{
+			uint32_t blockNo = s_freeBlockNos.back(); //!< Reuse a binding point from a destroyed buffer
+			s_freeBlockNos.pop_back();
+			return blockNo;
+		}
+
+		int32_t maxBindings = 0;
+		glGetIntegerv(GL_MAX_UNIFORM_BUFFER_BINDINGS, &maxBindings); //!< At least 36 on any GL 4.x driver
+		if (s_nextBlockNo >= static_cast<uint32_t>(maxBindings))
+		{
+			Log::error("Out of uniform buffer binding points, {0} are in use. This buffer is left unbound", maxBindings);
+			return noBlockNo;
+		}
+		return s_nextBlockNo++; //!< Hand out a new one
+	}
+
+	void OpenGLUniformBuffer::releaseBlockNo(uint32_t blockNo)
+	{
+		if (blockNo != noBlockNo) s_freeBlockNos.push_back(blockNo); //!< Each binding point belongs to one buffer, so it is only ever given back once
+	}
+
+	void OpenGLUniformBuffer::flush()
+	{
+		if (!isDirty()) return; //!< Nothing changed since the last flush
+
+		glNamedBufferSubData(m_OpenGL_ID, m_dirtyBegin, m_dirtyEnd - m_dirtyBegin, m_shadow.data() + m_dirtyBegin); //!< One upload covering every change
+		RenderStats::countBufferUpload(m_dirtyEnd - m_dirtyBegin);
+		m_dirtyBegin = m_dirtyEnd = 0;
+	}
+
+}
@@ -1,11 +1,11 @@
-/*! \file engine_pch.h
-* \brief A list of header files to be precompiled in order to reduce compile times
-*/
-
-#pragma once
-
-#include <iostream>
-#include <string>
-#include <memory>
-
-
+/*! \file engine_pch.h
+* \brief A list of header files to be precompiled in order to reduce compile times
+*/
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <memory>
+
+
@@ -1,4 +1,4 @@
-#pragma once
-#include <gtest/gtest.h>
-#include "events/events.h"
-
+#pragma once
+#include <gtest/gtest.h>
+#include "events/events.h"
+
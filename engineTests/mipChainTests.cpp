@@ -0,0 +1,153 @@
+#include "mipChainTests.h"
+#include <algorithm>
+
+std::vector<uint8_t> makeNoise(uint32_t width, uint32_t height, uint32_t channels)
+{
+	std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * channels);
+	uint32_t state = 12345u;
+	for (auto& pixel : pixels)
+	{
+		state = state * 1664525u + 1013904223u;
+		pixel = static_cast<uint8_t>(state >> 24);
+	}
+	return pixels;
+}
+
+std::vector<uint8_t> referenceBox(const std::vector<uint8_t>& source, uint32_t width, uint32_t height, uint32_t channels)
+{
+	uint32_t levelWidth = std::max(width / 2, 1u);
+	uint32_t levelHeight = std::max(height / 2, 1u);
+	std::vector<uint8_t> level(static_cast<size_t>(levelWidth) * levelHeight * channels);
+	auto texel = [&](uint32_t x, uint32_t y, uint32_t channel) -> uint32_t { return source[(static_cast<size_t>(std::min(y, height - 1)) * width + std::min(x, width - 1)) * channels + channel]; };
+
+	for (uint32_t y = 0; y < levelHeight; y++)
+	{
+		for (uint32_t x = 0; x < levelWidth; x++)
+		{
+			for (uint32_t channel = 0; channel < channels; channel++)
+			{
+				uint32_t sum = texel(x * 2, y * 2, channel) + texel(x * 2 + 1, y * 2, channel) + texel(x * 2, y * 2 + 1, channel) + texel(x * 2 + 1, y * 2 + 1, channel);
+				level[(static_cast<size_t>(y) * levelWidth + x) * channels + channel] = static_cast<uint8_t>((sum + 2) / 4);
+			}
+		}
+	}
+	return level;
+}
+
+std::vector<uint8_t> makeColumns(uint32_t width, uint32_t height, uint32_t channels, uint8_t even, uint8_t odd)
+{
+	std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * channels);
+	for (size_t i = 0; i < pixels.size(); i++) pixels[i] = ((i / channels) % width) % 2 ? odd : even;
+	return pixels;
+}
+
+void expectMatchesReference(uint32_t width, uint32_t height, uint32_t channels)
+{
+	std::vector<uint8_t> pixels = makeNoise(width, height, channels);
+	Engine::MipChain chain(pixels.data(), width, height, channels);
+	ASSERT_EQ(chain.getLevels().size() + 1, Engine::MipChain::getLevelCount(width, height)); // The chain holds every level below the full size one
+
+	std::vector<uint8_t> expected = pixels;
+	uint32_t levelWidth = width, levelHeight = height;
+	for (const auto& level : chain.getLevels())
+	{
+		expected = referenceBox(expected, levelWidth, levelHeight, channels);
+		levelWidth = std::max(levelWidth / 2, 1u);
+		levelHeight = std::max(levelHeight / 2, 1u);
+		ASSERT_EQ(level.width, levelWidth);
+		ASSERT_EQ(level.height, levelHeight);
+		ASSERT_EQ(level.size, expected.size());
+
+		const uint8_t* data = chain.getData(level);
+		for (size_t i = 0; i < expected.size(); i++) ASSERT_EQ(data[i], expected[i]) << "level " << levelWidth << "x" << levelHeight << ", byte " << i;
+	}
+}
+
+TEST(MipChain, BoxMatchesReferencePowerOfTwo) {
+	expectMatchesReference(64, 32, 4);
+}
+
+TEST(MipChain, BoxMatchesReferenceOddSizes) {
+	expectMatchesReference(37, 11, 4); // 18 wide next, so the vector loop leaves a two texel tail
+	expectMatchesReference(7, 5, 4);
+	expectMatchesReference(1, 9, 4); // One texel wide, only the scalar path can read it
+}
+
+TEST(MipChain, BoxMatchesReferenceWidthNotMultipleOfFour) {
+	expectMatchesReference(70, 33, 4);
+	expectMatchesReference(22, 6, 4);
+}
+
+TEST(MipChain, BoxMatchesReferenceOtherChannelCounts) {
+	expectMatchesReference(13, 7, 3);
+	expectMatchesReference(9, 4, 1);
+}
+
+TEST(MipChain, LevelCount) {
+	EXPECT_EQ(Engine::MipChain::getLevelCount(1, 1), 1u);
+	EXPECT_EQ(Engine::MipChain::getLevelCount(256, 256), 9u);
+	EXPECT_EQ(Engine::MipChain::getLevelCount(37, 11), 6u);
+}
+
+
+TEST(MipChain, KaiserFlatStaysFlat) {
+	for (uint8_t value : { 0, 1, 37, 128, 200, 255 })
+	{
+		for (bool srgb : { false, true })
+		{
+			std::vector<uint8_t> pixels = makeColumns(40, 24, 4, value, value);
+			Engine::MipChain chain(pixels.data(), 40, 24, 4, Engine::MipFilter::Kaiser, srgb);
+			for (const auto& level : chain.getLevels())
+			{
+				const uint8_t* data = chain.getData(level);
+				for (uint32_t i = 0; i < level.size; i++) ASSERT_EQ(data[i], value) << (srgb ? "sRGB" : "linear") << " level " << level.width << "x" << level.height << ", byte " << i;
+			}
+		}
+	}
+}
+
+TEST(MipChain, KaiserAlternatingColumnsAverage) {
+	std::vector<uint8_t> pixels = makeColumns(64, 16, 4, 0, 255);
+	Engine::MipChain chain(pixels.data(), 64, 16, 4, Engine::MipFilter::Kaiser);
+	const Engine::MipLevel& level = chain.getLevels()[0];
+	const uint8_t* data = chain.getData(level);
+	for (uint32_t y = 0; y < level.height; y++)
+	{
+		for (uint32_t x = 3; x < level.width - 3; x++) // The edges are repeated, so only columns the kernel can't reach past them alternate on every tap
+		{
+			for (uint32_t channel = 0; channel < 4; channel++) EXPECT_NEAR(data[(y * level.width + x) * 4 + channel], 127.5, 0.5) << x << ", " << y;
+		}
+	}
+}
+
+TEST(MipChain, KaiserKeepsRampsInPlace) {
+	const uint32_t width = 64, height = 8;
+	std::vector<uint8_t> pixels(width * height);
+	for (uint32_t i = 0; i < pixels.size(); i++) pixels[i] = static_cast<uint8_t>((i % width) * 2); // A shifted kernel moves the ramp
+	Engine::MipChain chain(pixels.data(), width, height, 1, Engine::MipFilter::Kaiser);
+	const Engine::MipLevel& level = chain.getLevels()[0];
+	const uint8_t* data = chain.getData(level);
+	for (uint32_t y = 0; y < level.height; y++)
+	{
+		for (uint32_t x = 3; x < level.width - 3; x++) EXPECT_NEAR(data[y * level.width + x], x * 4 + 1, 1) << x << ", " << y;
+	}
+}
+
+TEST(MipChain, SRGBAveragesInLinearSpace) {
+	std::vector<uint8_t> pixels = makeColumns(32, 8, 4, 0, 255);
+	for (auto filter : { Engine::MipFilter::Box, Engine::MipFilter::Kaiser })
+	{
+		Engine::MipChain chain(pixels.data(), 32, 8, 4, filter, true);
+		const Engine::MipLevel& level = chain.getLevels()[0];
+		const uint8_t* data = chain.getData(level);
+		for (uint32_t y = 0; y < level.height; y++)
+		{
+			for (uint32_t x = 3; x < level.width - 3; x++)
+			{
+				const uint8_t* texel = data + (y * level.width + x) * 4;
+				for (uint32_t channel = 0; channel < 3; channel++) EXPECT_NEAR(texel[channel], 188, 1) << x << ", " << y; // Half of linear white, sRGB encoded
+				EXPECT_NEAR(texel[3], 127.5, 0.5) << x << ", " << y; // Alpha is averaged as it is stored
+			}
+		}
+	}
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include <gtest/gtest.h>
+#include "rendering/mipChain.h"
+#include <vector>
+#include <cstdint>
+
+std::vector<uint8_t> makeNoise(uint32_t width, uint32_t height, uint32_t channels); //!< Pixels from a fixed seed, so every run checks the same image
+std::vector<uint8_t> referenceBox(const std::vector<uint8_t>& source, uint32_t width, uint32_t height, uint32_t channels); //!< One level down, a texel at a time, with the edge repeated on odd sizes
+std::vector<uint8_t> makeColumns(uint32_t width, uint32_t height, uint32_t channels, uint8_t even, uint8_t odd); //!< Every channel of even columns set to one value and odd columns to another
+void expectMatchesReference(uint32_t width, uint32_t height, uint32_t channels); //!< Check every level of a box chain against the reference
@@ -1,11 +1,11 @@
-#include <gtest/gtest.h>
-#include <iostream>
-
-int main(int argc, char **argv) {
-	::testing::InitGoogleTest(&argc, argv);
-	RUN_ALL_TESTS();
-
-	std::cout << std::endl << "Press enter to continue" << std::endl;
-	std::getchar();
-	return 0;
+#include <gtest/gtest.h>
+#include <iostream>
+
+int main(int argc, char **argv) {
+	::testing::InitGoogleTest(&argc, argv);
+	RUN_ALL_TESTS();
+
+	std::cout << std::endl << "Press enter to continue" << std::endl;
+	std::getchar();
+	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,34 @@
+#region Vertex
+
+#version 440 core
+
+out vec2 texCoord;
+
+void main()
+{
+	// Fullscreen triangle from the vertex ID, no vertex buffer needed
+	vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	texCoord = position;
+	gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
+
+
+#region Fragment
+
+#version 440 core
+
+layout(location = 0) out vec4 colour;
+
+in vec2 texCoord;
+
+#include "include/light.glsl"
+
+uniform sampler2D u_albedo;
+uniform sampler2D u_depth;
+
+void main()
+{
+	if (texture(u_depth, texCoord).r >= 1.0) discard; // Nothing was drawn here, keep the clear colour
+
+	colour = vec4(u_ambientColour * texture(u_albedo, texCoord).rgb, 1.0);
+}
@@ -0,0 +1,54 @@
+#feature USE_TEXTURE 0
+#feature USE_TINT 1
+
+#region Vertex
+
+#version 440 core
+
+layout(location = 0) in vec3 a_vertexPosition;
+layout(location = 1) in vec3 a_vertexNormal;
+layout(location = 2) in vec2 a_texCoord;
+
+out vec3 normal;
+out vec2 texCoord;
+
+#include "include/camera.glsl"
+#include "include/draw.glsl"
+
+void main()
+{
+	normal = mat3(transpose(inverse(u_model))) * a_vertexNormal;
+	texCoord = vec2(a_texCoord.x, a_texCoord.y);
+	gl_Position =  u_projection * u_view * u_model * vec4(a_vertexPosition,1.0);
+}
+
+
+#region Fragment
+
+#version 440 core
+
+layout(location = 0) out vec4 albedo;
+layout(location = 1) out vec2 packedNormal;
+
+in vec3 normal;
+in vec2 texCoord;
+
+#include "include/draw.glsl"
+
+#ifdef USE_TEXTURE
+uniform sampler2D u_texData;
+#endif
+
+#include "include/normalPacking.glsl"
+
+void main()
+{
+	albedo = vec4(1.0);
+#ifdef USE_TEXTURE
+	albedo *= texture(u_texData, texCoord);
+#endif
+#ifdef USE_TINT
+	albedo *= u_tint;
+#endif
+	packedNormal = encodeNormal(normalize(normal));
+}
@@ -0,0 +1,69 @@
+#region Vertex
+
+#version 440 core
+
+layout(location = 0) in vec3 a_vertexPosition;
+
+flat out int lightIndex;
+
+#include "include/camera.glsl"
+
+#include "include/pointLights.glsl"
+
+void main()
+{
+	lightIndex = gl_InstanceID;
+
+	PointLight light = lights[gl_InstanceID];
+	vec3 worldPos = light.positionRadius.xyz + a_vertexPosition * light.positionRadius.w; // Cube around the light's sphere
+	gl_Position = u_projection * u_view * vec4(worldPos, 1.0);
+}
+
+
+#region Fragment
+
+#version 440 core
+
+layout(location = 0) out vec4 colour;
+
+flat in int lightIndex;
+
+#include "include/light.glsl"
+
+#include "include/pointLights.glsl"
+
+uniform sampler2D u_albedo;
+uniform sampler2D u_normal;
+uniform sampler2D u_depth;
+uniform vec2 u_screenSize;
+
+#include "include/normalPacking.glsl"
+
+void main()
+{
+	vec2 uv = gl_FragCoord.xy / u_screenSize;
+	float depth = texture(u_depth, uv).r;
+	if (depth >= 1.0) discard; // Background
+
+	vec4 worldPos = u_inverseViewProjection * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+	vec3 fragmentPos = worldPos.xyz / worldPos.w;
+
+	PointLight light = lights[lightIndex];
+	vec3 toLight = light.positionRadius.xyz - fragmentPos;
+	float dist = length(toLight);
+	if (dist >= light.positionRadius.w) discard; // Inside the cube but outside the sphere
+
+	float attenuation = 1.0 - dist / light.positionRadius.w;
+	attenuation *= attenuation;
+
+	vec3 norm = decodeNormal(texture(u_normal, uv).rg);
+	vec3 lightDir = toLight / max(dist, 0.0001);
+	vec3 viewDir = normalize(u_viewPos - fragmentPos);
+	float diff = max(dot(norm, lightDir), 0.0);
+	float specularStrength = 0.8;
+	vec3 reflectDir = reflect(-lightDir, norm);
+	float spec = pow(max(dot(viewDir, reflectDir), 0.0), 64);
+
+	vec3 lighting = (diff + specularStrength * spec) * light.colourIntensity.rgb * light.colourIntensity.a * attenuation;
+	colour = vec4(lighting * texture(u_albedo, uv).rgb, 1.0);
+}
@@ -0,0 +1,25 @@
+#region Vertex
+
+#version 440 core
+
+layout(location = 0) in vec3 a_vertexPosition;
+
+#include "include/camera.glsl"
+#include "include/draw.glsl"
+
+void main()
+{
+	gl_Position =  u_projection * u_view * u_model * vec4(a_vertexPosition,1.0);
+}
+
+
+#region Fragment
+
+#version 440 core
+
+layout(location = 0) out vec4 colour;
+
+void main()
+{
+	colour = vec4(0.5, 0.5, 0.5, 1.0); // Flat grey while the real shader compiles
+}
@@ -0,0 +1,5 @@
+layout (std140) uniform b_camera
+{
+	mat4 u_projection;
+	mat4 u_view;
+};
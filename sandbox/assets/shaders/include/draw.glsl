@@ -0,0 +1,5 @@
+layout (std140, binding = 0) uniform b_draw // Per draw constants, streamed by Renderer3D. Uniform buffers never take binding point 0
+{
+	mat4 u_model;
+	vec4 u_tint;
+};
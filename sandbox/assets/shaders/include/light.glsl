@@ -0,0 +1,8 @@
+layout (std140) uniform b_light
+{
+	vec3 u_viewPos;
+	vec3 u_ambientColour;
+	vec4 u_clusterDims; // Tiles across, tiles down, depth slices
+	vec4 u_clusterParams; // Slice scale, slice bias, tile width in pixels, tile height in pixels
+	mat4 u_inverseViewProjection; // Clip space back to world space, for rebuilding positions from depth
+};
@@ -0,0 +1,10 @@
+struct PointLight
+{
+	vec4 positionRadius;
+	vec4 colourIntensity;
+};
+
+layout (std430, binding = 0) readonly buffer b_pointLights
+{
+	PointLight lights[];
+};
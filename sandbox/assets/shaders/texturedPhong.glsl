@@ -1,64 +1,95 @@
-#region Vertex
-
-#version 440 core
-
-layout(location = 0) in vec3 a_vertexPosition;
-layout(location = 1) in vec3 a_vertexNormal;
-layout(location = 2) in vec2 a_texCoord;
-
-out vec3 fragmentPos;
-out vec3 normal;
-out vec2 texCoord;
-
-layout (std140) uniform b_camera
-{
-	mat4 u_projection;
-	mat4 u_view;
-};
-
-uniform mat4 u_model;
-
-void main()
-{
-	fragmentPos = vec3(u_model * vec4(a_vertexPosition, 1.0));
-	normal = mat3(transpose(inverse(u_model))) * a_vertexNormal;
-	texCoord = vec2(a_texCoord.x, a_texCoord.y);
-	gl_Position =  u_projection * u_view * u_model * vec4(a_vertexPosition,1.0);
-}
-
-
-#region Fragment
-
-#version 440 core
-
-layout(location = 0) out vec4 colour;
-in vec3 normal;
-in vec3 fragmentPos;
-in vec2 texCoord;
-
-layout (std140) uniform b_light
-{
-	vec3 u_lightPos; 
-	vec3 u_viewPos; 
-	vec3 u_lightColour;
-};
-uniform vec4 u_tint;
-
-
-uniform sampler2D u_texData;
-void main()
-{
-	float ambientStrength = 0.4;
-	vec3 ambient = ambientStrength * u_lightColour;
-	vec3 norm = normalize(normal);
-	vec3 lightDir = normalize(u_lightPos - fragmentPos);
-	float diff = max(dot(norm, lightDir), 0.0);
-	vec3 diffuse = diff * u_lightColour;
-	float specularStrength = 0.8;
-	vec3 viewDir = normalize(u_viewPos - fragmentPos);
-	vec3 reflectDir = reflect(-lightDir, norm);  
-	float spec = pow(max(dot(viewDir, reflectDir), 0.0), 64);
-	vec3 specular = specularStrength * spec * u_lightColour;  
-	
-	colour = vec4((ambient + diffuse + specular), 1.0) * texture(u_texData, texCoord) * u_tint;
-}
\ No newline at end of file
+#feature USE_TEXTURE 0
+#feature USE_TINT 1
+
+#region Vertex
+
+#version 440 core
+
+layout(location = 0) in vec3 a_vertexPosition;
+layout(location = 1) in vec3 a_vertexNormal;
+layout(location = 2) in vec2 a_texCoord;
+
+out vec3 fragmentPos;
+out vec3 normal;
+out vec2 texCoord;
+out float viewDepth;
+
+#include "include/camera.glsl"
+#include "include/draw.glsl"
+
+void main()
+{
+	fragmentPos = vec3(u_model * vec4(a_vertexPosition, 1.0));
+	normal = mat3(transpose(inverse(u_model))) * a_vertexNormal;
+	texCoord = vec2(a_texCoord.x, a_texCoord.y);
+	viewDepth = -(u_view * vec4(fragmentPos, 1.0)).z;
+	gl_Position =  u_projection * u_view * u_model * vec4(a_vertexPosition,1.0);
+}
+
+
+#region Fragment
+
+#version 440 core
+
+layout(location = 0) out vec4 colour;
+in vec3 normal;
+in vec3 fragmentPos;
+in vec2 texCoord;
+in float viewDepth;
+
+#include "include/light.glsl"
+
+#include "include/pointLights.glsl"
+
+layout (std430, binding = 1) readonly buffer b_lightGrid
+{
+	uvec2 lightGrid[]; // Offset into lightIndices and light count for each cluster
+};
+
+layout (std430, binding = 2) readonly buffer b_lightIndices
+{
+	uint lightIndices[];
+};
+
+#include "include/draw.glsl"
+
+#ifdef USE_TEXTURE
+uniform sampler2D u_texData;
+#endif
+
+void main()
+{
+	uvec3 dims = uvec3(u_clusterDims.xyz);
+	uvec2 tile = min(uvec2(gl_FragCoord.xy / u_clusterParams.zw), dims.xy - 1u);
+	uint slice = uint(clamp(log(viewDepth) * u_clusterParams.x - u_clusterParams.y, 0.0, float(dims.z - 1u)));
+	uvec2 cell = lightGrid[tile.x + tile.y * dims.x + slice * dims.x * dims.y];
+
+	vec3 norm = normalize(normal);
+	vec3 viewDir = normalize(u_viewPos - fragmentPos);
+	vec3 lighting = u_ambientColour;
+
+	for (uint i = 0u; i < cell.y; i++)
+	{
+		PointLight light = lights[lightIndices[cell.x + i]];
+		vec3 toLight = light.positionRadius.xyz - fragmentPos;
+		float dist = length(toLight);
+		float attenuation = clamp(1.0 - dist / light.positionRadius.w, 0.0, 1.0);
+		attenuation *= attenuation;
+
+		vec3 lightDir = toLight / max(dist, 0.0001);
+		float diff = max(dot(norm, lightDir), 0.0);
+		float specularStrength = 0.8;
+		vec3 reflectDir = reflect(-lightDir, norm);
+		float spec = pow(max(dot(viewDir, reflectDir), 0.0), 64);
+
+		lighting += (diff + specularStrength * spec) * light.colourIntensity.rgb * light.colourIntensity.a * attenuation;
+	}
+
+	colour = vec4(lighting, 1.0);
+#ifdef USE_TEXTURE
+	colour *= texture(u_texData, texCoord);
+#endif
+#ifdef USE_TINT
+	colour *= u_tint;
+#endif
+}
@@ -1,17 +1,17 @@
-/*! \file engineApp.cpp
-*/
-#include "engineApp.h"
-
-engineApp::engineApp()
-{
-}
-
-engineApp::~engineApp()
-{
-
-}
-
-Engine::Application* Engine::startApplication()
-{
-	return new engineApp();
+/*! \file engineApp.cpp
+*/
+#include "engineApp.h"
+
+engineApp::engineApp()
+{
+}
+
+engineApp::~engineApp()
+{
+
+}
+
+Engine::Application* Engine::startApplication()
+{
+	return new engineApp();
 }
\ No newline at end of file
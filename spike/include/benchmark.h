@@ -0,0 +1,130 @@
+/*! \file benchmark.h
+* \brief Small micro-benchmark harness in the style of Google Benchmark. Benchmarks are registered with BENCHMARK, timed over enough iterations
+* to fill the minimum time, and reported to the console and optionally as Google Benchmark JSON, so results can be compared across commits
+*/
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <chrono>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Benchmark
+{
+	/*! \class State
+	* \brief Passed to each benchmark. The benchmark loops over it with for (auto _ : state), only the loop is timed
+	*/
+	class State
+	{
+	public:
+		State(uint64_t iterations, int64_t argument) : m_iterations(iterations), m_argument(argument) {} //!< Constructor, takes the iterations to run and the benchmark's argument
+
+		/*! \struct Iterator
+		* \brief Counts the iterations down, stopping the timer when it reaches the end
+		*/
+		struct Iterator
+		{
+			State* state; //!< State being iterated, nullptr for the end
+			uint64_t remaining; //!< Iterations left
+
+			struct Value {}; //!< Nothing to hand the loop
+			Value operator*() const { return Value(); }
+			void operator++() { --remaining; }
+			bool operator!=(const Iterator&) //!< Stop the timer on the way out, so nothing after the loop is counted
+			{
+				if (remaining) return true;
+				state->stopTimer();
+				return false;
+			}
+		};
+
+		Iterator begin() { startTimer(); return { this, m_iterations }; } //!< Start timing the loop
+		Iterator end() { return { nullptr, 0 }; } //!< End of the loop
+
+		void pauseTiming() { stopTimer(); } //!< Stop counting time, for setup inside the loop
+		void resumeTiming() { startTimer(); } //!< Start counting time again
+
+		inline uint64_t iterations() const { return m_iterations; } //!< Getter for the iterations being run
+		inline int64_t range() const { return m_argument; } //!< Getter for the benchmark's argument
+		inline void setItemsProcessed(int64_t items) { m_items = items; } //!< Setter for the items processed over all iterations, reported per second
+		inline void setBytesProcessed(int64_t bytes) { m_bytes = bytes; } //!< Setter for the bytes processed over all iterations, reported per second
+		inline void skipWithError(const std::string& message) { m_error = message; } //!< Mark the benchmark as failed, its results aren't reported
+
+		inline int64_t getItemsProcessed() const { return m_items; } //!< Getter for the items processed
+		inline int64_t getBytesProcessed() const { return m_bytes; } //!< Getter for the bytes processed
+		inline const std::string& getError() const { return m_error; } //!< Getter for the error, empty if it ran
+		inline double getElapsed() const { return std::chrono::duration<double>(m_elapsed).count(); } //!< Getter for the time spent in the loop, in seconds
+		inline double getCPUElapsed() const { return m_cpuElapsed; } //!< Getter for the process CPU time spent in the loop, in seconds. Includes any other threads the process is running
+	private:
+		using clock = std::chrono::steady_clock;
+
+		void startTimer(); //!< Start the wall and CPU clocks
+		void stopTimer(); //!< Stop the wall and CPU clocks
+
+		uint64_t m_iterations; //!< Iterations to run
+		int64_t m_argument; //!< Benchmark's argument
+		int64_t m_items = 0; //!< Items processed over all iterations
+		int64_t m_bytes = 0; //!< Bytes processed over all iterations
+		std::string m_error; //!< Why the benchmark was skipped
+		clock::time_point m_start; //!< When timing last started
+		clock::duration m_elapsed = clock::duration::zero(); //!< Time counted so far
+		double m_cpuStart = 0.0; //!< Process CPU time when the loop started
+		double m_cpuElapsed = 0.0; //!< Process CPU time counted so far
+	};
+
+	using Function = void(*)(State&); //!< A benchmark
+
+	/*! \class Benchmark
+	* \brief A registered benchmark, with the arguments it is run with
+	*/
+	class Benchmark
+	{
+	public:
+		Benchmark(const char* name, Function function) : m_name(name), m_function(function) {} //!< Constructor, takes the name and the function
+		Benchmark* arg(int64_t argument) { m_arguments.push_back(argument); return this; } //!< Run once more with this argument, named name/argument
+		Benchmark* range(int64_t first, int64_t last, int64_t multiplier = 8); //!< Arguments from first to last, multiplying each time, last is always included
+
+		inline const std::string& getName() const { return m_name; } //!< Getter for the name
+		inline Function getFunction() const { return m_function; } //!< Getter for the function
+		inline const std::vector<int64_t>& getArguments() const { return m_arguments; } //!< Getter for the arguments, empty if it takes none
+	private:
+		std::string m_name; //!< Name of the benchmark
+		Function m_function; //!< Function to run
+		std::vector<int64_t> m_arguments; //!< Arguments to run with
+	};
+
+	Benchmark* registerBenchmark(const char* name, Function function); //!< Add a benchmark to the suite
+	int runAll(int argc, char** argv); //!< Run the benchmarks the command line picks, returns non zero if any failed. See benchmark.cpp for the options
+
+	namespace Detail
+	{
+		inline const volatile char* volatile sink = nullptr; //!< Written by doNotOptimize, so the value has to exist
+	}
+
+	template<class T>
+	inline void doNotOptimize(const T& value) //!< Stop the compiler from removing the work that made value
+	{
+#if defined(_MSC_VER)
+		Detail::sink = &reinterpret_cast<const volatile char&>(value);
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	inline void clobberMemory() //!< Stop the compiler from assuming anything about memory, so writes before it aren't removed
+	{
+#if defined(_MSC_VER)
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : : "memory");
+#endif
+	}
+}
+
+#define NG_BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define NG_BENCHMARK_CONCAT(a, b) NG_BENCHMARK_CONCAT_IMPL(a, b)
+#define BENCHMARK(function) static ::Benchmark::Benchmark* NG_BENCHMARK_CONCAT(s_benchmark, __LINE__) = ::Benchmark::registerBenchmark(#function, function) //!< Register a function as a benchmark, chain arg or range to give it arguments
@@ -1,4 +1,441 @@
-int main()
-{
-	return 0;
-}
\ No newline at end of file
+/*! \file Source.cpp
+* \brief Micro-benchmarks of the engine's hot paths. Renderers run on the null backend, so no GPU or window is needed and the numbers are the CPU side only.
+* Run from the sandbox folder so the font loads, e.g. Spike.exe --benchmark_out=results.json to keep the results of a commit
+*/
+#include "engine_pch.h"
+#include "benchmark.h"
+
+#include <fstream>
+#include <cstring>
+#include <vector>
+#include <array>
+#include <spdlog/sinks/null_sink.h>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "systems/log.h"
+#include "events/events.h"
+#include "events/eventHandler.h"
+#include "rendering/bufferLayout.h"
+#include "rendering/vertexPacking.h"
+#include "rendering/renderAPI.h"
+#include "rendering/mipChain.h"
+#include "renderer/renderer2D.h"
+#include "renderer/renderer3D.h"
+#include "renderer/gpuProfiler.h"
+#include "renderer/renderStats.h"
+
+using namespace Engine;
+
+namespace
+{
+	std::shared_ptr<VertexArray> s_cube; //!< Geometry submitted by the 3D benchmarks
+	std::shared_ptr<Material> s_material; //!< Textured and tinted material for the 3D benchmarks
+	std::shared_ptr<Texture> s_texture; //!< Texture for the 2D benchmarks
+	SceneWideUniform s_sceneWideUniform; //!< Camera block for both renderers
+	bool s_fontLoaded = false; //!< Is the font there for the text benchmarks?
+
+	void setup() //!< Create what the renderer benchmarks draw with, on the null backend
+	{
+		RenderAPI::setAPI(RenderAPI::API::None);
+
+		Renderer3D::init(1024, 768);
+		Renderer2D::init();
+		s_fontLoaded = std::ifstream("./assets/fonts/cour.ttf").good(); //!< init only logs if it is missing
+
+		float vertices[8 * 3] = { -1.f, -1.f, -1.f, 1.f, -1.f, -1.f, -1.f, 1.f, -1.f, 1.f, 1.f, -1.f, -1.f, -1.f, 1.f, 1.f, -1.f, 1.f, -1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
+		uint32_t indices[36] = { 1, 3, 7, 1, 7, 5, 0, 4, 6, 0, 6, 2, 2, 6, 7, 2, 7, 3, 0, 1, 5, 0, 5, 4, 4, 5, 7, 4, 7, 6, 0, 2, 3, 0, 3, 1 };
+		std::shared_ptr<VertexBuffer> VBO(VertexBuffer::create(vertices, sizeof(vertices), VertexBufferLayout({ ShaderDataType::Float3 })));
+		std::shared_ptr<IndexBuffer> IBO(IndexBuffer::create(indices, 36));
+		s_cube.reset(VertexArray::create());
+		s_cube->addVertexBuffer(VBO);
+		s_cube->setIndexBuffer(IBO);
+
+		unsigned char pixels[4 * 4 * 4];
+		for (auto& pixel : pixels) pixel = 255;
+		s_texture.reset(Texture::create(4, 4, 4, pixels));
+
+		std::shared_ptr<Shader> shader(Shader::create("./assets/shaders/texturedPhong.glsl")); //!< Never read on the null backend
+		s_material.reset(new Material(shader, s_texture, glm::vec4(1.f)));
+
+		std::shared_ptr<UniformBuffer> camera(UniformBuffer::create(UniformBufferLayout({ { "u_projection", ShaderDataType::Mat4 }, { "u_view", ShaderDataType::Mat4 } })));
+		s_sceneWideUniform["b_camera"_sid] = camera;
+	}
+
+	void startFrame() //!< Start a frame as Application::run does, so the command record, timer queries and stats are recycled rather than growing
+	{
+		RendererCommon::beginFrame();
+		GPUProfiler::beginFrame();
+		RenderStats::beginFrame();
+	}
+
+	void finishFrame() //!< End a frame as Application::run does
+	{
+		GPUProfiler::endFrame();
+		RenderStats::endFrame();
+	}
+
+#pragma region LAYOUT
+	void vertexBufferLayout(Benchmark::State& state) //!< Layout of the textured phong vertex
+	{
+		for (auto _ : state)
+		{
+			VertexBufferLayout layout({ { ShaderDataType::Float3, true }, { ShaderDataType::Short3, true }, { ShaderDataType::Short2, true } }, 24);
+			Benchmark::doNotOptimize(layout);
+		}
+	}
+	BENCHMARK(vertexBufferLayout);
+
+	void vertexBufferLayoutAddElement(Benchmark::State& state) //!< Building a layout an element at a time, which works the offsets out again for every element
+	{
+		for (auto _ : state)
+		{
+			VertexBufferLayout layout;
+			for (int64_t i = 0; i < state.range(); i++) layout.addElement(ShaderDataType::Float4);
+			Benchmark::doNotOptimize(layout);
+		}
+		state.setItemsProcessed(state.iterations() * state.range());
+	}
+	BENCHMARK(vertexBufferLayoutAddElement)->arg(4)->arg(16);
+
+	void uniformBufferLayout(Benchmark::State& state) //!< std140 layout of the camera block
+	{
+		for (auto _ : state)
+		{
+			UniformBufferLayout layout({ { "u_projection", ShaderDataType::Mat4 }, { "u_view", ShaderDataType::Mat4 }, { "u_viewPos", ShaderDataType::Float3 } });
+			Benchmark::doNotOptimize(layout);
+		}
+	}
+	BENCHMARK(uniformBufferLayout);
+#pragma endregion
+
+#pragma region PACKING
+	void normaliseNormal(Benchmark::State& state) //!< Packing normals into shorts
+	{
+		std::vector<glm::vec3> normals(1024);
+		for (size_t i = 0; i < normals.size(); i++) normals[i] = glm::normalize(glm::vec3(static_cast<float>(i % 7) - 3.f, static_cast<float>(i % 5) - 2.f, 1.f));
+		for (auto _ : state)
+		{
+			for (auto& normal : normals)
+			{
+				std::array<int16_t, 3> packed = normalise(normal);
+				Benchmark::doNotOptimize(packed);
+			}
+		}
+		state.setItemsProcessed(state.iterations() * normals.size());
+	}
+	BENCHMARK(normaliseNormal);
+
+	void normaliseUV(Benchmark::State& state) //!< Packing texture coordinates into shorts
+	{
+		std::vector<glm::vec2> UVs(1024);
+		for (size_t i = 0; i < UVs.size(); i++) UVs[i] = glm::vec2(static_cast<float>(i % 32) / 31.f, static_cast<float>(i / 32) / 31.f);
+		for (auto _ : state)
+		{
+			for (auto& UV : UVs)
+			{
+				std::array<int16_t, 2> packed = normalise(UV);
+				Benchmark::doNotOptimize(packed);
+			}
+		}
+		state.setItemsProcessed(state.iterations() * UVs.size());
+	}
+	BENCHMARK(normaliseUV);
+
+	void packColour(Benchmark::State& state) //!< Packing colours into a byte per channel
+	{
+		std::vector<glm::vec4> colours(1024);
+		for (size_t i = 0; i < colours.size(); i++) colours[i] = glm::vec4(static_cast<float>(i % 256) / 255.f, 0.5f, 0.25f, 1.f);
+		for (auto _ : state)
+		{
+			for (auto& colour : colours)
+			{
+				uint32_t packed = pack(colour);
+				Benchmark::doNotOptimize(packed);
+			}
+		}
+		state.setItemsProcessed(state.iterations() * colours.size());
+	}
+	BENCHMARK(packColour);
+#pragma endregion
+
+#pragma region QUAD
+	void quadCentreHalfExtend(Benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Quad quad = Quad::createCentreHalfExtend(glm::vec2(100.f, 200.f), glm::vec2(10.f, 20.f));
+			Benchmark::doNotOptimize(quad);
+		}
+	}
+	BENCHMARK(quadCentreHalfExtend);
+
+	void quadTopLeftSize(Benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Quad quad = Quad::createTopLeftSize(glm::vec2(100.f, 200.f), glm::vec2(10.f, 20.f));
+			Benchmark::doNotOptimize(quad);
+		}
+	}
+	BENCHMARK(quadTopLeftSize);
+
+	void quadTopLeftBottomRight(Benchmark::State& state)
+	{
+		for (auto _ : state)
+		{
+			Quad quad = Quad::createTopLeftBottomRight(glm::vec2(100.f, 200.f), glm::vec2(110.f, 220.f));
+			Benchmark::doNotOptimize(quad);
+		}
+	}
+	BENCHMARK(quadTopLeftBottomRight);
+#pragma endregion
+
+#pragma region EVENTS
+	void eventDispatchKeyPressed(Benchmark::State& state) //!< The path a key press takes from the window to the application
+	{
+		EventHandler handler;
+		int32_t handled = 0;
+		handler.setOnKeyPressedCallback([&handled](KeyPressed& e) { handled += e.getKeyCode(); return true; });
+		for (auto _ : state)
+		{
+			KeyPressed e(65, false);
+			Benchmark::doNotOptimize(handler.getOnKeyPressed()(e)); //!< The getter returns the callback by value, so this copies it like the window does
+		}
+		Benchmark::doNotOptimize(handled);
+	}
+	BENCHMARK(eventDispatchKeyPressed);
+
+	void eventDispatchMouseMoved(Benchmark::State& state) //!< The most frequent event
+	{
+		EventHandler handler;
+		float moved = 0.f;
+		handler.setOnMouseMovedCallback([&moved](MouseMoved& e) { moved += e.getX(); return true; });
+		for (auto _ : state)
+		{
+			MouseMoved e(1.f, 2.f);
+			Benchmark::doNotOptimize(handler.getOnMouseMoved()(e));
+		}
+		Benchmark::doNotOptimize(moved);
+	}
+	BENCHMARK(eventDispatchMouseMoved);
+#pragma endregion
+
+#pragma region LOG
+	/*! \class NullSinks
+	* \brief Swaps the console logger's sinks for a null sink while in scope, so the formatting is timed and the console isn't
+	*/
+	class NullSinks
+	{
+	public:
+		NullSinks() : m_logger(spdlog::get("Console"))
+		{
+			m_sinks = m_logger->sinks();
+			m_logger->sinks() = { std::make_shared<spdlog::sinks::null_sink_mt>() };
+		}
+		~NullSinks() { m_logger->sinks() = m_sinks; }
+	private:
+		std::shared_ptr<spdlog::logger> m_logger; //!< Console logger
+		std::vector<spdlog::sink_ptr> m_sinks; //!< Sinks to put back
+	};
+
+	void logRelease(Benchmark::State& state) //!< Formatting and dispatching a message, without the console
+	{
+		NullSinks sinks;
+		int32_t frame = 0;
+		for (auto _ : state) Log::release("Frame {0} took {1}ms", frame++, 16.6f);
+	}
+	BENCHMARK(logRelease);
+
+	void logReleaseFiltered(Benchmark::State& state) //!< A message below the logger's level
+	{
+		auto logger = spdlog::get("Console");
+		spdlog::level::level_enum level = logger->level();
+		logger->set_level(spdlog::level::off);
+		int32_t frame = 0;
+		for (auto _ : state) Log::release("Frame {0} took {1}ms", frame++, 16.6f);
+		logger->set_level(level);
+	}
+	BENCHMARK(logReleaseFiltered);
+
+	void logInfo(Benchmark::State& state) //!< Compiled out without NG_DEBUG, so a release build should time nothing
+	{
+		NullSinks sinks;
+		int32_t frame = 0;
+		for (auto _ : state) Log::info("Frame {0} took {1}ms", frame++, 16.6f);
+	}
+	BENCHMARK(logInfo);
+#pragma endregion
+
+#pragma region RENDERER
+	void renderer2DSubmitTint(Benchmark::State& state) //!< Untextured quads, batched into one draw per 1024
+	{
+		Quad quad = Quad::createCentreHalfExtend(glm::vec2(100.f, 100.f), 10.f);
+		glm::vec4 tint(1.f, 0.f, 0.f, 1.f);
+		for (auto _ : state)
+		{
+			startFrame();
+			Renderer2D::begin(s_sceneWideUniform);
+			for (int64_t i = 0; i < state.range(); i++) Renderer2D::submit(quad, tint);
+			Renderer2D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations() * state.range());
+	}
+	BENCHMARK(renderer2DSubmitTint)->arg(64)->arg(4096);
+
+	void renderer2DSubmitRotated(Benchmark::State& state) //!< Textured, tinted and rotated quads
+	{
+		Quad quad = Quad::createCentreHalfExtend(glm::vec2(100.f, 100.f), 10.f);
+		glm::vec4 tint(1.f, 0.f, 0.f, 1.f);
+		for (auto _ : state)
+		{
+			startFrame();
+			Renderer2D::begin(s_sceneWideUniform);
+			for (int64_t i = 0; i < state.range(); i++) Renderer2D::submit(quad, tint, s_texture, static_cast<float>(i), true);
+			Renderer2D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations() * state.range());
+	}
+	BENCHMARK(renderer2DSubmitRotated)->arg(4096);
+
+	void renderer3DSubmit(Benchmark::State& state) //!< Forward path draws with one material, so only the first binds the shader
+	{
+		std::vector<glm::mat4> models(static_cast<size_t>(state.range()));
+		for (size_t i = 0; i < models.size(); i++) models[i] = glm::translate(glm::mat4(1.f), glm::vec3(static_cast<float>(i), 0.f, 0.f));
+		for (auto _ : state)
+		{
+			startFrame();
+			Renderer3D::begin(s_sceneWideUniform);
+			for (auto& model : models) Renderer3D::submit(s_cube, s_material, model);
+			Renderer3D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations() * state.range());
+	}
+	BENCHMARK(renderer3DSubmit)->arg(64)->arg(4096);
+
+	void renderer3DSubmitDrawList(Benchmark::State& state) //!< Recording, sorting and drawing a list
+	{
+		std::vector<glm::mat4> models(static_cast<size_t>(state.range()));
+		for (size_t i = 0; i < models.size(); i++) models[i] = glm::translate(glm::mat4(1.f), glm::vec3(static_cast<float>(i), 0.f, 0.f));
+		DrawList list;
+		for (auto _ : state)
+		{
+			startFrame();
+			list.reset();
+			for (auto& model : models) list.record(s_cube, s_material, model);
+			list.sort();
+			Renderer3D::begin(s_sceneWideUniform);
+			Renderer3D::submit(list);
+			Renderer3D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations() * state.range());
+	}
+	BENCHMARK(renderer3DSubmitDrawList)->arg(4096);
+#pragma endregion
+
+#pragma region MIPS
+	std::vector<uint8_t> makeNoise(uint32_t size) //!< Square RGBA image of noise, so no filter gets an easy ride
+	{
+		std::vector<uint8_t> pixels(static_cast<size_t>(size) * size * 4);
+		uint32_t seed = 1;
+		for (auto& pixel : pixels)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			pixel = static_cast<uint8_t>(seed >> 24);
+		}
+		return pixels;
+	}
+
+	void mipChainBox(Benchmark::State& state) //!< The chain made for every texture load, on one thread as the spike doesn't start the pool
+	{
+		uint32_t size = static_cast<uint32_t>(state.range());
+		std::vector<uint8_t> pixels = makeNoise(size);
+		for (auto _ : state)
+		{
+			MipChain chain(pixels.data(), size, size, 4);
+			Benchmark::doNotOptimize(chain);
+		}
+		state.setBytesProcessed(state.iterations() * pixels.size());
+	}
+	BENCHMARK(mipChainBox)->arg(256)->arg(2048);
+
+	void mipChainKaiser(Benchmark::State& state) //!< The sRGB correct Kaiser chain the converter makes
+	{
+		uint32_t size = static_cast<uint32_t>(state.range());
+		std::vector<uint8_t> pixels = makeNoise(size);
+		for (auto _ : state)
+		{
+			MipChain chain(pixels.data(), size, size, 4, MipFilter::Kaiser, true);
+			Benchmark::doNotOptimize(chain);
+		}
+		state.setBytesProcessed(state.iterations() * pixels.size());
+	}
+	BENCHMARK(mipChainKaiser)->arg(256)->arg(2048);
+#pragma endregion
+
+#pragma region TEXT
+	void glyphRasterise(Benchmark::State& state) //!< One character, loaded by FreeType, expanded to RGBA and uploaded
+	{
+		if (!s_fontLoaded)
+		{
+			state.skipWithError("Font not found, run from the sandbox folder");
+			return;
+		}
+
+		float advance = 0.f;
+		glm::vec4 tint(1.f);
+		for (auto _ : state)
+		{
+			startFrame();
+			Renderer2D::begin(s_sceneWideUniform);
+			Renderer2D::submit('g', glm::vec2(10.f, 10.f), advance, tint);
+			Renderer2D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations());
+	}
+	BENCHMARK(glyphRasterise);
+
+	void textSubmit(Benchmark::State& state) //!< A line of the stats overlay
+	{
+		if (!s_fontLoaded)
+		{
+			state.skipWithError("Font not found, run from the sandbox folder");
+			return;
+		}
+
+		const char* text = "Draws 1024  Triangles 65536";
+		glm::vec4 tint(1.f);
+		for (auto _ : state)
+		{
+			startFrame();
+			Renderer2D::begin(s_sceneWideUniform);
+			Renderer2D::submit(text, glm::vec2(10.f, 30.f), tint, 0.2f);
+			Renderer2D::end();
+			finishFrame();
+		}
+		state.setItemsProcessed(state.iterations() * std::strlen(text));
+	}
+	BENCHMARK(textSubmit);
+#pragma endregion
+}
+
+int main(int argc, char** argv)
+{
+	std::shared_ptr<Log> logSystem(new Log);
+	logSystem->start(); //!< The renderers log, and the log benchmarks need the console logger
+
+	setup();
+	int result = Benchmark::runAll(argc, argv);
+
+	s_cube.reset();
+	s_material.reset();
+	s_texture.reset();
+	s_sceneWideUniform.clear();
+
+	logSystem->stop();
+	return result;
+}
@@ -0,0 +1,453 @@
+/*! \file benchmark.cpp
+* \brief Runs the registered benchmarks. Options, in the same form as Google Benchmark's:
+* --benchmark_filter=<regex>       Only run benchmarks whose name matches
+* --benchmark_min_time=<seconds>   Time each benchmark runs for at least, 0.5 by default
+* --benchmark_repetitions=<n>      Run each benchmark n times and report the mean, median and standard deviation too
+* --benchmark_out=<file>           Also write the results to file as Google Benchmark JSON, so tools like compare.py can diff two commits
+* --benchmark_format=<console|json> Format written to stdout
+* --benchmark_list_tests          List the benchmarks without running them
+*/
+#include "benchmark.h"
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <algorithm>
+#include <regex>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <thread>
+#include <memory>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace Benchmark
+{
+	namespace
+	{
+		/*! \struct Result
+		* \brief One run of one benchmark instance, or an aggregate of its repetitions
+		*/
+		struct Result
+		{
+			std::string name; //!< Name including the aggregate, e.g. name/8_mean
+			std::string runName; //!< Name of the instance, e.g. name/8
+			std::string aggregate; //!< Aggregate name, empty for a plain run
+			uint32_t family = 0; //!< Index of the registered benchmark
+			uint32_t instance = 0; //!< Index of the argument within the benchmark
+			uint32_t repetitions = 1; //!< Repetitions run of the instance
+			uint32_t repetition = 0; //!< Which repetition this is
+			uint64_t iterations = 0; //!< Iterations timed
+			double realTime = 0.0; //!< Wall time per iteration, nanoseconds
+			double cpuTime = 0.0; //!< CPU time per iteration, nanoseconds
+			double itemsPerSecond = 0.0; //!< Items processed per second, 0 if not set
+			double bytesPerSecond = 0.0; //!< Bytes processed per second, 0 if not set
+			std::string error; //!< Why the benchmark was skipped, empty if it ran
+		};
+
+		/*! \struct Options
+		* \brief Parsed command line
+		*/
+		struct Options
+		{
+			std::string filter = "."; //!< Regex benchmark names have to match
+			double minTime = 0.5; //!< Seconds each benchmark runs for at least
+			uint32_t repetitions = 1; //!< Runs of each benchmark
+			std::string out; //!< JSON file, empty for none
+			bool json = false; //!< Write JSON to stdout instead of the table
+			bool list = false; //!< Only list the benchmarks
+		};
+
+		constexpr uint64_t maxIterations = 1000000000; //!< Most iterations a benchmark is run for, however fast it is
+
+		std::vector<std::unique_ptr<Benchmark>>& getBenchmarks() //!< Registered benchmarks, a function so registering from static initialisers is safe
+		{
+			static std::vector<std::unique_ptr<Benchmark>> benchmarks;
+			return benchmarks;
+		}
+
+		double processCPUTime() //!< CPU time used by the process so far, in seconds
+		{
+#if defined(_WIN32)
+			FILETIME creation, exit, kernel, user;
+			if (!GetProcessTimes(GetCurrentProcess(), &creation, &exit, &kernel, &user)) return 0.0;
+			auto toSeconds = [](const FILETIME& time) { return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) * 1e-7; }; //!< 100ns ticks
+			return toSeconds(kernel) + toSeconds(user);
+#else
+			return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+		}
+
+		bool readOption(const std::string& argument, const char* name, std::string& value) //!< Read --name=value, returns false if argument is another option
+		{
+			std::string prefix = std::string("--") + name + "=";
+			if (argument.compare(0, prefix.size(), prefix) != 0) return false;
+			value = argument.substr(prefix.size());
+			return true;
+		}
+
+		bool parseOptions(int argc, char** argv, Options& options) //!< Returns false on an unknown option
+		{
+			for (int i = 1; i < argc; i++)
+			{
+				std::string argument = argv[i];
+				std::string value;
+				if (readOption(argument, "benchmark_filter", value)) options.filter = value;
+				else if (readOption(argument, "benchmark_min_time", value)) options.minTime = std::max(0.0, std::atof(value.c_str()));
+				else if (readOption(argument, "benchmark_repetitions", value)) options.repetitions = std::max(1, std::atoi(value.c_str()));
+				else if (readOption(argument, "benchmark_out", value)) options.out = value;
+				else if (readOption(argument, "benchmark_out_format", value))
+				{
+					if (value != "json") std::fprintf(stderr, "Only json is written to --benchmark_out, ignoring %s\n", value.c_str());
+				}
+				else if (readOption(argument, "benchmark_format", value)) options.json = value == "json";
+				else if (argument == "--benchmark_list_tests" || argument == "--benchmark_list_tests=true") options.list = true;
+				else
+				{
+					std::fprintf(stderr, "Unknown option %s\n", argument.c_str());
+					return false;
+				}
+			}
+			return true;
+		}
+
+		Result makeResult(const State& state, uint64_t iterations) //!< Per iteration times and rates from a finished run
+		{
+			Result result;
+			result.iterations = iterations;
+			result.error = state.getError();
+			double elapsed = state.getElapsed();
+			result.realTime = elapsed * 1e9 / static_cast<double>(iterations);
+			result.cpuTime = state.getCPUElapsed() * 1e9 / static_cast<double>(iterations);
+			if (elapsed > 0.0)
+			{
+				result.itemsPerSecond = static_cast<double>(state.getItemsProcessed()) / elapsed;
+				result.bytesPerSecond = static_cast<double>(state.getBytesProcessed()) / elapsed;
+			}
+			return result;
+		}
+
+		std::vector<Result> runInstance(Function function, int64_t argument, const Options& options) //!< Find how many iterations fill the minimum time, then time the repetitions
+		{
+			std::vector<Result> results;
+			uint64_t iterations = 1;
+			while (true)
+			{
+				State state(iterations, argument);
+				function(state);
+				double elapsed = state.getElapsed();
+				if (!state.getError().empty() || elapsed >= options.minTime || iterations >= maxIterations)
+				{
+					results.push_back(makeResult(state, iterations));
+					break;
+				}
+
+				double multiplier = options.minTime * 1.4 / std::max(elapsed, 1e-9); //!< Aim a little past the minimum so the next run is usually the last
+				if (elapsed / options.minTime <= 0.1) multiplier = std::min(multiplier, 10.0); //!< Short runs are too noisy to trust the estimate
+				uint64_t next = static_cast<uint64_t>(static_cast<double>(iterations) * multiplier);
+				iterations = std::min(std::max(next, iterations + 1), maxIterations);
+			}
+
+			for (uint32_t repetition = 1; repetition < options.repetitions && results[0].error.empty(); repetition++)
+			{
+				State state(iterations, argument); //!< Same iterations, so the repetitions are comparable
+				function(state);
+				results.push_back(makeResult(state, iterations));
+			}
+			return results;
+		}
+
+		void addAggregates(std::vector<Result>& runs) //!< Add the mean, median and standard deviation of the repetitions
+		{
+			if (runs.size() < 2 || !runs[0].error.empty()) return;
+
+			auto aggregate = [&runs](const char* name, auto statistic)
+			{
+				Result result = runs[0];
+				result.name = result.runName + "_" + name;
+				result.aggregate = name;
+				result.repetition = 0;
+				std::vector<double> values(runs.size());
+				for (size_t i = 0; i < runs.size(); i++) values[i] = runs[i].realTime;
+				result.realTime = statistic(values);
+				for (size_t i = 0; i < runs.size(); i++) values[i] = runs[i].cpuTime;
+				result.cpuTime = statistic(values);
+				for (size_t i = 0; i < runs.size(); i++) values[i] = runs[i].itemsPerSecond;
+				result.itemsPerSecond = statistic(values);
+				for (size_t i = 0; i < runs.size(); i++) values[i] = runs[i].bytesPerSecond;
+				result.bytesPerSecond = statistic(values);
+				return result;
+			};
+
+			auto mean = [](std::vector<double>& values)
+			{
+				double sum = 0.0;
+				for (double value : values) sum += value;
+				return sum / static_cast<double>(values.size());
+			};
+			auto median = [](std::vector<double>& values)
+			{
+				std::sort(values.begin(), values.end());
+				size_t middle = values.size() / 2;
+				return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) * 0.5;
+			};
+			auto stddev = [&mean](std::vector<double>& values)
+			{
+				double average = mean(values);
+				double sum = 0.0;
+				for (double value : values) sum += (value - average) * (value - average);
+				return std::sqrt(sum / static_cast<double>(values.size() - 1)); //!< Sample standard deviation, like Google Benchmark
+			};
+
+			Result meanResult = aggregate("mean", mean);
+			Result medianResult = aggregate("median", median);
+			Result stddevResult = aggregate("stddev", stddev);
+			runs.push_back(meanResult);
+			runs.push_back(medianResult);
+			runs.push_back(stddevResult);
+		}
+
+		std::string formatRate(double perSecond) //!< Rate with a k, M or G suffix
+		{
+			const char* suffixes[] = { "", "k", "M", "G", "T" };
+			uint32_t suffix = 0;
+			while (perSecond >= 1000.0 && suffix < 4)
+			{
+				perSecond /= 1000.0;
+				suffix++;
+			}
+			char buffer[32];
+			std::snprintf(buffer, sizeof(buffer), "%.4g%s/s", perSecond, suffixes[suffix]);
+			return buffer;
+		}
+
+		void printHeader(size_t nameWidth)
+		{
+			std::printf("%-*s %15s %15s %12s %s\n", static_cast<int>(nameWidth), "Benchmark", "Time", "CPU", "Iterations", "UserCounters...");
+			std::printf("%s\n", std::string(nameWidth + 62, '-').c_str());
+		}
+
+		void printResult(const Result& result, size_t nameWidth)
+		{
+			if (!result.error.empty())
+			{
+				std::printf("%-*s ERROR OCCURRED: '%s'\n", static_cast<int>(nameWidth), result.name.c_str(), result.error.c_str());
+				return;
+			}
+
+			std::printf("%-*s %12.0f ns %12.0f ns %12llu", static_cast<int>(nameWidth), result.name.c_str(), result.realTime, result.cpuTime,
+				static_cast<unsigned long long>(result.iterations));
+			if (result.bytesPerSecond > 0.0) std::printf(" bytes_per_second=%s", formatRate(result.bytesPerSecond).c_str());
+			if (result.itemsPerSecond > 0.0) std::printf(" items_per_second=%s", formatRate(result.itemsPerSecond).c_str());
+			std::printf("\n");
+			std::fflush(stdout);
+		}
+
+		std::string escape(const std::string& text) //!< Escape a string for JSON
+		{
+			std::string result;
+			for (char c : text)
+			{
+				switch (c)
+				{
+				case '"': result += "\\\""; break;
+				case '\\': result += "\\\\"; break;
+				case '\n': result += "\\n"; break;
+				case '\t': result += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(c) < 0x20)
+					{
+						char buffer[8];
+						std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+						result += buffer;
+					}
+					else result += c;
+				}
+			}
+			return result;
+		}
+
+		void writeJSON(std::ostream& stream, const std::vector<Result>& results, const char* executable) //!< Write the results in Google Benchmark's JSON schema
+		{
+			std::time_t now = std::time(nullptr);
+			char date[64];
+			std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+			stream << "{\n";
+			stream << "  \"context\": {\n";
+			stream << "    \"date\": \"" << date << "\",\n";
+			stream << "    \"executable\": \"" << escape(executable) << "\",\n";
+			stream << "    \"num_cpus\": " << std::thread::hardware_concurrency() << ",\n";
+			stream << "    \"mhz_per_cpu\": 0,\n"; //!< Not measured
+			stream << "    \"cpu_scaling_enabled\": false,\n";
+			stream << "    \"caches\": [],\n";
+#ifdef NG_DEBUG
+			stream << "    \"library_build_type\": \"debug\"\n";
+#else
+			stream << "    \"library_build_type\": \"release\"\n";
+#endif
+			stream << "  },\n";
+			stream << "  \"benchmarks\": [";
+
+			stream << std::setprecision(17);
+			for (size_t i = 0; i < results.size(); i++)
+			{
+				const Result& result = results[i];
+				stream << (i ? ",\n" : "\n") << "    {\n";
+				stream << "      \"name\": \"" << escape(result.name) << "\",\n";
+				stream << "      \"family_index\": " << result.family << ",\n";
+				stream << "      \"per_family_instance_index\": " << result.instance << ",\n";
+				stream << "      \"run_name\": \"" << escape(result.runName) << "\",\n";
+				stream << "      \"run_type\": \"" << (result.aggregate.empty() ? "iteration" : "aggregate") << "\",\n";
+				stream << "      \"repetitions\": " << result.repetitions << ",\n";
+				stream << "      \"repetition_index\": " << result.repetition << ",\n";
+				if (!result.aggregate.empty()) stream << "      \"aggregate_name\": \"" << result.aggregate << "\",\n";
+				stream << "      \"threads\": 1,\n";
+				if (!result.error.empty())
+				{
+					stream << "      \"error_occurred\": true,\n";
+					stream << "      \"error_message\": \"" << escape(result.error) << "\",\n";
+				}
+				stream << "      \"iterations\": " << result.iterations << ",\n";
+				stream << "      \"real_time\": " << result.realTime << ",\n";
+				stream << "      \"cpu_time\": " << result.cpuTime << ",\n";
+				if (result.bytesPerSecond > 0.0) stream << "      \"bytes_per_second\": " << result.bytesPerSecond << ",\n";
+				if (result.itemsPerSecond > 0.0) stream << "      \"items_per_second\": " << result.itemsPerSecond << ",\n";
+				stream << "      \"time_unit\": \"ns\"\n";
+				stream << "    }";
+			}
+			stream << "\n  ]\n}\n";
+		}
+	}
+
+	void State::startTimer()
+	{
+		m_cpuStart = processCPUTime();
+		m_start = clock::now();
+	}
+
+	void State::stopTimer()
+	{
+		m_elapsed += clock::now() - m_start;
+		m_cpuElapsed += processCPUTime() - m_cpuStart;
+	}
+
+	Benchmark* Benchmark::range(int64_t first, int64_t last, int64_t multiplier)
+	{
+		for (int64_t argument = first; argument < last; argument *= std::max<int64_t>(multiplier, 2)) m_arguments.push_back(argument);
+		m_arguments.push_back(last);
+		return this;
+	}
+
+	Benchmark* registerBenchmark(const char* name, Function function)
+	{
+		getBenchmarks().emplace_back(new Benchmark(name, function));
+		return getBenchmarks().back().get();
+	}
+
+	int runAll(int argc, char** argv)
+	{
+		Options options;
+		if (!parseOptions(argc, argv, options)) return 1;
+
+		std::regex filter;
+		try
+		{
+			filter = std::regex(options.filter);
+		}
+		catch (const std::regex_error&)
+		{
+			std::fprintf(stderr, "Invalid --benchmark_filter %s\n", options.filter.c_str());
+			return 1;
+		}
+
+		/*! \struct Instance
+		* \brief A benchmark with one of its arguments
+		*/
+		struct Instance
+		{
+			std::string name; //!< name or name/argument
+			Function function; //!< Function to run
+			int64_t argument; //!< Argument, 0 if it takes none
+			uint32_t family; //!< Index of the benchmark
+			uint32_t instance; //!< Index of the argument
+		};
+
+		std::vector<Instance> instances;
+		size_t nameWidth = 10;
+		auto& benchmarks = getBenchmarks();
+		for (uint32_t family = 0; family < benchmarks.size(); family++)
+		{
+			const Benchmark& benchmark = *benchmarks[family];
+			std::vector<std::pair<std::string, int64_t>> runs;
+			if (benchmark.getArguments().empty()) runs.push_back({ benchmark.getName(), 0 });
+			for (int64_t argument : benchmark.getArguments()) runs.push_back({ benchmark.getName() + "/" + std::to_string(argument), argument });
+
+			uint32_t instance = 0;
+			for (auto& run : runs)
+			{
+				if (!std::regex_search(run.first, filter)) continue;
+				instances.push_back({ run.first, benchmark.getFunction(), run.second, family, instance++ });
+				nameWidth = std::max(nameWidth, run.first.size() + (options.repetitions > 1 ? 7 : 0)); //!< Room for _median
+			}
+		}
+
+		if (options.list)
+		{
+			for (auto& instance : instances) std::printf("%s\n", instance.name.c_str());
+			return 0;
+		}
+
+		if (instances.empty())
+		{
+			std::fprintf(stderr, "No benchmarks match %s\n", options.filter.c_str());
+			return 1;
+		}
+
+		if (!options.json) printHeader(nameWidth);
+
+		std::vector<Result> results;
+		bool failed = false;
+		for (auto& instance : instances)
+		{
+			std::vector<Result> runs = runInstance(instance.function, instance.argument, options);
+			for (uint32_t i = 0; i < runs.size(); i++)
+			{
+				runs[i].name = runs[i].runName = instance.name;
+				runs[i].family = instance.family;
+				runs[i].instance = instance.instance;
+				runs[i].repetitions = options.repetitions;
+				runs[i].repetition = i;
+			}
+			addAggregates(runs);
+
+			for (auto& run : runs)
+			{
+				if (!run.error.empty()) failed = true;
+				if (!options.json) printResult(run, nameWidth);
+				results.push_back(run);
+			}
+		}
+
+		if (options.json) writeJSON(std::cout, results, argv[0]);
+
+		if (!options.out.empty())
+		{
+			std::ofstream file(options.out);
+			if (!file)
+			{
+				std::fprintf(stderr, "Couldn't open %s for writing\n", options.out.c_str());
+				return 1;
+			}
+			writeJSON(file, results, argv[0]);
+		}
+
+		return failed ? 1 : 0;
+	}
+}
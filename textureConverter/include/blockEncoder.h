@@ -0,0 +1,27 @@
+/*! \file blockEncoder.h
+* \brief Encoders for the block compression formats the engine loads. Quick bounding box fits, good enough for colour and normal maps, not a match for the slow exhaustive encoders
+*/
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "rendering/compressedImage.h"
+
+namespace Converter
+{
+	/*! \class BlockEncoder
+	* \brief Compresses RGBA8 images 4x4 pixels at a time. BC7 isn't encoded, its mode search is too big for a quick fit
+	*/
+	class BlockEncoder
+	{
+	public:
+		static std::vector<uint8_t> encode(Engine::CompressedFormat format, const uint8_t* rgba, uint32_t width, uint32_t height); //!< Compress a whole image, edge blocks repeat the last row and column
+
+		static void encodeBC1(const uint8_t* rgba, uint8_t* block); //!< Compress 16 RGBA pixels to 8 bytes, alpha is dropped
+		static void encodeBC3(const uint8_t* rgba, uint8_t* block); //!< Compress 16 RGBA pixels to 16 bytes
+		static void encodeBC4(const uint8_t* values, uint32_t stride, uint8_t* block); //!< Compress 16 single channel values, stride bytes apart, to 8 bytes
+		static void encodeBC5(const uint8_t* rgba, uint8_t* block); //!< Compress the red and green of 16 RGBA pixels to 16 bytes
+	private:
+		static void encodeColour(const uint8_t* rgba, uint8_t* block); //!< The 8 byte colour half of BC1 and BC3, always in four colour mode
+	};
+}
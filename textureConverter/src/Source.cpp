@@ -0,0 +1,144 @@
+/*! \file Source.cpp
+* \brief Offline texture converter. Decodes an image, builds its mip chain and writes it block compressed as a DDS file, which the engine uploads without decoding.
+* TextureConverter <input> <output.dds> [options]
+* --format=<bc1|bc3|bc4|bc5>  Format to write. By default BC3 if the image has any alpha, otherwise BC1
+* --filter=<kaiser|box>       Filter the mip levels are made with. By default Kaiser
+* --srgb                      Mark BC1 and BC3 colours as sRGB encoded, and filter them in linear space
+* --no-mips                   Only write the full size level
+*/
+#include "engine_pch.h"
+#include "blockEncoder.h"
+
+#include <cstring>
+#include <string>
+#include <vector>
+#include "systems/log.h"
+#include "systems/threadPool.h"
+#include "rendering/mipChain.h"
+#include "stb_image.h"
+
+using namespace Engine;
+
+namespace
+{
+	CompressedFormat parseFormat(const char* name) //!< Format named on the command line, None if it isn't one that can be written
+	{
+		if (std::strcmp(name, "bc1") == 0) return CompressedFormat::BC1;
+		if (std::strcmp(name, "bc3") == 0) return CompressedFormat::BC3;
+		if (std::strcmp(name, "bc4") == 0) return CompressedFormat::BC4;
+		if (std::strcmp(name, "bc5") == 0) return CompressedFormat::BC5;
+		return CompressedFormat::None;
+	}
+
+	const char* formatName(CompressedFormat format) //!< Name of a format, for the summary
+	{
+		switch (format)
+		{
+		case CompressedFormat::BC1: return "BC1";
+		case CompressedFormat::BC3: return "BC3";
+		case CompressedFormat::BC4: return "BC4";
+		case CompressedFormat::BC5: return "BC5";
+		case CompressedFormat::BC7: return "BC7";
+		default: return "none";
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::shared_ptr<Log> logSystem(new Log);
+	logSystem->start();
+	std::shared_ptr<ThreadPool> threadPool(new ThreadPool);
+	threadPool->start(); //!< The mip levels are split across the workers
+
+	if (argc < 3)
+	{
+		Log::release("Usage: TextureConverter <input> <output.dds> [--format=<bc1|bc3|bc4|bc5>] [--filter=<kaiser|box>] [--srgb] [--no-mips]");
+		threadPool->stop();
+		logSystem->stop();
+		return 1;
+	}
+
+	const char* input = argv[1];
+	const char* output = argv[2];
+	CompressedFormat format = CompressedFormat::None; //!< Picked from the image if not given
+	MipFilter filter = MipFilter::Kaiser; //!< Time is cheap offline
+	bool srgb = false;
+	bool mips = true;
+	for (int i = 3; i < argc; i++)
+	{
+		if (std::strncmp(argv[i], "--format=", 9) == 0)
+		{
+			format = parseFormat(argv[i] + 9);
+			if (format == CompressedFormat::None)
+			{
+				Log::release("Unknown format {0}, the formats written are bc1, bc3, bc4 and bc5", argv[i] + 9);
+				threadPool->stop();
+				logSystem->stop();
+				return 1;
+			}
+		}
+		else if (std::strcmp(argv[i], "--filter=kaiser") == 0) filter = MipFilter::Kaiser;
+		else if (std::strcmp(argv[i], "--filter=box") == 0) filter = MipFilter::Box;
+		else if (std::strcmp(argv[i], "--srgb") == 0) srgb = true;
+		else if (std::strcmp(argv[i], "--no-mips") == 0) mips = false;
+		else Log::release("Ignoring unknown option {0}", argv[i]);
+	}
+
+	int32_t width, height, channels;
+	unsigned char* decoded = stbi_load(input, &width, &height, &channels, 4); //!< Always RGBA, the encoders pick the channels they need
+	if (!decoded)
+	{
+		Log::release("Could not decode {0}", input);
+		threadPool->stop();
+		logSystem->stop();
+		return 1;
+	}
+	std::vector<uint8_t> level(decoded, decoded + static_cast<size_t>(width) * height * 4);
+	stbi_image_free(decoded);
+
+	if (format == CompressedFormat::None)
+	{
+		bool alpha = false;
+		for (size_t i = 3; i < level.size() && !alpha; i += 4) alpha = level[i] != 255;
+		format = alpha ? CompressedFormat::BC3 : CompressedFormat::BC1;
+	}
+	if (srgb && (format == CompressedFormat::BC4 || format == CompressedFormat::BC5))
+	{
+		Log::release("{0} holds data rather than colours, ignoring --srgb", formatName(format));
+		srgb = false;
+	}
+
+	CompressedImage image(format, srgb, width, height);
+	std::vector<uint8_t> blocks = Converter::BlockEncoder::encode(format, level.data(), width, height);
+	image.addLevel(blocks.data(), static_cast<uint32_t>(blocks.size()));
+	uint64_t uncompressed = level.size();
+
+	if (mips)
+	{
+		MipChain chain(level.data(), width, height, 4, filter, srgb, true); //!< Filtered as sRGB only where the colours will be read as sRGB
+		for (const auto& mip : chain.getLevels())
+		{
+			blocks = Converter::BlockEncoder::encode(format, chain.getData(mip), mip.width, mip.height);
+			image.addLevel(blocks.data(), static_cast<uint32_t>(blocks.size()));
+			uncompressed += mip.size;
+		}
+	}
+
+	if (!image.save(output))
+	{
+		Log::release("Could not write {0}", output);
+		threadPool->stop();
+		logSystem->stop();
+		return 1;
+	}
+
+	uint64_t compressed = 0;
+	for (const auto& entry : image.getLevels()) compressed += entry.size;
+	Log::release("Wrote {0}: {1}x{2} {3}{4}, {5} levels, {6} KB against {7} KB as RGBA8", output, width, height, formatName(format), srgb ? " sRGB" : "",
+		image.getLevels().size(), compressed / 1024, uncompressed / 1024);
+
+	threadPool->stop();
+	logSystem->stop();
+	return 0;
+}
@@ -0,0 +1,196 @@
+/*! \file blockEncoder.cpp */
+#include "blockEncoder.h"
+#include <algorithm>
+#include <utility>
+#include <cstdlib>
+
+namespace Converter
+{
+	namespace
+	{
+		uint16_t to565(const int32_t* colour) //!< Pack an RGB colour into 5:6:5 bits
+		{
+			return static_cast<uint16_t>(((colour[0] >> 3) << 11) | ((colour[1] >> 2) << 5) | (colour[2] >> 3));
+		}
+
+		void from565(uint16_t packed, int32_t* colour) //!< Unpack 5:6:5 bits, repeating the top bits into the bottom as the GPU does
+		{
+			int32_t red = (packed >> 11) & 31, green = (packed >> 5) & 63, blue = packed & 31;
+			colour[0] = (red << 3) | (red >> 2);
+			colour[1] = (green << 2) | (green >> 4);
+			colour[2] = (blue << 3) | (blue >> 2);
+		}
+
+		void writeLittleEndian(uint8_t* destination, uint64_t value, uint32_t bytes) //!< Store the low bytes of a value, least significant first
+		{
+			for (uint32_t i = 0; i < bytes; i++) destination[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	std::vector<uint8_t> BlockEncoder::encode(Engine::CompressedFormat format, const uint8_t * rgba, uint32_t width, uint32_t height)
+	{
+		uint32_t blockSize = Engine::CompressedImage::getBlockSize(format);
+		std::vector<uint8_t> blocks(Engine::CompressedImage::getLevelSize(format, width, height));
+		uint8_t pixels[16 * 4]; //!< The block being encoded, as RGBA
+		uint8_t* destination = blocks.data();
+
+		for (uint32_t blockY = 0; blockY < height; blockY += 4)
+		{
+			for (uint32_t blockX = 0; blockX < width; blockX += 4)
+			{
+				for (uint32_t y = 0; y < 4; y++)
+				{
+					for (uint32_t x = 0; x < 4; x++)
+					{
+						uint32_t sourceX = std::min(blockX + x, width - 1); //!< Past the edge, repeat the last column and row
+						uint32_t sourceY = std::min(blockY + y, height - 1);
+						std::copy_n(rgba + (sourceY * width + sourceX) * 4, 4, pixels + (y * 4 + x) * 4);
+					}
+				}
+
+				switch (format)
+				{
+				case Engine::CompressedFormat::BC1: encodeBC1(pixels, destination); break;
+				case Engine::CompressedFormat::BC3: encodeBC3(pixels, destination); break;
+				case Engine::CompressedFormat::BC4: encodeBC4(pixels, 4, destination); break;
+				case Engine::CompressedFormat::BC5: encodeBC5(pixels, destination); break;
+				default: break;
+				}
+				destination += blockSize;
+			}
+		}
+		return blocks;
+	}
+
+	void BlockEncoder::encodeBC1(const uint8_t * rgba, uint8_t * block)
+	{
+		encodeColour(rgba, block);
+	}
+
+	void BlockEncoder::encodeBC3(const uint8_t * rgba, uint8_t * block)
+	{
+		encodeBC4(rgba + 3, 4, block); //!< Alpha first, it is stored the same way as BC4
+		encodeColour(rgba, block + 8);
+	}
+
+	void BlockEncoder::encodeBC4(const uint8_t * values, uint32_t stride, uint8_t * block)
+	{
+		int32_t low = 255, high = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			low = std::min<int32_t>(low, values[i * stride]);
+			high = std::max<int32_t>(high, values[i * stride]);
+		}
+
+		block[0] = static_cast<uint8_t>(high); //!< First endpoint above the second picks the eight value palette
+		block[1] = static_cast<uint8_t>(low);
+		if (high == low)
+		{
+			writeLittleEndian(block + 2, 0, 6); //!< Every value is the first endpoint
+			return;
+		}
+
+		int32_t palette[8] = { high, low };
+		for (int32_t i = 1; i < 7; i++) palette[i + 1] = ((7 - i) * high + i * low) / 7; //!< Six steps between the endpoints
+
+		uint64_t indices = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			int32_t value = values[i * stride];
+			uint32_t best = 0;
+			int32_t bestError = 256;
+			for (uint32_t entry = 0; entry < 8; entry++)
+			{
+				int32_t error = std::abs(palette[entry] - value);
+				if (error < bestError)
+				{
+					bestError = error;
+					best = entry;
+				}
+			}
+			indices |= static_cast<uint64_t>(best) << (i * 3); //!< Three bits a value
+		}
+		writeLittleEndian(block + 2, indices, 6);
+	}
+
+	void BlockEncoder::encodeBC5(const uint8_t * rgba, uint8_t * block)
+	{
+		encodeBC4(rgba, 4, block); //!< Red
+		encodeBC4(rgba + 1, 4, block + 8); //!< Green
+	}
+
+	void BlockEncoder::encodeColour(const uint8_t * rgba, uint8_t * block)
+	{
+		int32_t low[3] = { 255, 255, 255 }, high[3] = { 0, 0, 0 }, mean[3] = { 0, 0, 0 };
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			for (uint32_t channel = 0; channel < 3; channel++)
+			{
+				int32_t value = rgba[i * 4 + channel];
+				low[channel] = std::min(low[channel], value);
+				high[channel] = std::max(high[channel], value);
+				mean[channel] += value;
+			}
+		}
+		for (auto& channel : mean) channel /= 16;
+
+		int32_t redGreen = 0, blueGreen = 0; //!< Covariance of red and blue with green, the sign says which diagonal of the box the colours lie along
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			int32_t green = rgba[i * 4 + 1] - mean[1];
+			redGreen += (rgba[i * 4] - mean[0]) * green;
+			blueGreen += (rgba[i * 4 + 2] - mean[2]) * green;
+		}
+		if (redGreen < 0) std::swap(low[0], high[0]);
+		if (blueGreen < 0) std::swap(low[2], high[2]);
+
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			int32_t inset = (high[channel] - low[channel]) / 16; //!< Pull the endpoints in a little, the extremes are rarely worth an endpoint
+			high[channel] -= inset;
+			low[channel] += inset;
+		}
+
+		uint16_t first = to565(high), second = to565(low);
+		if (first < second) std::swap(first, second); //!< First above second is four colour mode
+		writeLittleEndian(block, first, 2);
+		writeLittleEndian(block + 2, second, 2);
+		if (first == second)
+		{
+			writeLittleEndian(block + 4, 0, 4); //!< Every pixel is the first endpoint
+			return;
+		}
+
+		int32_t palette[4][3];
+		from565(first, palette[0]);
+		from565(second, palette[1]);
+		for (uint32_t channel = 0; channel < 3; channel++)
+		{
+			palette[2][channel] = (2 * palette[0][channel] + palette[1][channel]) / 3;
+			palette[3][channel] = (palette[0][channel] + 2 * palette[1][channel]) / 3;
+		}
+
+		uint32_t indices = 0;
+		for (uint32_t i = 0; i < 16; i++)
+		{
+			uint32_t best = 0;
+			int32_t bestError = INT32_MAX;
+			for (uint32_t entry = 0; entry < 4; entry++)
+			{
+				int32_t error = 0;
+				for (uint32_t channel = 0; channel < 3; channel++)
+				{
+					int32_t difference = palette[entry][channel] - rgba[i * 4 + channel];
+					error += difference * difference;
+				}
+				if (error < bestError)
+				{
+					bestError = error;
+					best = entry;
+				}
+			}
+			indices |= best << (i * 2); //!< Two bits a pixel
+		}
+		writeLittleEndian(block + 4, indices, 4);
+	}
+}